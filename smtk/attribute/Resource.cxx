@@ -1035,6 +1035,16 @@ void Resource::visit(smtk::resource::Component::Visitor& visitor) const
   std::for_each(m_attributes.begin(), m_attributes.end(), convertedVisitor);
 }
 
+bool Resource::gatherComponents(std::vector<smtk::resource::Component*>& components) const
+{
+  components.reserve(components.size() + m_attributes.size());
+  for (const auto& entry : m_attributes)
+  {
+    components.push_back(entry.second.get());
+  }
+  return true;
+}
+
 std::set<AttributePtr> Resource::attributes(
   const smtk::resource::ConstPersistentObjectPtr& object) const
 {
@@ -371,6 +371,7 @@ public:
 protected:
   Resource(const smtk::common::UUID& myID, smtk::resource::ManagerPtr manager);
   Resource(smtk::resource::ManagerPtr manager = nullptr);
+  bool gatherComponents(std::vector<smtk::resource::Component*>& components) const override;
   void internalFindAllDerivedDefinitions(
     smtk::attribute::DefinitionPtr def,
     bool onlyConcrete,
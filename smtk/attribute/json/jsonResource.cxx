@@ -15,14 +15,19 @@
 #include "smtk/attribute/Resource.h"
 #include "smtk/attribute/json/jsonAttribute.h"
 #include "smtk/attribute/json/jsonDefinition.h"
+#include "smtk/common/json/jsonBinary.h"
+#include "smtk/common/json/jsonStreaming.h"
 #include "smtk/io/Logger.h"
 #include "smtk/resource/json/jsonResource.h"
 #include "smtk/view/json/jsonView.h"
 
 #include "smtk/CoreExports.h"
 
+#include <functional>
 #include <queue>
+#include <sstream>
 #include <string>
+#include <vector>
 
 namespace smtk
 {
@@ -315,7 +320,17 @@ SMTKCORE_EXPORT void to_json(json& j, const smtk::attribute::ResourcePtr& res)
   // Process model info
 }
 
-SMTKCORE_EXPORT void from_json(const json& j, smtk::attribute::ResourcePtr& res)
+namespace
+{
+// Visit each attribute record of a document with the given functor.
+typedef std::function<void(const std::function<void(const json&)>&)> AttributeRecords;
+
+// Transcribe the document \a j into \a res, obtaining its attribute records
+// from \a attributes so that they need not be held by \a j.
+void transcribe(
+  const json& j,
+  smtk::attribute::ResourcePtr& res,
+  const AttributeRecords& attributes)
 {
   //TODO: v2Parser has a notion of rootName
   if (!res.get() || j.is_null())
@@ -719,70 +734,65 @@ SMTKCORE_EXPORT void from_json(const json& j, smtk::attribute::ResourcePtr& res)
   std::vector<ItemExpressionInfo> itemExpressionInfo;
   std::vector<AttRefInfo> attRefInfo;
   smtk::attribute::AttributePtr att;
-  auto attributes = j.find("Attributes");
-  if (attributes != j.end())
-  {
-    for (const auto& jAtt : *attributes)
+  attributes([&](const json& jAtt) {
+    auto name = jAtt.find("Name");
+    if (name == jAtt.end())
     {
-      auto name = jAtt.find("Name");
-      if (name == jAtt.end())
-      {
-        smtkErrorMacro(
-          smtk::io::Logger::instance(), "Invalid Attribute! - Missing json Attribute Name");
-        continue;
-      }
-      // Lets get the defintion for the attribute
-      auto type = jAtt.find("Type");
-      if (type == jAtt.end())
-      {
-        smtkErrorMacro(
-          smtk::io::Logger::instance(),
-          "Invalid Attribute! - Missing Type for attribute:" << *name);
-        continue;
-      }
-      smtk::attribute::DefinitionPtr def = res->findDefinition(*type);
-      if (def == nullptr)
-      {
-        smtkErrorMacro(
-          smtk::io::Logger::instance(),
-          "Invalid Attribute! - Cannot find Definition of Type:" << *type
-                                                                 << " for attribute:" << *name);
-        continue;
-      }
-      // Is the definition abstract?
-      if (def->isAbstract())
-      {
-        smtkErrorMacro(
-          smtk::io::Logger::instance(),
-          "Attribute: " << *name << " of Type: " << *type
-                        << "  - is based on an abstract definition");
-        continue;
-      }
+      smtkErrorMacro(
+        smtk::io::Logger::instance(), "Invalid Attribute! - Missing json Attribute Name");
+      return;
+    }
+    // Lets get the defintion for the attribute
+    auto type = jAtt.find("Type");
+    if (type == jAtt.end())
+    {
+      smtkErrorMacro(
+        smtk::io::Logger::instance(),
+        "Invalid Attribute! - Missing Type for attribute:" << *name);
+      return;
+    }
+    smtk::attribute::DefinitionPtr def = res->findDefinition(*type);
+    if (def == nullptr)
+    {
+      smtkErrorMacro(
+        smtk::io::Logger::instance(),
+        "Invalid Attribute! - Cannot find Definition of Type:" << *type
+                                                               << " for attribute:" << *name);
+      return;
+    }
+    // Is the definition abstract?
+    if (def->isAbstract())
+    {
+      smtkErrorMacro(
+        smtk::io::Logger::instance(),
+        "Attribute: " << *name << " of Type: " << *type
+                      << "  - is based on an abstract definition");
+      return;
+    }
 
-      auto id = jAtt.find("ID");
-      if (id == jAtt.end())
-      {
-        smtkErrorMacro(
-          smtk::io::Logger::instance(),
-          "Invalid Attribute! - Missing ID for attribute:" << *name << " of type:" << *type);
-        continue;
-      }
-      smtk::common::UUID uuid(id->get<std::string>());
+    auto id = jAtt.find("ID");
+    if (id == jAtt.end())
+    {
+      smtkErrorMacro(
+        smtk::io::Logger::instance(),
+        "Invalid Attribute! - Missing ID for attribute:" << *name << " of type:" << *type);
+      return;
+    }
+    smtk::common::UUID uuid(id->get<std::string>());
 
-      // Ok we can now create the attribute
-      att = res->createAttribute(*name, def, uuid);
+    // Ok we can now create the attribute
+    att = res->createAttribute(*name, def, uuid);
 
-      if (att == nullptr)
-      {
-        smtkErrorMacro(
-          smtk::io::Logger::instance(),
-          "Attribute: " << *name << " of Type: " << *type
-                        << "  - could not be created - is the name in use?");
-        continue;
-      }
-      smtk::attribute::from_json(jAtt, att, itemExpressionInfo, attRefInfo, convertedAttDefs);
+    if (att == nullptr)
+    {
+      smtkErrorMacro(
+        smtk::io::Logger::instance(),
+        "Attribute: " << *name << " of Type: " << *type
+                      << "  - could not be created - is the name in use?");
+      return;
     }
-  }
+    smtk::attribute::from_json(jAtt, att, itemExpressionInfo, attRefInfo, convertedAttDefs);
+  });
   // At this point we have all the attributes read in so lets
   // fix up all of the attribute references
   for (size_t i = 0; i < itemExpressionInfo.size(); i++)
@@ -879,5 +889,55 @@ SMTKCORE_EXPORT void from_json(const json& j, smtk::attribute::ResourcePtr& res)
   }
   res->setActiveCategoriesEnabled(enabled);
 }
+} // namespace
+
+SMTKCORE_EXPORT void from_json(const json& j, smtk::attribute::ResourcePtr& res)
+{
+  transcribe(j, res, [&j](const std::function<void(const json&)>& visit) {
+    auto attributes = j.find("Attributes");
+    if (attributes != j.end())
+    {
+      for (const auto& jAtt : *attributes)
+      {
+        visit(jAtt);
+      }
+    }
+  });
+}
+
+SMTKCORE_EXPORT bool from_json(
+  std::istream& stream,
+  smtk::attribute::ResourcePtr& res,
+  const std::function<bool(const json&)>& accept)
+{
+  // Attribute records precede the definitions they reference, so they cannot
+  // be transcribed as they are parsed. Instead, each is held in the compact
+  // binary encoding until the rest of the document has been transcribed.
+  std::vector<std::string> records;
+  smtk::common::StreamingJSON streaming;
+  streaming.addHandler(
+    { "Attributes", "*" }, [&records](const smtk::common::StreamingJSON::Path&, json& jAtt) {
+      std::ostringstream record;
+      smtk::common::BinaryJSON::write(jAtt, record);
+      records.push_back(record.str());
+    });
+  json j = streaming.parse(stream);
+
+  if (accept && !accept(j))
+  {
+    return false;
+  }
+
+  transcribe(j, res, [&records](const std::function<void(const json&)>& visit) {
+    for (auto& record : records)
+    {
+      std::istringstream stream(record);
+      json jAtt = smtk::common::BinaryJSON::read(stream);
+      std::string().swap(record);
+      visit(jAtt);
+    }
+  });
+  return true;
+}
 } // namespace attribute
 } // namespace smtk
@@ -19,6 +19,8 @@
 
 #include "smtk/CoreExports.h"
 
+#include <functional>
+#include <iosfwd>
 #include <string>
 
 namespace smtk
@@ -34,6 +36,19 @@ using json = nlohmann::json;
 SMTKCORE_EXPORT void to_json(json& j, const smtk::attribute::ResourcePtr& col);
 
 SMTKCORE_EXPORT void from_json(const json& j, smtk::attribute::ResourcePtr& col);
+
+/// Parse an attribute resource from \a stream (in either the text or binary
+/// encoding) into \a col without materializing the whole document. Each
+/// attribute record is held in a compact encoding as it is parsed and is
+/// transcribed once the definitions it depends upon have been. Before
+/// anything is transcribed, \a accept (if provided) is called with the rest
+/// of the document (i.e., everything but the attribute records) so that
+/// callers may validate it; if it returns false, false is returned.
+/// Exceptions thrown by the parser propagate to the caller.
+SMTKCORE_EXPORT bool from_json(
+  std::istream& stream,
+  smtk::attribute::ResourcePtr& col,
+  const std::function<bool(const json&)>& accept = nullptr);
 } // namespace attribute
 } // namespace smtk
 
@@ -33,6 +33,7 @@ SMTK_THIRDPARTY_PRE_INCLUDE
 #include "nlohmann/json.hpp"
 SMTK_THIRDPARTY_POST_INCLUDE
 
+#include <exception>
 #include <fstream>
 
 namespace smtk
@@ -46,43 +47,13 @@ Read::Result Read::operateInternal()
   std::string filename = this->parameters()->findFile("filename")->value();
 
   // Check the file's validity.
-  std::ifstream file(filename);
+  std::ifstream file(filename, std::ios::in | std::ios::binary);
   if (!file.good())
   {
     smtkErrorMacro(log(), "Cannot read file \"" << filename << "\".");
     return this->createResult(smtk::operation::Operation::Outcome::FAILED);
   }
 
-  // Read the file into nlohmann json.
-  nlohmann::json j;
-  try
-  {
-    j = nlohmann::json::parse(file);
-  }
-  catch (...)
-  {
-    smtkErrorMacro(log(), "Cannot parse file \"" << filename << "\".");
-    return this->createResult(smtk::operation::Operation::Outcome::FAILED);
-  }
-
-  // is the a supported version?  Should be 3.0 or 4.0
-  auto version = j.find("version");
-  if ((version == j.end()) || !((*version == "3.0") || (*version == "4.0")))
-  {
-    if (version == j.end())
-    {
-      smtkErrorMacro(log(), "Cannot read attribute file \"" << filename << "\" - Missing Version.");
-    }
-    else
-    {
-      smtkErrorMacro(
-        log(),
-        "Cannot read attribute file \"" << filename << "\" - Unsupported Version: " << *version
-                                        << ".");
-    }
-    return this->createResult(smtk::operation::Operation::Outcome::FAILED);
-  }
-
   // Create an attribute resource. If available, use the item definition
   // manager to populate the resource with custom items.
   smtk::attribute::Resource::Ptr resource = smtk::attribute::Resource::create();
@@ -121,8 +92,54 @@ Read::Result Read::operateInternal()
     }
   }
 
-  // Copy the contents of the json object into the attribute resource.
-  smtk::attribute::from_json(j, resource);
+  // Is this a supported version? Should be 3.0 or 4.0
+  // The document is parsed in full before \a supported is called and any of
+  // it is transcribed, so \a parsed distinguishes the two kinds of failure.
+  bool parsed = false;
+  auto supported = [this, &filename, &parsed](const nlohmann::json& j) {
+    parsed = true;
+    auto version = j.find("version");
+    if ((version == j.end()) || !((*version == "3.0") || (*version == "4.0")))
+    {
+      if (version == j.end())
+      {
+        smtkErrorMacro(
+          log(), "Cannot read attribute file \"" << filename << "\" - Missing Version.");
+      }
+      else
+      {
+        smtkErrorMacro(
+          log(),
+          "Cannot read attribute file \"" << filename << "\" - Unsupported Version: " << *version
+                                          << ".");
+      }
+      return false;
+    }
+    return true;
+  };
+
+  // Parse the file into the attribute resource. Attribute records are
+  // transcribed as the file is streamed rather than from a complete document.
+  try
+  {
+    if (!smtk::attribute::from_json(file, resource, supported))
+    {
+      return this->createResult(smtk::operation::Operation::Outcome::FAILED);
+    }
+  }
+  catch (std::exception& e)
+  {
+    if (parsed)
+    {
+      smtkErrorMacro(
+        log(), "Cannot transcribe attributes from \"" << filename << "\": " << e.what() << ".");
+    }
+    else
+    {
+      smtkErrorMacro(log(), "Cannot parse file \"" << filename << "\".");
+    }
+    return this->createResult(smtk::operation::Operation::Outcome::FAILED);
+  }
   resource->setLocation(filename);
 
   // Create a result object.
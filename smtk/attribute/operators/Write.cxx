@@ -21,6 +21,7 @@
 #include "smtk/attribute/json/jsonResource.h"
 
 #include "smtk/common/Paths.h"
+#include "smtk/common/json/jsonBinary.h"
 
 #include "smtk/io/Logger.h"
 
@@ -52,13 +53,14 @@ Write::Result Write::operateInternal()
   }
 
   {
-    std::ofstream file(resource->location());
+    std::ofstream file(resource->location(), std::ios::out | std::ios::binary);
     if (!file.good())
     {
       smtkErrorMacro(log(), "Unable to open \"" << resource->location() << "\" for writing.");
       return this->createResult(smtk::operation::Operation::Outcome::FAILED);
     }
-    file << j.dump(2);
+    smtk::common::BinaryJSON::dump(
+      j, file, smtk::common::BinaryJSON::isBinaryLocation(resource->location()));
     file.close();
   }
 
@@ -363,7 +363,7 @@ std::ifstream Archive::get(const std::string& archivedFilePath)
   std::string location = this->location(archivedFilePath);
   if (!location.empty())
   {
-    return std::ifstream(location);
+    return std::ifstream(location, std::ios::in | std::ios::binary);
   }
   return std::ifstream();
 #else
@@ -377,7 +377,7 @@ void Archive::get(const std::string& archivedFilePath, std::ifstream& stream)
   std::string location = this->location(archivedFilePath);
   if (!location.empty())
   {
-    stream.open(location);
+    stream.open(location, std::ios::in | std::ios::binary);
   }
 }
 
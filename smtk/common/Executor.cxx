@@ -0,0 +1,185 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/common/Executor.h"
+
+#include "smtk/io/Logger.h"
+
+namespace
+{
+// The executor (if any) whose worker is running on the current thread, and
+// the index of that worker. Tasks submitted from a worker are pushed onto its
+// own queue so that nested work stays local.
+thread_local const smtk::common::Executor* t_executor = nullptr;
+thread_local std::size_t t_workerIndex = 0;
+} // namespace
+
+namespace smtk
+{
+namespace common
+{
+
+Executor::Executor(unsigned int maxThreads)
+  : m_maxThreads(
+      maxThreads == 0 ? std::max(std::thread::hardware_concurrency(), 1u) : maxThreads)
+{
+  for (unsigned int i = 0; i < m_maxThreads; ++i)
+  {
+    m_workers.emplace_back(new Worker);
+  }
+}
+
+const std::shared_ptr<Executor>& Executor::instance()
+{
+  static const auto* executor = new std::shared_ptr<Executor>(std::make_shared<Executor>());
+  return *executor;
+}
+
+Executor::~Executor()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_sleepMutex);
+    m_active = false;
+  }
+  m_sleepCondition.notify_all();
+
+  for (auto& thread : m_threads)
+  {
+    thread.join();
+  }
+}
+
+void Executor::whenAll(std::vector<std::future<void>>& futures)
+{
+  for (auto& future : futures)
+  {
+    this->wait(future);
+    future.get();
+  }
+}
+
+bool Executor::runPendingTask()
+{
+  if (m_pending == 0)
+  {
+    return false;
+  }
+  std::unique_ptr<Job> job =
+    this->dequeue(t_executor == this ? t_workerIndex : m_nextWorker.load() % m_maxThreads);
+  if (!job)
+  {
+    return false;
+  }
+  Executor::run(job);
+  return true;
+}
+
+void Executor::enqueue(std::unique_ptr<Job>&& job, Priority priority)
+{
+  // Workers are spawned lazily so that an executor that is never used does
+  // not hold idle threads.
+  std::call_once(m_initialized, [this]() {
+    for (unsigned int i = 0; i < m_maxThreads; ++i)
+    {
+      m_threads.emplace_back(&Executor::execute, this, i);
+    }
+  });
+
+  job->m_logContext = smtk::io::Logger::Capture::context();
+
+  std::size_t index =
+    (t_executor == this ? t_workerIndex : m_nextWorker.fetch_add(1) % m_maxThreads);
+
+  // The pending count is incremented before the job is visible so that it
+  // never underflows when a worker grabs the job immediately.
+  ++m_pending;
+  {
+    Worker& worker = *m_workers[index];
+    std::lock_guard<std::mutex> lock(worker.m_mutex);
+    worker.m_lanes[static_cast<int>(priority)].push_back(std::move(job));
+  }
+
+  // Only touch the sleep mutex when a worker may be waiting on it.
+  if (m_sleeping > 0)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_sleepMutex);
+    }
+    m_sleepCondition.notify_one();
+  }
+}
+
+std::unique_ptr<Executor::Job> Executor::dequeue(std::size_t preferred)
+{
+  // Visit every lane in priority order, starting with the preferred worker's
+  // queue and then stealing from its neighbors.
+  for (int lane = 0; lane < 2; ++lane)
+  {
+    for (std::size_t i = 0; i < m_maxThreads; ++i)
+    {
+      Worker& worker = *m_workers[(preferred + i) % m_maxThreads];
+      std::lock_guard<std::mutex> lock(worker.m_mutex);
+      auto& queue = worker.m_lanes[lane];
+      if (!queue.empty())
+      {
+        std::unique_ptr<Job> job = std::move(queue.front());
+        queue.pop_front();
+        --m_pending;
+        return job;
+      }
+    }
+  }
+  return nullptr;
+}
+
+void Executor::run(std::unique_ptr<Job>& job)
+{
+  {
+    smtk::io::Logger::Capture::Scope logScope(job->m_logContext);
+    if (job->m_token.isCanceled())
+    {
+      job->cancel();
+    }
+    else
+    {
+      job->run();
+    }
+  }
+  job.reset();
+}
+
+void Executor::execute(std::size_t index)
+{
+  t_executor = this;
+  t_workerIndex = index;
+
+  while (true)
+  {
+    std::unique_ptr<Job> job = this->dequeue(index);
+    if (job)
+    {
+      Executor::run(job);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(m_sleepMutex);
+    ++m_sleeping;
+    m_sleepCondition.wait(lock, [this] { return m_pending > 0 || !m_active; });
+    --m_sleeping;
+
+    // Drain all outstanding tasks before exiting.
+    if (!m_active && m_pending == 0)
+    {
+      break;
+    }
+  }
+}
+} // namespace common
+} // namespace smtk
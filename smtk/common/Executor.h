@@ -0,0 +1,358 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_common_Executor_h
+#define smtk_common_Executor_h
+
+#include "smtk/CoreExports.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace smtk
+{
+namespace common
+{
+
+/// A shareable flag used to request that pending (and cooperative running)
+/// tasks be abandoned. Copies of a token refer to the same flag.
+class SMTKCORE_EXPORT CancellationToken
+{
+public:
+  CancellationToken()
+    : m_canceled(std::make_shared<std::atomic<bool>>(false))
+  {
+  }
+
+  /// Request cancellation of all tasks that share this token.
+  void cancel() const { m_canceled->store(true); }
+
+  /// Return true if cancellation has been requested.
+  bool isCanceled() const { return m_canceled->load(std::memory_order_relaxed); }
+
+private:
+  std::shared_ptr<std::atomic<bool>> m_canceled;
+};
+
+/// The exception stored in the future of a task that was canceled before
+/// it began to execute.
+class SMTKCORE_EXPORT TaskCanceled : public std::runtime_error
+{
+public:
+  TaskCanceled()
+    : std::runtime_error("Task was canceled before it was executed.")
+  {
+  }
+};
+
+/// A work-stealing task executor.
+///
+/// Each worker thread owns its own task queues (one per priority lane), so
+/// submissions and pops from different threads rarely contend on the same
+/// mutex. Idle workers steal from the queues of busy workers. Interactive
+/// tasks are always preferred over batch tasks, so a long-running batch task
+/// (e.g. a large import) does not keep many small interactive tasks waiting
+/// as long as another worker is available.
+///
+/// Tasks may be given a CancellationToken; if the token is canceled before a
+/// task starts, the task is skipped and its future holds a TaskCanceled
+/// exception.
+///
+/// Unlike ThreadPool, a single Executor accepts tasks of any return type.
+/// The executor waits for all submitted tasks to complete before it is
+/// destroyed.
+class SMTKCORE_EXPORT Executor
+{
+public:
+  /// Lanes used to order pending tasks.
+  enum class Priority
+  {
+    Interactive = 0, //!< Short tasks whose results a user is waiting upon.
+    Batch = 1        //!< Long-running or bulk tasks.
+  };
+
+  /// Construct an executor with \a maxThreads workers (or the hardware's
+  /// concurrency when \a maxThreads is 0). Workers are spawned lazily upon
+  /// the first submission.
+  Executor(unsigned int maxThreads = 0);
+  Executor(const Executor&) = delete;
+  Executor& operator=(const Executor&) = delete;
+  ~Executor();
+
+  /// Return the process-wide executor shared by the default operation
+  /// launchers and SMTK's parallel algorithms, so that they do not compete
+  /// for cores with separate pools. It is never destroyed, since joining its
+  /// workers during static destruction is unsafe (e.g., while a DLL unloads).
+  static const std::shared_ptr<Executor>& instance();
+
+  /// Submit a functor taking no arguments. Its return value is accessible
+  /// via the returned future.
+  template<typename Function>
+  std::future<typename std::result_of<Function()>::type> submit(
+    Function&& function,
+    Priority priority = Priority::Interactive,
+    const CancellationToken& token = CancellationToken());
+
+  /// Invoke \a function(first, last) on contiguous, non-overlapping chunks of
+  /// at most \a grain indices that cover [\a begin, \a end). The calling
+  /// thread participates in the work and this method returns once every
+  /// chunk has been processed. The first exception thrown by \a function is
+  /// rethrown to the caller.
+  template<typename Function>
+  void parallelFor(
+    std::size_t begin,
+    std::size_t end,
+    std::size_t grain,
+    const Function& function,
+    Priority priority = Priority::Batch);
+
+  /// Wait for each of \a futures and return their values in order. The
+  /// calling thread executes pending tasks while it waits, so it is safe to
+  /// call this from within a task running on this executor.
+  template<typename ReturnType>
+  std::vector<ReturnType> whenAll(std::vector<std::future<ReturnType>>& futures);
+  void whenAll(std::vector<std::future<void>>& futures);
+
+  /// Block until \a future is ready, executing pending tasks in the meantime.
+  template<typename Future>
+  void wait(const Future& future);
+
+  /// Execute at most one pending task on the calling thread. Returns true if
+  /// a task was run.
+  bool runPendingTask();
+
+  /// Return the number of worker threads.
+  std::size_t numberOfThreads() const { return m_maxThreads; }
+
+  /// Return the number of tasks that have been submitted but not started.
+  std::size_t numberOfPendingTasks() const { return m_pending.load(); }
+
+private:
+  /// Type-erased unit of work. A single heap allocation holds both the
+  /// functor and the promise used to report its result.
+  struct Job
+  {
+    Job(const CancellationToken& token)
+      : m_token(token)
+    {
+    }
+    virtual ~Job() = default;
+    virtual void run() = 0;
+    virtual void cancel() = 0;
+
+    CancellationToken m_token;
+    // The log captures active where the job was submitted (see
+    // smtk::io::Logger::Capture); they are installed while the job runs.
+    std::shared_ptr<void> m_logContext;
+  };
+
+  template<typename Function, typename ReturnType>
+  struct JobFor;
+
+  struct Worker
+  {
+    std::mutex m_mutex;
+    std::deque<std::unique_ptr<Job>> m_lanes[2];
+  };
+
+  void enqueue(std::unique_ptr<Job>&& job, Priority priority);
+  std::unique_ptr<Job> dequeue(std::size_t preferred);
+  void execute(std::size_t index);
+  static void run(std::unique_ptr<Job>& job);
+
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  std::vector<std::thread> m_threads;
+  std::once_flag m_initialized;
+  std::atomic<std::size_t> m_pending{ 0 };
+  std::atomic<std::size_t> m_sleeping{ 0 };
+  std::atomic<std::size_t> m_nextWorker{ 0 };
+  std::atomic<bool> m_active{ true };
+  std::mutex m_sleepMutex;
+  std::condition_variable m_sleepCondition;
+  unsigned int m_maxThreads;
+};
+
+template<typename Function, typename ReturnType>
+struct Executor::JobFor : public Executor::Job
+{
+  JobFor(Function&& function, const CancellationToken& token)
+    : Job(token)
+    , m_function(std::forward<Function>(function))
+  {
+  }
+
+  void run() override
+  {
+    try
+    {
+      m_promise.set_value(m_function());
+    }
+    catch (...)
+    {
+      m_promise.set_exception(std::current_exception());
+    }
+  }
+
+  void cancel() override { m_promise.set_exception(std::make_exception_ptr(TaskCanceled())); }
+
+  typename std::decay<Function>::type m_function;
+  std::promise<ReturnType> m_promise;
+};
+
+template<typename Function>
+struct Executor::JobFor<Function, void> : public Executor::Job
+{
+  JobFor(Function&& function, const CancellationToken& token)
+    : Job(token)
+    , m_function(std::forward<Function>(function))
+  {
+  }
+
+  void run() override
+  {
+    try
+    {
+      m_function();
+      m_promise.set_value();
+    }
+    catch (...)
+    {
+      m_promise.set_exception(std::current_exception());
+    }
+  }
+
+  void cancel() override { m_promise.set_exception(std::make_exception_ptr(TaskCanceled())); }
+
+  typename std::decay<Function>::type m_function;
+  std::promise<void> m_promise;
+};
+
+template<typename Function>
+std::future<typename std::result_of<Function()>::type>
+Executor::submit(Function&& function, Priority priority, const CancellationToken& token)
+{
+  typedef typename std::result_of<Function()>::type ReturnType;
+  auto* job = new JobFor<Function, ReturnType>(std::forward<Function>(function), token);
+  std::future<ReturnType> future = job->m_promise.get_future();
+  this->enqueue(std::unique_ptr<Job>(job), priority);
+  return future;
+}
+
+template<typename Function>
+void Executor::parallelFor(
+  std::size_t begin,
+  std::size_t end,
+  std::size_t grain,
+  const Function& function,
+  Priority priority)
+{
+  if (end <= begin)
+  {
+    return;
+  }
+  grain = std::max<std::size_t>(grain, 1);
+  const std::size_t numberOfChunks = (end - begin + grain - 1) / grain;
+
+  // State shared between the caller and its helpers. Helpers that start after
+  // all chunks have been claimed return without touching the functor, so it
+  // is safe for them to outlive this call.
+  struct State
+  {
+    std::atomic<std::size_t> next{ 0 };
+    std::size_t done{ 0 };
+    std::exception_ptr error;
+    std::mutex mutex;
+    std::condition_variable condition;
+  };
+  auto state = std::make_shared<State>();
+  const Function* functor = &function;
+
+  auto work = [state, functor, begin, end, grain, numberOfChunks]() {
+    std::size_t chunk;
+    while ((chunk = state->next.fetch_add(1)) < numberOfChunks)
+    {
+      std::exception_ptr error;
+      try
+      {
+        std::size_t first = begin + chunk * grain;
+        (*functor)(first, std::min(first + grain, end));
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+      }
+      std::lock_guard<std::mutex> lock(state->mutex);
+      if (error && !state->error)
+      {
+        state->error = error;
+      }
+      if (++state->done == numberOfChunks)
+      {
+        state->condition.notify_all();
+      }
+    }
+  };
+
+  std::size_t numberOfHelpers = std::min<std::size_t>(numberOfChunks - 1, m_maxThreads);
+  for (std::size_t i = 0; i < numberOfHelpers; ++i)
+  {
+    this->submit(work, priority);
+  }
+  work();
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->condition.wait(lock, [&state, numberOfChunks] { return state->done == numberOfChunks; });
+  if (state->error)
+  {
+    std::rethrow_exception(state->error);
+  }
+}
+
+template<typename Future>
+void Executor::wait(const Future& future)
+{
+  while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+  {
+    if (!this->runPendingTask())
+    {
+      future.wait_for(std::chrono::microseconds(100));
+    }
+  }
+}
+
+template<typename ReturnType>
+std::vector<ReturnType> Executor::whenAll(std::vector<std::future<ReturnType>>& futures)
+{
+  std::vector<ReturnType> results;
+  results.reserve(futures.size());
+  for (auto& future : futures)
+  {
+    this->wait(future);
+    results.push_back(future.get());
+  }
+  return results;
+}
+} // namespace common
+} // namespace smtk
+
+#endif // smtk_common_Executor_h
@@ -0,0 +1,134 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/common/MappedFile.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace smtk
+{
+namespace common
+{
+
+MappedFile::MappedFile(const std::string& filename)
+{
+  this->open(filename);
+}
+
+MappedFile::~MappedFile()
+{
+  this->close();
+}
+
+bool MappedFile::open(const std::string& filename)
+{
+  this->close();
+#ifdef _WIN32
+  HANDLE file = CreateFileA(
+    filename.c_str(),
+    GENERIC_READ,
+    FILE_SHARE_READ,
+    nullptr,
+    OPEN_EXISTING,
+    FILE_ATTRIBUTE_NORMAL,
+    nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    return false;
+  }
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size))
+  {
+    CloseHandle(file);
+    return false;
+  }
+  m_size = static_cast<std::size_t>(size.QuadPart);
+  if (m_size > 0)
+  {
+    // The mapping keeps the file open, so the file handle may be closed.
+    m_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!m_mapping)
+    {
+      m_size = 0;
+      return false;
+    }
+    m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!m_data)
+    {
+      CloseHandle(m_mapping);
+      m_mapping = nullptr;
+      m_size = 0;
+      return false;
+    }
+  }
+  else
+  {
+    CloseHandle(file);
+  }
+#else
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    return false;
+  }
+  struct stat info;
+  if (fstat(fd, &info) != 0)
+  {
+    ::close(fd);
+    return false;
+  }
+  m_size = static_cast<std::size_t>(info.st_size);
+  if (m_size > 0)
+  {
+    void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED)
+    {
+      ::close(fd);
+      m_size = 0;
+      return false;
+    }
+    m_data = static_cast<const char*>(data);
+  }
+  // The mapping remains valid after the descriptor is closed.
+  ::close(fd);
+#endif
+  m_open = true;
+  return true;
+}
+
+void MappedFile::close()
+{
+  if (m_data)
+  {
+#ifdef _WIN32
+    UnmapViewOfFile(m_data);
+    CloseHandle(m_mapping);
+    m_mapping = nullptr;
+#else
+    munmap(const_cast<char*>(m_data), m_size);
+#endif
+  }
+  m_open = false;
+  m_data = nullptr;
+  m_size = 0;
+}
+} // namespace common
+} // namespace smtk
@@ -0,0 +1,63 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_common_MappedFile_h
+#define smtk_common_MappedFile_h
+
+#include "smtk/CoreExports.h"
+
+#include <cstddef>
+#include <string>
+
+namespace smtk
+{
+namespace common
+{
+
+/**\brief A read-only, memory-mapped view of a file.
+  *
+  * The file's contents are paged in by the operating system as they are
+  * accessed, so mapping even a very large file is inexpensive; only the
+  * pages actually read consume memory. The mapping is released when the
+  * MappedFile is closed or destroyed.
+  */
+class SMTKCORE_EXPORT MappedFile
+{
+public:
+  MappedFile() = default;
+  /// Map \a filename; call isOpen() to determine whether this succeeded.
+  explicit MappedFile(const std::string& filename);
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  ~MappedFile();
+
+  /// Map \a filename, releasing any previous mapping. Returns true on success.
+  bool open(const std::string& filename);
+  /// Release the mapping (if any).
+  void close();
+
+  bool isOpen() const { return m_open; }
+  /// The mapped contents of the file (null if the file is empty or not open).
+  const char* data() const { return m_data; }
+  /// The number of bytes mapped.
+  std::size_t size() const { return m_size; }
+
+private:
+  bool m_open{ false };
+  const char* m_data{ nullptr };
+  std::size_t m_size{ 0 };
+#ifdef _WIN32
+  void* m_mapping{ nullptr };
+#endif
+};
+} // namespace common
+} // namespace smtk
+
+#endif // smtk_common_MappedFile_h
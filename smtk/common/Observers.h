@@ -10,14 +10,23 @@
 #ifndef __smtk_common_Observers_h
 #define __smtk_common_Observers_h
 
+#include "smtk/TupleTraits.h"
+#include "smtk/common/Executor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <map>
+#include <memory>
 #include <mutex>
-#include <set>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #define DEBUG_OBSERVERS 0
 
@@ -36,6 +45,78 @@ namespace smtk
 {
 namespace common
 {
+namespace detail
+{
+/// Hold an argument passed to an asynchronous observer until the observer
+/// runs. Arguments are copied when possible; objects that cannot be copied
+/// but are owned by a shared pointer (e.g., operations and resources) are
+/// passed by reference and kept alive until the observer has run. Other
+/// arguments cannot be held, so observers that take them are called
+/// synchronously.
+template<typename Type, typename Enable = void>
+struct ObserverArgument
+{
+  static constexpr bool held = false;
+};
+
+template<typename Type>
+struct ObserverArgument<
+  Type,
+  typename std::enable_if<std::is_copy_constructible<typename std::decay<Type>::type>::value>::type>
+{
+  static constexpr bool held = true;
+
+  ObserverArgument(const typename std::decay<Type>::type& value)
+    : m_value(value)
+  {
+  }
+
+  typename std::decay<Type>::type& get() { return m_value; }
+
+  typename std::decay<Type>::type m_value;
+};
+
+template<typename Type>
+struct ObserverArgument<
+  Type,
+  typename std::enable_if<
+    !std::is_copy_constructible<typename std::decay<Type>::type>::value &&
+    std::is_lvalue_reference<Type>::value &&
+    std::is_convertible<
+      decltype(std::declval<Type>().shared_from_this()),
+      std::shared_ptr<const void>>::value>::type>
+{
+  static constexpr bool held = true;
+
+  // Throws std::bad_weak_ptr if the value is not owned by a shared pointer.
+  ObserverArgument(Type value)
+    : m_owner(value.shared_from_this())
+    , m_value(&value)
+  {
+  }
+
+  Type get() { return *m_value; }
+
+  std::shared_ptr<const void> m_owner;
+  typename std::remove_reference<Type>::type* m_value;
+};
+
+template<typename... Types>
+struct ObserverArgumentsHeld;
+
+template<>
+struct ObserverArgumentsHeld<> : std::true_type
+{
+};
+
+template<typename Type, typename... Types>
+struct ObserverArgumentsHeld<Type, Types...>
+  : std::integral_constant<
+      bool,
+      ObserverArgument<Type>::held && ObserverArgumentsHeld<Types...>::value>
+{
+};
+} // namespace detail
 
 /// An Observer is a functor that is called when certain actions are performed.
 /// This pattern allows for the injection of algorithms in response to a group
@@ -67,6 +148,16 @@ namespace common
 /// goes out of scope, the Observer functor is removed from the Observers
 /// instance) by default. To decouple the Key's lifetime from that of the
 /// Observer functor, use the Key's release() method.
+///
+/// The list of Observer functors is copied when it is modified rather than
+/// when it is called, so calling observers neither locks nor allocates.
+/// Observer functors may insert or erase observers while they are being
+/// called: erased observers that have not yet been called are skipped, and
+/// inserted observers are first called by the next notification.
+///
+/// Observer functors that need not complete before the notification returns
+/// (e.g., logging or statistics) may be inserted with an Executor on which
+/// they are called asynchronously; see insert().
 template<typename Observer>
 class Observers
 {
@@ -77,6 +168,16 @@ public:
   /// called. Larger is higher priority.
   typedef int Priority;
 
+  /// The number of calls to (and time spent in) an observer.
+  struct Timing
+  {
+    Priority priority;
+    std::string description;
+    bool asynchronous;
+    std::size_t calls;
+    std::chrono::nanoseconds duration;
+  };
+
 private:
   /// A key by which an Observer can be accessed within the Observers instance.
   struct InternalKey : std::pair<int, int>
@@ -100,6 +201,29 @@ private:
     }
   };
 
+  /// An observer functor and the state shared with notifications in flight.
+  struct Entry
+  {
+    Entry(Observer observer, std::string description, Executor* executor)
+      : m_observer(std::move(observer))
+      , m_description(std::move(description))
+      , m_executor(executor)
+    {
+    }
+
+    Observer m_observer;
+    std::string m_description;
+    // The executor on which the observer is called, or null if the observer
+    // is called synchronously.
+    Executor* m_executor;
+    std::atomic<bool> m_active{ true };
+    std::atomic<std::size_t> m_calls{ 0 };
+    std::atomic<std::int64_t> m_nanoseconds{ 0 };
+  };
+
+  /// An immutable list of observers, ordered by their keys.
+  typedef std::vector<std::pair<InternalKey, std::shared_ptr<Entry>>> List;
+
 public:
   class Key final : InternalKey
   {
@@ -180,6 +304,7 @@ public:
     {
       if (m_observers)
       {
+        std::unique_lock<std::mutex> lock(m_observers->m_mutex);
         m_observers->m_keys[key] = this;
       }
     }
@@ -220,6 +345,7 @@ public:
 
   /// For Observer functors that return an integral value, call all Observer
   /// functors and aggregate their output using a bitwise OR operator.
+  /// Asynchronous observers do not contribute to the result.
   template<class... Types>
   auto callObserversDirectly(Types&&... args) -> typename std::enable_if<
     std::is_integral<decltype(std::declval<Observer>()(args...))>::value,
@@ -227,34 +353,17 @@ public:
   {
     decltype(std::declval<Observer>()(args...)) result = 0;
 
-    // Toggle m_observing flag to enable caching of requests to erase observers.
-    m_observing = true;
-    for (auto& entry : m_observers)
+    // Hold the current list of observers for the duration of the call, so
+    // that observers inserted or erased by observers do not disturb it.
+    std::shared_ptr<const List> observers = std::atomic_load(&m_list);
+    for (const auto& entry : *observers)
     {
-      // During iteration, some observers may have requested the erasure of
-      // other observers. Rather than directly remove them from the map and
-      // invalidate the iteration loop, we cache these requests and prevent
-      // these observers from being called (as though they were erased).
-      if (m_toErase.find(entry.first) == m_toErase.end())
+      // Observers erased by preceding observers are not called.
+      if (entry.second->m_active.load(std::memory_order_acquire))
       {
-#if !defined(NDEBUG) && DEBUG_OBSERVERS
-        std::cerr << "Calling observer (" << entry.first.first << ", " << entry.first.second
-                  << "): " << m_descriptions[entry.first] << std::endl;
-#endif
-        result |= entry.second(std::forward<Types>(args)...);
+        result |= this->call(entry, args...);
       }
     }
-    // Now that the iteration loop is complete, it is now safe to erase
-    // observers again.
-    m_observing = false;
-
-    // Remove observers that were marked for erasure during observation.
-    for (auto& toErase : m_toErase)
-    {
-      erase(toErase);
-    }
-    m_toErase.clear();
-
     return result;
   }
 
@@ -265,33 +374,14 @@ public:
     !std::is_integral<decltype(std::declval<Observer>()(args...))>::value,
     decltype(std::declval<Observer>()(args...))>::type
   {
-    // Toggle m_observing flag to enable caching of requests to erase observers.
-    m_observing = true;
-    for (auto& entry : m_observers)
+    std::shared_ptr<const List> observers = std::atomic_load(&m_list);
+    for (const auto& entry : *observers)
     {
-      // During iteration, some observers may have requested the erasure of
-      // other observers. Rather than directly remove them from the map and
-      // invalidate the iteration loop, we cache these requests and prevent
-      // these observers from being called (as though they were erased).
-      if (m_toErase.find(entry.first) == m_toErase.end())
+      if (entry.second->m_active.load(std::memory_order_acquire))
       {
-#if !defined(NDEBUG) && DEBUG_OBSERVERS
-        std::cerr << "Calling observer (" << entry.first.first << ", " << entry.first.second
-                  << "): " << m_descriptions[entry.first] << std::endl;
-#endif
-        entry.second(std::forward<Types>(args)...);
+        this->call(entry, args...);
       }
     }
-    // Now that the iteration loop is complete, it is now safe to erase
-    // observers again.
-    m_observing = false;
-
-    // Remove observers that were marked for erasure during observation.
-    for (auto& toErase : m_toErase)
-    {
-      erase(toErase);
-    }
-    m_toErase.clear();
   }
 
   /// Ask to receive notification (and possibly a chance to respond to) events.
@@ -303,59 +393,58 @@ public:
   /// means to run the Observer functor retroactively on things already under
   /// observation). The return value is a handle that can be used to unregister
   /// the observer.
-  Key insert(Observer fn, Priority priority, bool initialize, std::string description = "")
+  ///
+  /// If an \a executor is provided, the observer is called on it (at batch
+  /// priority) rather than by the thread that notifies observers, and its
+  /// return value is ignored. Its arguments are copied, or, for objects owned
+  /// by a shared pointer, kept alive until it runs; if its arguments cannot
+  /// be held, it is called synchronously. Asynchronous observers must only
+  /// access their arguments in ways that are safe while the notifying thread
+  /// continues. The \a executor must outlive the observer.
+  Key insert(
+    Observer fn,
+    Priority priority,
+    bool initialize,
+    std::string description = "",
+    Executor* executor = nullptr)
   {
-    // An observer's handle id (the second value in its key) defines the order
-    // in which the observer is called at a specific priority level. We
-    // monotonically increase this value for each priority value we encounter.
-    int handleId;
-    if (m_observers.empty())
+    if (initialize && m_initializer)
     {
-      // If there are no observers, then this observer is the first of its
-      // priority level.
-      handleId = 0;
+      m_initializer(fn);
     }
-    else
+
+    InternalKey handle;
     {
-      // Search for the the last observer (the one with the highest handle id)
-      // at the requested priority. To do this, we first access the first
-      // observer at the priority lower than the requested priority. We then
-      // access the observer before it.
-      typename std::map<InternalKey, Observer>::iterator upper;
-      if (priority != std::numeric_limits<Priority>::lowest())
-      {
-        auto key = InternalKey(priority - 1, -1);
-        upper = m_observers.upper_bound(key);
-
-        // If the found observer is the first observer in the map, the incident
-        // observer is the first at its priority level. It will be assigned as
-        // such by the subsequent logic of this method without the iterator
-        // decrement.
-        if (upper != m_observers.begin())
-        {
-          --upper;
-        }
-      }
-      else
+      std::unique_lock<std::mutex> lock(m_mutex);
+      std::shared_ptr<const List> list = std::atomic_load(&m_list);
+
+      // An observer's handle id (the second value in its key) defines the
+      // order in which the observer is called at a specific priority level.
+      // It is one greater than that of the last observer at the requested
+      // priority (or 0 if there are none).
+      auto position = std::upper_bound(
+        list->begin(),
+        list->end(),
+        InternalKey(priority, std::numeric_limits<int>::max()),
+        [](const InternalKey& lhs, const typename List::value_type& rhs) {
+          return lhs < rhs.first;
+        });
+      int handleId = 0;
+      if (position != list->begin() && std::prev(position)->first.first == priority)
       {
-        // If the requested priority is unset, we return the
-        // last observer in the map.
-        upper = --m_observers.end();
+        handleId = std::prev(position)->first.second + 1;
       }
-      // If the observer we found is at the same priority as the incident
-      // observer, the new handle id is one higher than the found observer's
-      // handle id. Otherwise, this is the first observer at this priority
-      // level.
-      handleId = (upper->first.first == priority ? upper->first.second + 1 : 0);
-    }
-    InternalKey handle = InternalKey(priority, handleId);
-    if (initialize && m_initializer)
-    {
-      m_initializer(fn);
+      handle = InternalKey(priority, handleId);
+
+      auto modified = std::make_shared<List>();
+      modified->reserve(list->size() + 1);
+      modified->insert(modified->end(), list->begin(), position);
+      modified->emplace_back(
+        handle, std::make_shared<Entry>(std::move(fn), std::move(description), executor));
+      modified->insert(modified->end(), position, list->end());
+      std::atomic_store(&m_list, std::shared_ptr<const List>(std::move(modified)));
     }
-
-    m_descriptions.insert(std::make_pair(handle, description));
-    return m_observers.insert(std::make_pair(handle, fn)).second ? Key(handle, this) : Key();
+    return Key(handle, this);
   }
 
   Key insert(Observer fn, std::string description = "")
@@ -364,28 +453,22 @@ public:
   }
 
   /// Indicate that an observer should no longer be called. Returns the number
-  /// of remaining observers.
+  /// of observers erased (i.e., 0 if \a handle was not observing, 1 otherwise).
   std::size_t erase(Key& handle)
   {
     handle.release();
-
-    if (m_observing)
-    {
-      m_toErase.insert(handle);
-      return m_observers.size() - m_toErase.size();
-    }
     return erase(static_cast<InternalKey&>(handle));
   }
 
   /// Return the observer for the given key if one exists or nullptr otherwise.
   Observer find(const Key& handle) const
   {
-    auto entry = m_observers.find(handle);
-    return entry == m_observers.end() ? nullptr : entry->second;
+    auto found = this->entry(handle);
+    return found ? found->m_observer : nullptr;
   }
 
   /// Return the number of Observer functors in this instance.
-  std::size_t size() const { return m_observers.size(); }
+  std::size_t size() const { return std::atomic_load(&m_list)->size(); }
 
   /// Replace the default implementation (calling each Observer functor in
   /// sequence) with a new behavior.
@@ -399,18 +482,51 @@ public:
 
   void setInitializer(Initializer fn) { m_initializer = fn; }
 
-  std::string description(Key handle) const { return m_descriptions[handle]; }
+  std::string description(Key handle) const
+  {
+    auto found = this->entry(handle);
+    return found ? found->m_description : std::string();
+  }
 
-protected:
-  // A map of observers. The observers are held in a map so that they can be
-  // referenced (and therefore removed) at a later time using the observer's
-  // associated key.
-  std::map<InternalKey, Observer> m_observers;
+  /// Enable or disable measurement of the time spent in each observer. It is
+  /// disabled by default.
+  void setTimingEnabled(bool enabled) { m_timing.store(enabled); }
+  bool timingEnabled() const { return m_timing.load(); }
+
+  /// Return the number of calls to (and time spent in) each observer, in the
+  /// order in which they are called, since timing was enabled.
+  std::vector<Timing> timings() const
+  {
+    std::shared_ptr<const List> list = std::atomic_load(&m_list);
+    std::vector<Timing> result;
+    result.reserve(list->size());
+    for (const auto& entry : *list)
+    {
+      result.push_back(Timing{ entry.first.first,
+                               entry.second->m_description,
+                               entry.second->m_executor != nullptr,
+                               entry.second->m_calls.load(),
+                               std::chrono::nanoseconds(entry.second->m_nanoseconds.load()) });
+    }
+    return result;
+  }
+
+  /// Reset the number of calls to and time spent in each observer.
+  void resetTimings()
+  {
+    std::shared_ptr<const List> list = std::atomic_load(&m_list);
+    for (const auto& entry : *list)
+    {
+      entry.second->m_calls.store(0);
+      entry.second->m_nanoseconds.store(0);
+    }
+  }
 
-  // A map of descriptions. A descriptions can be manually added to an observer
-  // during its insertion, or it can automatically refer to the location of the
-  // observer's insertion in the source code if the ADD_OBSERVER macro is used.
-  std::map<InternalKey, std::string> m_descriptions;
+protected:
+  // The observers, ordered by key. The list is never modified once it has
+  // been published; instead, insertion and erasure publish a modified copy
+  // (while holding m_mutex) so that notifications may iterate without locks.
+  std::shared_ptr<const List> m_list{ std::make_shared<List>() };
 
   // A functor to override the default behavior of the Observers' call method.
   Observer m_override;
@@ -423,11 +539,141 @@ private:
   {
     std::unique_lock<std::mutex> lock(m_mutex);
     m_keys.erase(key);
-    return m_observers.erase(key);
+
+    std::shared_ptr<const List> list = std::atomic_load(&m_list);
+    auto position = std::find_if(
+      list->begin(), list->end(), [&key](const typename List::value_type& candidate) {
+        return !(candidate.first < key) && !(key < candidate.first);
+      });
+    if (position == list->end())
+    {
+      return 0;
+    }
+
+    // Prevent notifications in flight from calling the erased observer.
+    position->second->m_active.store(false, std::memory_order_release);
+
+    auto modified = std::make_shared<List>();
+    modified->reserve(list->size() - 1);
+    modified->insert(modified->end(), list->begin(), position);
+    modified->insert(modified->end(), std::next(position), list->end());
+    std::atomic_store(&m_list, std::shared_ptr<const List>(std::move(modified)));
+    return 1;
+  }
+
+  std::shared_ptr<Entry> entry(const InternalKey& key) const
+  {
+    std::shared_ptr<const List> list = std::atomic_load(&m_list);
+    auto position = std::lower_bound(
+      list->begin(),
+      list->end(),
+      key,
+      [](const typename List::value_type& lhs, const InternalKey& rhs) { return lhs.first < rhs; });
+    return position != list->end() && !(key < position->first) ? position->second
+                                                                : std::shared_ptr<Entry>();
+  }
+
+  // Call an observer synchronously, or schedule it to be called
+  // asynchronously (in which case the default value of its result is
+  // returned).
+  template<class... Types>
+  auto call(const typename List::value_type& entry, Types&&... args)
+    -> decltype(std::declval<Observer>()(args...))
+  {
+#if !defined(NDEBUG) && DEBUG_OBSERVERS
+    std::cerr << "Calling observer (" << entry.first.first << ", " << entry.first.second
+              << "): " << entry.second->m_description << std::endl;
+#endif
+    if (
+      entry.second->m_executor &&
+      this->schedule(
+        entry.second,
+        std::integral_constant<bool, detail::ObserverArgumentsHeld<Types...>::value>(),
+        args...))
+    {
+      return decltype(std::declval<Observer>()(args...))();
+    }
+    if (!m_timing.load(std::memory_order_relaxed))
+    {
+      return entry.second->m_observer(std::forward<Types>(args)...);
+    }
+    Timer timer(*entry.second);
+    return entry.second->m_observer(std::forward<Types>(args)...);
+  }
+
+  // Submit an observer to its executor along with the arguments it is passed.
+  // Returns false if the arguments cannot be held.
+  template<class... Types>
+  bool schedule(const std::shared_ptr<Entry>& entry, std::true_type, Types&&... args)
+  {
+    typedef std::tuple<detail::ObserverArgument<Types>...> Arguments;
+    typedef typename smtk::index_sequence<sizeof...(Types)>::type Indices;
+    std::shared_ptr<Arguments> arguments;
+    try
+    {
+      arguments = std::make_shared<Arguments>(args...);
+    }
+    catch (std::bad_weak_ptr&)
+    {
+      return false;
+    }
+    bool timing = m_timing.load(std::memory_order_relaxed);
+    entry->m_executor->submit(
+      [entry, arguments, timing]() {
+        if (!entry->m_active.load(std::memory_order_acquire))
+        {
+          return;
+        }
+        if (timing)
+        {
+          Timer timer(*entry);
+          Observers::invoke(*entry, *arguments, Indices());
+        }
+        else
+        {
+          Observers::invoke(*entry, *arguments, Indices());
+        }
+      },
+      Executor::Priority::Batch);
+    return true;
   }
 
-  bool m_observing{ false };
-  std::set<InternalKey> m_toErase;
+  template<class... Types>
+  bool schedule(const std::shared_ptr<Entry>&, std::false_type, Types&&...)
+  {
+    return false;
+  }
+
+  template<typename Arguments, std::size_t... I>
+  static void invoke(Entry& entry, Arguments& arguments, smtk::sequence<I...>)
+  {
+    entry.m_observer(std::get<I>(arguments).get()...);
+  }
+
+  // Accumulate the time spent in an observer.
+  struct Timer
+  {
+    Timer(Entry& entry)
+      : m_entry(entry)
+      , m_start(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~Timer()
+    {
+      m_entry.m_calls.fetch_add(1, std::memory_order_relaxed);
+      m_entry.m_nanoseconds.fetch_add(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - m_start)
+          .count(),
+        std::memory_order_relaxed);
+    }
+
+    Entry& m_entry;
+    std::chrono::steady_clock::time_point m_start;
+  };
+
+  std::atomic<bool> m_timing{ false };
 
   std::mutex m_mutex;
   std::map<InternalKey, Key*> m_keys;
@@ -0,0 +1,988 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/common/json/jsonBinary.h"
+
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace smtk
+{
+namespace common
+{
+namespace
+{
+using json = nlohmann::json;
+
+// Binary documents start with these bytes followed by the format version as
+// a 4-byte little-endian integer. No text document can start with 0x89.
+const char magic[8] = { '\x89', 'S', 'M', 'T', 'K', 'B', '\r', '\n' };
+constexpr std::size_t uuidSize = 16;
+constexpr std::size_t uuidLength = 36;
+
+// Every value is prefixed by one of these tags.
+enum Tag : std::uint8_t
+{
+  Null = 0,
+  False,
+  True,
+  Integer,     // zig-zag encoded varint
+  Unsigned,    // varint
+  Float,       // 8-byte IEEE 754
+  String,      // varint length followed by UTF-8 bytes
+  Uuid,        // 16 raw bytes
+  Array,       // varint count followed by tagged values
+  Object,      // varint count followed by key/value pairs
+  NumberArray, // varint count, a NumberType and then fixed-width values
+  UuidArray,   // varint count followed by 16 raw bytes per entry
+  UuidObject   // varint count, 16 raw bytes per key, then a sequence of values
+};
+
+// The element type of a NumberArray.
+enum NumberType : std::uint8_t
+{
+  Float64 = 0,
+  Int64,
+  UInt64,
+  Int32,
+  UInt32
+};
+
+// Object keys are written as a varint: NewKey is followed by a string that is
+// appended to the key table, UuidKey by 16 raw bytes, and any other value v
+// refers to entry (v - FirstKey) of the key table.
+enum KeyReference : std::uint64_t
+{
+  NewKey = 0,
+  UuidKey = 1,
+  FirstKey = 2
+};
+
+int hexValue(char c)
+{
+  if (c >= '0' && c <= '9')
+  {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f')
+  {
+    return c - 'a' + 10;
+  }
+  return -1;
+}
+
+bool isDash(std::size_t position)
+{
+  return position == 8 || position == 13 || position == 18 || position == 23;
+}
+
+// Convert a UUID in the canonical (lower-case) text form written by
+// smtk::common::UUID into raw bytes. Other strings (including upper-case
+// UUIDs, which would not survive a round trip) are rejected.
+bool uuidBytes(const std::string& text, std::uint8_t* bytes)
+{
+  if (text.size() != uuidLength)
+  {
+    return false;
+  }
+  std::size_t byte = 0;
+  for (std::size_t ii = 0; ii < uuidLength; ++ii)
+  {
+    if (isDash(ii))
+    {
+      if (text[ii] != '-')
+      {
+        return false;
+      }
+      continue;
+    }
+    int high = hexValue(text[ii]);
+    int low = hexValue(text[++ii]);
+    if (high < 0 || low < 0 || isDash(ii))
+    {
+      return false;
+    }
+    bytes[byte++] = static_cast<std::uint8_t>((high << 4) | low);
+  }
+  return true;
+}
+
+bool isUuid(const json& j)
+{
+  std::uint8_t bytes[uuidSize];
+  return j.is_string() && uuidBytes(j.get_ref<const std::string&>(), bytes);
+}
+
+std::string uuidText(const std::uint8_t* bytes)
+{
+  static const char digits[] = "0123456789abcdef";
+  std::string text(uuidLength, '-');
+  std::size_t byte = 0;
+  for (std::size_t ii = 0; ii < uuidLength; ++ii)
+  {
+    if (!isDash(ii))
+    {
+      text[ii] = digits[bytes[byte] >> 4];
+      text[++ii] = digits[bytes[byte++] & 0xf];
+    }
+  }
+  return text;
+}
+
+class Encoder
+{
+public:
+  Encoder(std::ostream& stream)
+    : m_stream(stream)
+  {
+  }
+
+  ~Encoder() { this->flush(); }
+
+  void header()
+  {
+    m_buffer.append(magic, sizeof(magic));
+    this->fixed(BinaryJSON::version, 4);
+  }
+
+  void value(const json& j)
+  {
+    switch (j.type())
+    {
+      case json::value_t::null:
+        this->byte(Null);
+        break;
+      case json::value_t::boolean:
+        this->byte(j.get<bool>() ? True : False);
+        break;
+      case json::value_t::number_integer:
+      {
+        std::int64_t number = j.get<std::int64_t>();
+        this->byte(Integer);
+        this->varint(
+          (static_cast<std::uint64_t>(number) << 1) ^ static_cast<std::uint64_t>(number >> 63));
+      }
+      break;
+      case json::value_t::number_unsigned:
+        this->byte(Unsigned);
+        this->varint(j.get<std::uint64_t>());
+        break;
+      case json::value_t::number_float:
+        this->byte(Float);
+        this->real(j.get<double>());
+        break;
+      case json::value_t::string:
+        this->string(j.get_ref<const std::string&>());
+        break;
+      case json::value_t::array:
+        this->sequence(j);
+        break;
+      case json::value_t::object:
+        this->object(j);
+        break;
+      default:
+        throw std::runtime_error("Value cannot be encoded in a binary SMTK document.");
+    }
+    if (m_buffer.size() > (1 << 16))
+    {
+      this->flush();
+    }
+  }
+
+private:
+  void byte(std::uint8_t value) { m_buffer.push_back(static_cast<char>(value)); }
+
+  void varint(std::uint64_t value)
+  {
+    while (value >= 0x80)
+    {
+      this->byte(static_cast<std::uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    this->byte(static_cast<std::uint8_t>(value));
+  }
+
+  void fixed(std::uint64_t value, std::size_t bytes)
+  {
+    for (std::size_t ii = 0; ii < bytes; ++ii, value >>= 8)
+    {
+      this->byte(static_cast<std::uint8_t>(value & 0xff));
+    }
+  }
+
+  void real(double value)
+  {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    this->fixed(bits, sizeof(bits));
+  }
+
+  void raw(const std::uint8_t* bytes, std::size_t size)
+  {
+    m_buffer.append(reinterpret_cast<const char*>(bytes), size);
+  }
+
+  void string(const std::string& value)
+  {
+    std::uint8_t bytes[uuidSize];
+    if (uuidBytes(value, bytes))
+    {
+      this->byte(Uuid);
+      this->raw(bytes, uuidSize);
+      return;
+    }
+    this->byte(String);
+    this->varint(value.size());
+    m_buffer.append(value);
+  }
+
+  void key(const std::string& value)
+  {
+    std::uint8_t bytes[uuidSize];
+    auto it = m_keys.find(value);
+    if (it != m_keys.end())
+    {
+      this->varint(it->second + FirstKey);
+    }
+    else if (uuidBytes(value, bytes))
+    {
+      this->varint(UuidKey);
+      this->raw(bytes, uuidSize);
+    }
+    else
+    {
+      this->varint(NewKey);
+      this->varint(value.size());
+      m_buffer.append(value);
+      m_keys.emplace(value, m_keys.size());
+    }
+  }
+
+  // Write the values held by an array or object (in iteration order) as an
+  // array, using a contiguous buffer when the values are uniform.
+  void sequence(const json& container)
+  {
+    std::size_t size = container.size();
+    NumberType type;
+    if (size > 1 && this->numberType(container, type))
+    {
+      this->byte(NumberArray);
+      this->varint(size);
+      this->byte(type);
+      for (const auto& value : container)
+      {
+        switch (type)
+        {
+          case Float64:
+            this->real(value.get<double>());
+            break;
+          case Int64:
+          case UInt64:
+            this->fixed(value.get<std::uint64_t>(), 8);
+            break;
+          case Int32:
+          case UInt32:
+            this->fixed(value.get<std::uint64_t>(), 4);
+            break;
+        }
+      }
+      return;
+    }
+
+    if (size > 0 && std::all_of(container.begin(), container.end(), isUuid))
+    {
+      this->byte(UuidArray);
+      this->varint(size);
+      std::uint8_t bytes[uuidSize];
+      for (const auto& value : container)
+      {
+        uuidBytes(value.get_ref<const std::string&>(), bytes);
+        this->raw(bytes, uuidSize);
+      }
+      return;
+    }
+
+    this->byte(Array);
+    this->varint(size);
+    for (const auto& value : container)
+    {
+      this->value(value);
+    }
+  }
+
+  // Determine whether the values of \a container may be stored in a
+  // NumberArray. Floating-point values are not mixed with integers so that
+  // each value keeps its type. Signed and unsigned integers compare equal
+  // to one another, so they are stored together when their values permit.
+  bool numberType(const json& container, NumberType& type)
+  {
+    bool floating = false;
+    bool integral = false;
+    std::int64_t minimum = 0;
+    std::uint64_t maximum = 0;
+    for (const auto& value : container)
+    {
+      switch (value.type())
+      {
+        case json::value_t::number_float:
+          floating = true;
+          break;
+        case json::value_t::number_integer:
+        {
+          integral = true;
+          std::int64_t number = value.get<std::int64_t>();
+          minimum = std::min(minimum, number);
+          if (number > 0)
+          {
+            maximum = std::max(maximum, static_cast<std::uint64_t>(number));
+          }
+        }
+        break;
+        case json::value_t::number_unsigned:
+          integral = true;
+          maximum = std::max(maximum, value.get<std::uint64_t>());
+          break;
+        default:
+          return false;
+      }
+      if (floating && integral)
+      {
+        return false;
+      }
+    }
+
+    if (floating)
+    {
+      type = Float64;
+    }
+    else if (minimum < 0)
+    {
+      if (maximum > static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()))
+      {
+        return false;
+      }
+      type = (minimum >= std::numeric_limits<std::int32_t>::min() &&
+              maximum <= static_cast<std::uint64_t>(std::numeric_limits<std::int32_t>::max()))
+        ? Int32
+        : Int64;
+    }
+    else
+    {
+      type = maximum <= std::numeric_limits<std::uint32_t>::max() ? UInt32 : UInt64;
+    }
+    return true;
+  }
+
+  void object(const json& j)
+  {
+    bool uuidKeys = !j.empty();
+    std::uint8_t bytes[uuidSize];
+    for (auto it = j.begin(); uuidKeys && it != j.end(); ++it)
+    {
+      uuidKeys = uuidBytes(it.key(), bytes);
+    }
+
+    if (uuidKeys)
+    {
+      this->byte(UuidObject);
+      this->varint(j.size());
+      for (auto it = j.begin(); it != j.end(); ++it)
+      {
+        uuidBytes(it.key(), bytes);
+        this->raw(bytes, uuidSize);
+      }
+      this->sequence(j);
+      return;
+    }
+
+    this->byte(Object);
+    this->varint(j.size());
+    for (auto it = j.begin(); it != j.end(); ++it)
+    {
+      this->key(it.key());
+      this->value(it.value());
+    }
+  }
+
+  void flush()
+  {
+    m_stream.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+    m_buffer.clear();
+  }
+
+  std::ostream& m_stream;
+  std::string m_buffer;
+  std::unordered_map<std::string, std::uint64_t> m_keys;
+};
+
+std::size_t numberWidth(std::uint8_t type)
+{
+  switch (type)
+  {
+    case Float64:
+    case Int64:
+    case UInt64:
+      return 8;
+    case Int32:
+    case UInt32:
+      return 4;
+    default:
+      throw std::runtime_error("Unknown number type in binary SMTK document.");
+  }
+}
+
+class Decoder
+{
+public:
+  // Decode a buffer from its start, appending the keys it defines to \a keys.
+  Decoder(const std::uint8_t* begin, const std::uint8_t* end, std::vector<std::string>& keys)
+    : m_current(begin)
+    , m_end(end)
+    , m_keys(keys)
+    , m_definedKeys(&keys)
+  {
+  }
+
+  // Decode a buffer from any position. The \a keys must include every key
+  // of the document (as they do once it has been skipped in full); key
+  // definitions are passed over.
+  Decoder(const std::uint8_t* begin, const std::uint8_t* end, const std::vector<std::string>& keys)
+    : m_current(begin)
+    , m_end(end)
+    , m_keys(keys)
+  {
+  }
+
+  bool atEnd() const { return m_current == m_end; }
+  const std::uint8_t* position() const { return m_current; }
+
+  json value()
+  {
+    switch (this->byte())
+    {
+      case Null:
+        return json();
+      case False:
+        return json(false);
+      case True:
+        return json(true);
+      case Integer:
+      {
+        std::uint64_t value = this->varint();
+        return json(static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1));
+      }
+      case Unsigned:
+        return json(this->varint());
+      case Float:
+        return json(this->real());
+      case String:
+        return json(this->string());
+      case Uuid:
+        return json(uuidText(this->raw(uuidSize)));
+      case Array:
+      {
+        std::size_t size = this->count(1);
+        json::array_t array;
+        array.reserve(size);
+        for (std::size_t ii = 0; ii < size; ++ii)
+        {
+          array.emplace_back(this->value());
+        }
+        return json(std::move(array));
+      }
+      case Object:
+      {
+        std::size_t size = this->count(2);
+        json::object_t object;
+        for (std::size_t ii = 0; ii < size; ++ii)
+        {
+          std::string key = this->key();
+          object[key] = this->value();
+        }
+        return json(std::move(object));
+      }
+      case NumberArray:
+        return this->numberArray();
+      case UuidArray:
+      {
+        std::size_t size = this->count(uuidSize);
+        json::array_t array;
+        array.reserve(size);
+        for (std::size_t ii = 0; ii < size; ++ii)
+        {
+          array.emplace_back(uuidText(this->raw(uuidSize)));
+        }
+        return json(std::move(array));
+      }
+      case UuidObject:
+      {
+        std::size_t size = this->count(uuidSize);
+        const std::uint8_t* keys = this->raw(size * uuidSize);
+        json values = this->value();
+        if (!values.is_array() || values.size() != size)
+        {
+          throw std::runtime_error("Malformed object in binary SMTK document.");
+        }
+        json::object_t object;
+        for (std::size_t ii = 0; ii < size; ++ii)
+        {
+          object[uuidText(keys + ii * uuidSize)] = std::move(values[ii]);
+        }
+        return json(std::move(object));
+      }
+      default:
+        throw std::runtime_error("Unknown value in binary SMTK document.");
+    }
+  }
+
+  // Advance past a value without decoding it.
+  void skip()
+  {
+    switch (this->byte())
+    {
+      case Null:
+      case False:
+      case True:
+        break;
+      case Integer:
+      case Unsigned:
+        this->varint();
+        break;
+      case Float:
+        this->raw(8);
+        break;
+      case String:
+        this->raw(this->count(1));
+        break;
+      case Uuid:
+        this->raw(uuidSize);
+        break;
+      case Array:
+      {
+        std::size_t size = this->count(1);
+        for (std::size_t ii = 0; ii < size; ++ii)
+        {
+          this->skip();
+        }
+      }
+      break;
+      case Object:
+      {
+        std::size_t size = this->count(2);
+        for (std::size_t ii = 0; ii < size; ++ii)
+        {
+          this->key();
+          this->skip();
+        }
+      }
+      break;
+      case NumberArray:
+      {
+        std::size_t size = this->count(4);
+        this->raw(size * numberWidth(this->byte()));
+      }
+      break;
+      case UuidArray:
+        this->raw(this->count(uuidSize) * uuidSize);
+        break;
+      case UuidObject:
+        this->raw(this->count(uuidSize) * uuidSize);
+        this->skip();
+        break;
+      default:
+        throw std::runtime_error("Unknown value in binary SMTK document.");
+    }
+  }
+
+  const std::uint8_t* raw(std::size_t size)
+  {
+    if (static_cast<std::size_t>(m_end - m_current) < size)
+    {
+      throw std::runtime_error("Truncated binary SMTK document.");
+    }
+    const std::uint8_t* data = m_current;
+    m_current += size;
+    return data;
+  }
+
+  std::uint8_t byte() { return *this->raw(1); }
+
+  std::uint64_t varint()
+  {
+    std::uint64_t value = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7)
+    {
+      std::uint8_t next = this->byte();
+      value |= static_cast<std::uint64_t>(next & 0x7f) << shift;
+      if (!(next & 0x80))
+      {
+        return value;
+      }
+    }
+    throw std::runtime_error("Malformed integer in binary SMTK document.");
+  }
+
+  // Read a count of entries occupying at least \a bytes each, rejecting
+  // counts that could not possibly fit in the remaining data.
+  std::size_t count(std::size_t bytes)
+  {
+    std::uint64_t size = this->varint();
+    if (size > static_cast<std::uint64_t>(m_end - m_current) / bytes)
+    {
+      throw std::runtime_error("Truncated binary SMTK document.");
+    }
+    return static_cast<std::size_t>(size);
+  }
+
+  std::uint64_t fixed(std::size_t bytes)
+  {
+    const std::uint8_t* data = this->raw(bytes);
+    std::uint64_t value = 0;
+    for (std::size_t ii = bytes; ii > 0; --ii)
+    {
+      value = (value << 8) | data[ii - 1];
+    }
+    return value;
+  }
+
+  double real()
+  {
+    std::uint64_t bits = this->fixed(8);
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  std::string string()
+  {
+    std::size_t size = this->count(1);
+    return std::string(reinterpret_cast<const char*>(this->raw(size)), size);
+  }
+
+  std::string key()
+  {
+    std::uint64_t reference = this->varint();
+    if (reference == NewKey)
+    {
+      std::string key = this->string();
+      if (m_definedKeys)
+      {
+        m_definedKeys->push_back(key);
+      }
+      return key;
+    }
+    if (reference == UuidKey)
+    {
+      return uuidText(this->raw(uuidSize));
+    }
+    if (reference - FirstKey >= m_keys.size())
+    {
+      throw std::runtime_error("Unknown key in binary SMTK document.");
+    }
+    return m_keys[reference - FirstKey];
+  }
+
+  json numberArray()
+  {
+    std::size_t size = this->count(4);
+    std::uint8_t type = this->byte();
+    json::array_t array;
+    array.reserve(size);
+    for (std::size_t ii = 0; ii < size; ++ii)
+    {
+      array.emplace_back(this->number(type));
+    }
+    return json(std::move(array));
+  }
+
+  // Decode one entry of a NumberArray whose entries are of the given type.
+  json number(std::uint8_t type)
+  {
+    switch (type)
+    {
+      case Float64:
+        return json(this->real());
+      case Int64:
+        return json(static_cast<std::int64_t>(this->fixed(8)));
+      case UInt64:
+        return json(this->fixed(8));
+      case Int32:
+        return json(static_cast<std::int64_t>(static_cast<std::int32_t>(this->fixed(4))));
+      case UInt32:
+        return json(this->fixed(4));
+      default:
+        throw std::runtime_error("Unknown number type in binary SMTK document.");
+    }
+  }
+
+private:
+  const std::uint8_t* m_current;
+  const std::uint8_t* m_end;
+  const std::vector<std::string>& m_keys;
+  std::vector<std::string>* m_definedKeys{ nullptr };
+};
+
+constexpr std::size_t headerSize = sizeof(magic) + 4;
+
+// Throw unless \a header (of headerSize bytes) starts a supported document.
+void checkHeader(const char* header)
+{
+  if (std::memcmp(header, magic, sizeof(magic)) != 0)
+  {
+    throw std::runtime_error("Not a binary SMTK document.");
+  }
+  std::uint32_t fileVersion = 0;
+  for (std::size_t ii = headerSize; ii > sizeof(magic); --ii)
+  {
+    fileVersion = (fileVersion << 8) | static_cast<std::uint8_t>(header[ii - 1]);
+  }
+  if (fileVersion == 0 || fileVersion > BinaryJSON::version)
+  {
+    throw std::runtime_error(
+      "Unsupported binary SMTK document version " + std::to_string(fileVersion) + ".");
+  }
+}
+} // namespace
+
+constexpr std::uint32_t BinaryJSON::version;
+
+const std::string& BinaryJSON::extension()
+{
+  static const std::string ext = ".smtkb";
+  return ext;
+}
+
+bool BinaryJSON::isBinaryLocation(const std::string& location)
+{
+  const std::string& ext = BinaryJSON::extension();
+  return location.size() > ext.size() &&
+    location.compare(location.size() - ext.size(), ext.size(), ext) == 0;
+}
+
+void BinaryJSON::write(const json& j, std::ostream& stream)
+{
+  Encoder encoder(stream);
+  encoder.header();
+  encoder.value(j);
+}
+
+void BinaryJSON::dump(const json& j, std::ostream& stream, bool binary)
+{
+  if (binary)
+  {
+    BinaryJSON::write(j, stream);
+  }
+  else
+  {
+    stream << j.dump(2);
+  }
+}
+
+BinaryJSON::json BinaryJSON::read(std::istream& stream)
+{
+  char header[headerSize];
+  if (!stream.read(header, sizeof(header)))
+  {
+    throw std::runtime_error("Not a binary SMTK document.");
+  }
+  checkHeader(header);
+
+  std::string data{ std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>() };
+  const auto* begin = reinterpret_cast<const std::uint8_t*>(data.data());
+  std::vector<std::string> keys;
+  Decoder decoder(begin, begin + data.size(), keys);
+  json result = decoder.value();
+  if (!decoder.atEnd())
+  {
+    throw std::runtime_error("Unexpected data after binary SMTK document.");
+  }
+  return result;
+}
+
+bool BinaryJSON::isBinary(std::istream& stream)
+{
+  return stream.peek() == static_cast<std::uint8_t>(magic[0]);
+}
+
+BinaryJSON::json BinaryJSON::parse(std::istream& stream)
+{
+  if (BinaryJSON::isBinary(stream))
+  {
+    return BinaryJSON::read(stream);
+  }
+  return json::parse(stream);
+}
+
+constexpr std::size_t MappedJSON::Value::npos;
+
+std::shared_ptr<MappedJSON> MappedJSON::open(const std::string& filename)
+{
+  std::shared_ptr<MappedJSON> document(new MappedJSON);
+  if (
+    !document->m_file.open(filename) || document->m_file.size() < headerSize ||
+    document->m_file.data()[0] != magic[0])
+  {
+    return nullptr;
+  }
+  checkHeader(document->m_file.data());
+
+  const auto* begin = reinterpret_cast<const std::uint8_t*>(document->m_file.data()) + headerSize;
+  const auto* end = begin + (document->m_file.size() - headerSize);
+  Decoder decoder(begin, end, document->m_keys);
+  decoder.skip();
+  if (!decoder.atEnd())
+  {
+    throw std::runtime_error("Unexpected data after binary SMTK document.");
+  }
+  document->m_root = Value(document.get(), begin);
+  return document;
+}
+
+bool MappedJSON::Value::isObject() const
+{
+  return m_data && m_element == npos && (*m_data == Object || *m_data == UuidObject);
+}
+
+bool MappedJSON::Value::isArray() const
+{
+  return m_data && m_element == npos &&
+    (*m_data == Array || *m_data == NumberArray || *m_data == UuidArray);
+}
+
+std::size_t MappedJSON::Value::size() const
+{
+  if (!this->isObject() && !this->isArray())
+  {
+    return 0;
+  }
+  const auto* end = reinterpret_cast<const std::uint8_t*>(m_document->m_file.data()) +
+    m_document->m_file.size();
+  Decoder decoder(m_data, end, m_document->m_keys);
+  decoder.byte();
+  return static_cast<std::size_t>(decoder.varint());
+}
+
+smtk::common::Visit MappedJSON::Value::visit(const Visitor& visitor) const
+{
+  if (!this->isObject() && !this->isArray())
+  {
+    return smtk::common::Visit::Continue;
+  }
+  const auto* end = reinterpret_cast<const std::uint8_t*>(m_document->m_file.data()) +
+    m_document->m_file.size();
+  Decoder decoder(m_data, end, m_document->m_keys);
+
+  // The keys of a UuidObject precede its values, which are stored as an array.
+  const std::uint8_t* uuids = nullptr;
+  const std::uint8_t* values = m_data;
+  std::uint8_t tag = decoder.byte();
+  std::size_t size = decoder.count(1);
+  if (tag == UuidObject)
+  {
+    uuids = decoder.raw(size * uuidSize);
+    values = decoder.position();
+    tag = decoder.byte();
+    if ((tag != Array && tag != NumberArray && tag != UuidArray) || decoder.count(1) != size)
+    {
+      throw std::runtime_error("Malformed object in binary SMTK document.");
+    }
+  }
+
+  switch (tag)
+  {
+    case Object:
+      for (std::size_t ii = 0; ii < size; ++ii)
+      {
+        std::string key = decoder.key();
+        if (visitor(key, Value(m_document, decoder.position())) == smtk::common::Visit::Halt)
+        {
+          return smtk::common::Visit::Halt;
+        }
+        decoder.skip();
+      }
+      break;
+    case NumberArray:
+    case UuidArray:
+    {
+      // Entries of packed arrays are addressed by their index.
+      for (std::size_t ii = 0; ii < size; ++ii)
+      {
+        std::string key = uuids ? uuidText(uuids + ii * uuidSize) : std::to_string(ii);
+        if (visitor(key, Value(m_document, values, ii)) == smtk::common::Visit::Halt)
+        {
+          return smtk::common::Visit::Halt;
+        }
+      }
+    }
+    break;
+    case Array:
+      for (std::size_t ii = 0; ii < size; ++ii)
+      {
+        std::string key = uuids ? uuidText(uuids + ii * uuidSize) : std::to_string(ii);
+        if (visitor(key, Value(m_document, decoder.position())) == smtk::common::Visit::Halt)
+        {
+          return smtk::common::Visit::Halt;
+        }
+        decoder.skip();
+      }
+      break;
+    default:
+      break;
+  }
+  return smtk::common::Visit::Continue;
+}
+
+MappedJSON::Value MappedJSON::Value::find(const std::string& key) const
+{
+  Value result;
+  this->visit([&key, &result](const std::string& member, const Value& value) {
+    if (member != key)
+    {
+      return smtk::common::Visit::Continue;
+    }
+    result = value;
+    return smtk::common::Visit::Halt;
+  });
+  return this->isObject() ? result : Value();
+}
+
+MappedJSON::json MappedJSON::Value::decode() const
+{
+  if (!m_data)
+  {
+    return json();
+  }
+  const auto* end = reinterpret_cast<const std::uint8_t*>(m_document->m_file.data()) +
+    m_document->m_file.size();
+  Decoder decoder(m_data, end, m_document->m_keys);
+  if (m_element == npos)
+  {
+    return decoder.value();
+  }
+
+  std::uint8_t tag = decoder.byte();
+  decoder.count(1);
+  if (tag == NumberArray)
+  {
+    std::uint8_t type = decoder.byte();
+    decoder.raw(m_element * numberWidth(type));
+    return decoder.number(type);
+  }
+  decoder.raw(m_element * uuidSize);
+  return json(uuidText(decoder.raw(uuidSize)));
+}
+} // namespace common
+} // namespace smtk
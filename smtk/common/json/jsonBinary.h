@@ -0,0 +1,172 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_common_json_jsonBinary_h
+#define smtk_common_json_jsonBinary_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/common/MappedFile.h"
+#include "smtk/common/Visit.h"
+
+#include "nlohmann/json.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace smtk
+{
+namespace common
+{
+
+/**\brief A compact, versioned binary encoding of SMTK's JSON documents.
+  *
+  * Resources are serialized to nlohmann::json by their to_json() methods; this
+  * class writes (and reads) those documents in a binary container rather than
+  * as text. The encoding is lossless: reading a binary document produces a
+  * json value equal to the one written. It is more compact and much faster
+  * to parse than text because
+  *
+  * + UUIDs (whether values or object keys) are stored as 16 raw bytes;
+  * + object keys are stored once and referenced by index thereafter;
+  * + arrays of numbers (e.g., tessellation coordinates and connectivity) are
+  *   stored as contiguous, fixed-width buffers; and
+  * + objects keyed by UUID (e.g., per-component property values) are stored
+  *   column-wise as a buffer of ids followed by an array of values.
+  *
+  * Binary documents start with a magic number and format version, so readers
+  * may accept either encoding by calling parse(). Writers select the binary
+  * encoding for locations with the extension returned by extension().
+  */
+class SMTKCORE_EXPORT BinaryJSON
+{
+public:
+  using json = nlohmann::json;
+
+  /// The version of the binary format written by write().
+  static constexpr std::uint32_t version = 1;
+
+  /// The file extension ("`.smtkb`") that selects the binary encoding.
+  static const std::string& extension();
+
+  /// Return true if \a location should be written in the binary encoding.
+  ///
+  /// Writers of resources (and projects) pass this the location they write
+  /// to, so a resource is written in the binary encoding exactly when its
+  /// location ends with extension(); readers need not check the location,
+  /// since parse() detects the encoding from the document itself.
+  static bool isBinaryLocation(const std::string& location);
+
+  /// Write \a j to \a stream in the binary encoding.
+  static void write(const json& j, std::ostream& stream);
+
+  /// Write \a j to \a stream, either in the binary encoding or as indented text.
+  static void dump(const json& j, std::ostream& stream, bool binary);
+
+  /// Read a binary-encoded document from \a stream. A std::runtime_error is
+  /// thrown if the stream does not hold a valid document of a supported version.
+  static json read(std::istream& stream);
+
+  /// Return true if \a stream (positioned at the start of a document) holds a
+  /// binary-encoded document. The stream's position is not changed.
+  static bool isBinary(std::istream& stream);
+
+  /// Read a document from \a stream in either the binary or text encoding.
+  /// Streams should be opened in binary mode. An exception is thrown if the
+  /// document cannot be parsed.
+  static json parse(std::istream& stream);
+};
+
+/**\brief Random access to a memory-mapped, binary-encoded document.
+  *
+  * Rather than decoding a document in full, a MappedJSON maps the file that
+  * holds it and provides lightweight Value handles to the values within it.
+  * A Value may be queried for its members or elements and decoded into a
+  * json value on demand, so readers can materialize only the parts of a
+  * document they need (and defer the rest until it is requested). Pages of
+  * the file that are never visited are never read from disk.
+  *
+  * Opening a document makes a single pass over it, without decoding it, in
+  * order to validate it and collect the object keys it defines; after that,
+  * values may be visited and decoded in any order from any thread.
+  */
+class SMTKCORE_EXPORT MappedJSON
+{
+public:
+  using json = nlohmann::json;
+
+  /// A handle to a value within a mapped document. Handles are only valid
+  /// while the MappedJSON that produced them exists.
+  class SMTKCORE_EXPORT Value
+  {
+  public:
+    using Visitor = std::function<smtk::common::Visit(const std::string&, const Value&)>;
+
+    Value() = default;
+
+    bool isValid() const { return m_data != nullptr; }
+    /// Return true if the value is an object.
+    bool isObject() const;
+    /// Return true if the value is an array.
+    bool isArray() const;
+    /// Return the number of members or elements of an object or array (or 0).
+    std::size_t size() const;
+
+    /// Visit the members of an object or the elements of an array (whose keys
+    /// are their indices, as strings) in order. Returns Halt if \a visitor
+    /// halted iteration.
+    smtk::common::Visit visit(const Visitor& visitor) const;
+    /// Return the member of an object named \a key (or an invalid value).
+    Value find(const std::string& key) const;
+
+    /// Decode the value (and all it contains).
+    json decode() const;
+
+  private:
+    friend class MappedJSON;
+    Value(const MappedJSON* document, const std::uint8_t* data, std::size_t element = npos)
+      : m_document(document)
+      , m_data(data)
+      , m_element(element)
+    {
+    }
+
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    const MappedJSON* m_document{ nullptr };
+    // The value's tag (or, for an element of a packed array, the array's tag).
+    const std::uint8_t* m_data{ nullptr };
+    std::size_t m_element{ npos };
+  };
+
+  MappedJSON(const MappedJSON&) = delete;
+  MappedJSON& operator=(const MappedJSON&) = delete;
+
+  /// Map the document held by \a filename. A null pointer is returned if the
+  /// file cannot be mapped or holds a text document; a std::runtime_error is
+  /// thrown if it holds a malformed or unsupported binary document.
+  static std::shared_ptr<MappedJSON> open(const std::string& filename);
+
+  /// The document's root value.
+  const Value& root() const { return m_root; }
+
+private:
+  MappedJSON() = default;
+
+  MappedFile m_file;
+  std::vector<std::string> m_keys;
+  Value m_root;
+};
+} // namespace common
+} // namespace smtk
+
+#endif
@@ -0,0 +1,299 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/common/json/jsonStreaming.h"
+
+#include "smtk/common/json/jsonBinary.h"
+
+#include <istream>
+#include <stdexcept>
+
+namespace smtk
+{
+namespace common
+{
+
+/// A SAX handler that builds a document, diverting records to the handlers
+/// of a StreamingJSON instance as they are completed.
+class StreamingJSONParser
+{
+public:
+  using json = nlohmann::json;
+  using Path = StreamingJSON::Path;
+
+  StreamingJSONParser(const StreamingJSON& streaming)
+    : m_streaming(streaming)
+  {
+  }
+
+  json& document() { return m_document; }
+
+  bool null() { return this->add(json()); }
+  bool boolean(bool value) { return this->add(json(value)); }
+  bool number_integer(json::number_integer_t value) { return this->add(json(value)); }
+  bool number_unsigned(json::number_unsigned_t value) { return this->add(json(value)); }
+  bool number_float(json::number_float_t value, const std::string& /*unused*/)
+  {
+    return this->add(json(value));
+  }
+  bool string(std::string& value) { return this->add(json(std::move(value))); }
+
+  // Binary values only arise from binary formats, which are not parsed here.
+  template<typename Binary>
+  bool binary(Binary& /*unused*/)
+  {
+    throw std::runtime_error("Binary values are not supported.");
+  }
+
+  bool start_object(std::size_t /*unused*/) { return this->open(json::object()); }
+  bool start_array(std::size_t /*unused*/) { return this->open(json::array()); }
+  bool end_object() { return this->close(); }
+  bool end_array() { return this->close(); }
+
+  bool key(std::string& value)
+  {
+    m_key = std::move(value);
+    return true;
+  }
+
+  template<typename Exception>
+  bool parse_error(std::size_t /*unused*/, const std::string& /*unused*/, const Exception& error)
+  {
+    throw error;
+  }
+
+private:
+  // A container under construction.
+  struct Frame
+  {
+    json* m_value;
+    // True if records may be handled within this container.
+    bool m_prefix;
+    // The number of values (including handled records) in this container.
+    std::size_t m_size;
+  };
+
+  // Add a scalar value to the container under construction.
+  bool add(json&& value)
+  {
+    if (const StreamingJSON::Handler* handler = this->handler())
+    {
+      (*handler)(m_path, value);
+      m_path.pop_back();
+    }
+    else
+    {
+      this->insert(std::move(value));
+    }
+    this->count();
+    return true;
+  }
+
+  // Start a container, either within the container under construction or as
+  // a separate record when it is to be handed off.
+  bool open(json&& value)
+  {
+    json* container;
+    if (const StreamingJSON::Handler* handler = this->handler())
+    {
+      m_record = std::move(value);
+      m_recordHandler = handler;
+      m_recordDepth = m_stack.size() + 1;
+      container = &m_record;
+    }
+    else
+    {
+      if (!m_stack.empty())
+      {
+        m_path.push_back(this->segment());
+      }
+      container = this->insert(std::move(value));
+    }
+    this->count();
+    bool prefix = !m_recordHandler && m_streaming.isPrefix(m_path);
+    m_stack.push_back(Frame{ container, prefix, 0 });
+    return true;
+  }
+
+  bool close()
+  {
+    if (m_stack.size() == m_recordDepth)
+    {
+      (*m_recordHandler)(m_path, m_record);
+      m_record = json();
+      m_recordHandler = nullptr;
+      m_recordDepth = 0;
+    }
+    m_stack.pop_back();
+    if (!m_stack.empty())
+    {
+      m_path.pop_back();
+    }
+    return true;
+  }
+
+  // Count a value added to (or handed off from) the container under construction.
+  void count()
+  {
+    if (!m_stack.empty())
+    {
+      ++m_stack.back().m_size;
+    }
+  }
+
+  // Return the key or index at which the next value will be inserted into
+  // the container under construction.
+  std::string segment() const
+  {
+    const Frame& parent = m_stack.back();
+    return parent.m_value->is_object() ? m_key : std::to_string(parent.m_size);
+  }
+
+  // If the next value is a record to be handed off, push its path segment
+  // and return its handler.
+  const StreamingJSON::Handler* handler()
+  {
+    if (m_stack.empty() || !m_stack.back().m_prefix)
+    {
+      return nullptr;
+    }
+    m_path.push_back(this->segment());
+    const StreamingJSON::Handler* result = m_streaming.handler(m_path);
+    if (!result)
+    {
+      m_path.pop_back();
+    }
+    return result;
+  }
+
+  json* insert(json&& value)
+  {
+    if (m_stack.empty())
+    {
+      m_document = std::move(value);
+      return &m_document;
+    }
+    json& parent = *m_stack.back().m_value;
+    if (parent.is_object())
+    {
+      json& slot = parent[m_key];
+      slot = std::move(value);
+      return &slot;
+    }
+    parent.push_back(std::move(value));
+    return &parent.back();
+  }
+
+  const StreamingJSON& m_streaming;
+  json m_document;
+  std::vector<Frame> m_stack;
+  // The path of the innermost container under construction.
+  Path m_path;
+  std::string m_key;
+
+  // The record being built for a handler.
+  json m_record;
+  const StreamingJSON::Handler* m_recordHandler{ nullptr };
+  std::size_t m_recordDepth{ 0 };
+};
+
+void StreamingJSON::addHandler(const Path& pattern, Handler handler)
+{
+  m_handlers.emplace_back(pattern, std::move(handler));
+}
+
+StreamingJSON::json StreamingJSON::parse(std::istream& stream) const
+{
+  if (BinaryJSON::isBinary(stream))
+  {
+    json document = BinaryJSON::read(stream);
+    Path path;
+    this->dispatch(document, path);
+    return document;
+  }
+
+  StreamingJSONParser parser(*this);
+  json::sax_parse(stream, &parser);
+  return std::move(parser.document());
+}
+
+namespace
+{
+bool matches(const StreamingJSON::Path& pattern, const StreamingJSON::Path& path)
+{
+  for (std::size_t ii = 0; ii < path.size(); ++ii)
+  {
+    if (pattern[ii] != "*" && pattern[ii] != path[ii])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+const StreamingJSON::Handler* StreamingJSON::handler(const Path& path) const
+{
+  for (const auto& entry : m_handlers)
+  {
+    if (entry.first.size() == path.size() && matches(entry.first, path))
+    {
+      return &entry.second;
+    }
+  }
+  return nullptr;
+}
+
+bool StreamingJSON::isPrefix(const Path& path) const
+{
+  for (const auto& entry : m_handlers)
+  {
+    if (entry.first.size() > path.size() && matches(entry.first, path))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Hand off the records within a fully-parsed document, removing them from it.
+void StreamingJSON::dispatch(json& value, Path& path) const
+{
+  if (!value.is_structured() || !this->isPrefix(path))
+  {
+    return;
+  }
+
+  json remainder = value.is_object() ? json::object() : json::array();
+  std::size_t index = 0;
+  for (auto it = value.begin(); it != value.end(); ++it, ++index)
+  {
+    path.push_back(value.is_object() ? it.key() : std::to_string(index));
+    if (const Handler* recordHandler = this->handler(path))
+    {
+      (*recordHandler)(path, *it);
+    }
+    else
+    {
+      this->dispatch(*it, path);
+      if (value.is_object())
+      {
+        remainder[it.key()] = std::move(*it);
+      }
+      else
+      {
+        remainder.push_back(std::move(*it));
+      }
+    }
+    path.pop_back();
+  }
+  value = std::move(remainder);
+}
+} // namespace common
+} // namespace smtk
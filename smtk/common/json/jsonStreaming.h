@@ -0,0 +1,78 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_common_json_jsonStreaming_h
+#define smtk_common_json_jsonStreaming_h
+
+#include "smtk/CoreExports.h"
+
+#include "nlohmann/json.hpp"
+
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace smtk
+{
+namespace common
+{
+
+/**\brief Parse JSON documents without materializing their largest parts.
+  *
+  * Resource documents consist of a few top-level entries and large
+  * collections of records (entities, attributes, etc.). StreamingJSON parses
+  * a document with nlohmann's SAX interface and hands each record whose path
+  * matches a registered pattern to a handler as soon as the record has been
+  * parsed; the record is then discarded rather than added to the document.
+  * This bounds the memory used to parse a document by the size of its
+  * largest record (plus whatever the handlers retain) and lets records be
+  * transcribed into a resource while the rest of the document is parsed.
+  *
+  * A path is the sequence of object keys (or array indices, as strings)
+  * leading from the document's root to a value; in patterns, "*" matches any
+  * key or index. For example, {"models", "*", "*"} matches each entity record
+  * of a model resource.
+  *
+  * Documents in the binary encoding of smtk::common::BinaryJSON are also
+  * accepted; they are decoded in full before records are handed off.
+  */
+class SMTKCORE_EXPORT StreamingJSON
+{
+public:
+  using json = nlohmann::json;
+  using Path = std::vector<std::string>;
+  using Handler = std::function<void(const Path& path, json& record)>;
+
+  /// Hand each record matching \a pattern to \a handler instead of adding it
+  /// to the parsed document. Records within a handled record are not handed
+  /// to other handlers.
+  void addHandler(const Path& pattern, Handler handler);
+
+  /// Parse the document held by \a stream, returning it without the records
+  /// passed to handlers. Exceptions thrown by the parser or by handlers
+  /// propagate to the caller.
+  json parse(std::istream& stream) const;
+
+private:
+  friend class StreamingJSONParser;
+
+  // Return the handler for a record at \a path (or null if there is none).
+  const Handler* handler(const Path& path) const;
+  // Return true if a record may be handled at a path starting with \a path.
+  bool isPrefix(const Path& path) const;
+  void dispatch(json& value, Path& path) const;
+
+  std::vector<std::pair<Path, Handler>> m_handlers;
+};
+} // namespace common
+} // namespace smtk
+
+#endif
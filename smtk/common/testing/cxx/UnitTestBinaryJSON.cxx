@@ -0,0 +1,359 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/common/UUID.h"
+#include "smtk/common/json/jsonBinary.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/DoubleItem.h"
+#include "smtk/attribute/DoubleItemDefinition.h"
+#include "smtk/attribute/Resource.h"
+#include "smtk/attribute/StringItem.h"
+#include "smtk/attribute/StringItemDefinition.h"
+#include "smtk/attribute/json/jsonResource.h"
+
+#include "smtk/model/Edge.h"
+#include "smtk/model/Face.h"
+#include "smtk/model/Group.h"
+#include "smtk/model/Model.h"
+#include "smtk/model/Resource.h"
+#include "smtk/model/Tessellation.h"
+#include "smtk/model/Vertex.h"
+#include "smtk/model/json/jsonResource.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using smtk::common::BinaryJSON;
+using smtk::common::MappedJSON;
+using json = nlohmann::json;
+
+namespace
+{
+std::string writeRoot = SMTK_SCRATCH_DIR;
+
+// Construct a document resembling a serialized resource.
+json sampleDocument()
+{
+  std::string id = smtk::common::UUID::random().toString();
+  json j = { { "type", "smtk::model::Resource" },
+             { "id", id },
+             { "version", "3.0" },
+             { "clean", true },
+             { "mode", nullptr },
+             { "name", "caf\xc3\xa9 \"quoted\"" } };
+
+  json components = json::object();
+  json ids = json::array();
+  json properties = json::object();
+  for (int i = 0; i < 8; ++i)
+  {
+    std::string componentId = smtk::common::UUID::random().toString();
+    components[componentId] = { { "e", i }, { "d", 3 - i }, { "r", { id, componentId } } };
+    ids.push_back(componentId);
+    properties[componentId] = 0.5 * i;
+  }
+  j["components"] = components;
+  j["ids"] = ids;
+  j["properties"] = { { "double", { { "weight", properties } } } };
+
+  j["tessellation"] = { { "points", { 0.0, 0.5, -1.25, 1e300, -0.0 } },
+                        { "conn", { 3, 0, 1, 2 } },
+                        { "offsets", { -1, 70000, std::numeric_limits<std::int32_t>::min() } },
+                        { "large", { std::numeric_limits<std::int64_t>::min(), 1 } },
+                        { "huge", { std::numeric_limits<std::uint64_t>::max(), 1u } },
+                        { "mixed", { 1, 2.5, "three", nullptr, false } },
+                        { "empty", json::array() },
+                        { "none", json::object() } };
+
+  // Strings that merely resemble UUIDs must be preserved verbatim.
+  j["notIds"] = { "01234567-89AB-CDEF-0123-456789ABCDEF",
+                  "0123456789abcdef0123456789abcdef0123",
+                  "01234567-89ab-cdef-0123-456789abcdeg" };
+  return j;
+}
+
+void testRoundTrip()
+{
+  json j = sampleDocument();
+
+  std::stringstream binary;
+  BinaryJSON::write(j, binary);
+  std::string encoded = binary.str();
+  smtkTest(BinaryJSON::isBinary(binary), "Binary document not detected.");
+  smtkTest(BinaryJSON::read(binary) == j, "Binary round trip altered the document.");
+
+  std::stringstream text(j.dump(2));
+  smtkTest(!BinaryJSON::isBinary(text), "Text document detected as binary.");
+  smtkTest(BinaryJSON::parse(text) == j, "Text document not parsed.");
+
+  // A document read from its text encoding encodes to the same binary
+  // document and vice versa.
+  text.clear();
+  text.seekg(0);
+  std::stringstream reencoded;
+  BinaryJSON::dump(BinaryJSON::parse(text), reencoded, true);
+  std::stringstream decoded(reencoded.str());
+  smtkTest(
+    BinaryJSON::parse(decoded).dump(2) == j.dump(2), "Binary and text encodings disagree.");
+
+  smtkTest(
+    encoded.size() < 2 * j.dump().size() / 3,
+    "Binary encoding (" << encoded.size() << " bytes) not compact (text is " << j.dump().size()
+                        << " bytes).");
+}
+
+void testScalars()
+{
+  for (json j : { json(), json(true), json(-3), json(4u), json(1.5), json("x"), json::array() })
+  {
+    std::stringstream stream;
+    BinaryJSON::write(j, stream);
+    smtkTest(BinaryJSON::read(stream) == j, "Scalar " << j.dump() << " not round tripped.");
+  }
+}
+
+bool throws(const std::string& data)
+{
+  std::stringstream stream(data);
+  try
+  {
+    BinaryJSON::read(stream);
+  }
+  catch (std::runtime_error&)
+  {
+    return true;
+  }
+  return false;
+}
+
+void testMalformed()
+{
+  std::stringstream stream;
+  BinaryJSON::write(sampleDocument(), stream);
+  std::string data = stream.str();
+
+  smtkTest(throws(data.substr(0, data.size() / 2)), "Truncated document accepted.");
+  smtkTest(throws(data + '\0'), "Trailing data accepted.");
+  smtkTest(throws("{}"), "Text document accepted as binary.");
+
+  std::string future = data;
+  future[8] = static_cast<char>(BinaryJSON::version + 1);
+  smtkTest(throws(future), "Unsupported version accepted.");
+}
+
+void testLocations()
+{
+  smtkTest(BinaryJSON::isBinaryLocation("/tmp/model.smtkb"), "Binary location not detected.");
+  smtkTest(!BinaryJSON::isBinaryLocation("/tmp/model.smtk"), "Text location detected as binary.");
+  smtkTest(!BinaryJSON::isBinaryLocation(".smtkb"), "Bare extension detected as binary.");
+}
+
+void testMapped()
+{
+  json j = sampleDocument();
+  std::string binaryFile = writeRoot + "/" + smtk::common::UUID::random().toString() + ".smtkb";
+  std::string textFile = writeRoot + "/" + smtk::common::UUID::random().toString() + ".smtk";
+  {
+    std::ofstream binary(binaryFile, std::ios::out | std::ios::binary);
+    BinaryJSON::write(j, binary);
+    std::ofstream text(textFile, std::ios::out | std::ios::binary);
+    text << j.dump(2);
+  }
+
+  smtkTest(!MappedJSON::open(textFile), "Text document mapped.");
+  smtkTest(!MappedJSON::open(writeRoot + "/missing.smtkb"), "Missing document mapped.");
+
+  auto document = MappedJSON::open(binaryFile);
+  smtkTest(!!document, "Binary document not mapped.");
+  const MappedJSON::Value& root = document->root();
+  smtkTest(root.isObject() && root.size() == j.size(), "Root object not found.");
+
+  // Values decoded out of order match the corresponding parts of the document.
+  smtkTest(root.find("tessellation").decode() == j["tessellation"], "Tessellation altered.");
+  smtkTest(root.find("id").decode() == j["id"], "Id altered.");
+  smtkTest(!root.find("missing").isValid(), "Missing member found.");
+  smtkTest(root.decode() == j, "Mapped document altered.");
+
+  // Members of UUID-keyed objects and entries of packed arrays are addressable.
+  std::size_t visited = 0;
+  root.find("components").visit([&](const std::string& key, const MappedJSON::Value& value) {
+    smtkTest(value.decode() == j["components"][key], "Component " << key << " altered.");
+    ++visited;
+    return smtk::common::Visit::Continue;
+  });
+  smtkTest(visited == j["components"].size(), "Components not visited.");
+
+  const json& weights = j["properties"]["double"]["weight"];
+  MappedJSON::Value weight = root.find("properties").find("double").find("weight");
+  smtkTest(weight.isObject() && weight.size() == weights.size(), "Weights not found.");
+  weight.visit([&](const std::string& key, const MappedJSON::Value& value) {
+    smtkTest(value.decode() == weights[key], "Weight " << key << " altered.");
+    return smtk::common::Visit::Continue;
+  });
+
+  MappedJSON::Value points = root.find("tessellation").find("points");
+  smtkTest(points.isArray() && points.size() == 5, "Packed array not found.");
+  points.visit([&](const std::string& key, const MappedJSON::Value& value) {
+    smtkTest(!value.isArray(), "Packed entry reported as an array.");
+    smtkTest(value.decode() == j["tessellation"]["points"][std::stoi(key)], "Point altered.");
+    return smtk::common::Visit::Continue;
+  });
+
+  visited = 0;
+  root.find("ids").visit([&](const std::string& key, const MappedJSON::Value& value) {
+    smtkTest(value.decode() == j["ids"][std::stoi(key)], "Id " << key << " altered.");
+    return ++visited == 2 ? smtk::common::Visit::Halt : smtk::common::Visit::Continue;
+  });
+  smtkTest(visited == 2, "Visitation not halted.");
+
+  document.reset();
+  std::remove(binaryFile.c_str());
+  std::remove(textFile.c_str());
+}
+
+// Write \a j to a new file in the binary encoding and return its name.
+std::string writeBinary(const json& j)
+{
+  std::string filename = writeRoot + "/" + smtk::common::UUID::random().toString() + ".smtkb";
+  smtkTest(BinaryJSON::isBinaryLocation(filename), "Binary location not detected.");
+  std::ofstream file(filename, std::ios::out | std::ios::binary);
+  BinaryJSON::dump(j, file, true);
+  return filename;
+}
+
+void testAttributeResource()
+{
+  auto resource = smtk::attribute::Resource::create();
+  resource->setName("materials");
+  auto definition = resource->createDefinition("material");
+  definition->addItemDefinition<smtk::attribute::DoubleItemDefinition>("density");
+  definition->addItemDefinition<smtk::attribute::StringItemDefinition>("label");
+  for (int i = 0; i < 4; ++i)
+  {
+    auto attribute = resource->createAttribute("material-" + std::to_string(i), definition);
+    attribute->findDouble("density")->setValue(0.25 * i);
+    attribute->findString("label")->setValue("caf\xc3\xa9 " + std::to_string(i));
+  }
+
+  json j = resource;
+  std::string filename = writeBinary(j);
+
+  // The resource read from its binary encoding matches the one read from its
+  // text encoding (i.e., a plain JSON round trip).
+  auto fromBinary = smtk::attribute::Resource::create();
+  {
+    std::ifstream file(filename, std::ios::in | std::ios::binary);
+    smtkTest(smtk::attribute::from_json(file, fromBinary), "Binary attributes not read.");
+  }
+  auto fromText = smtk::attribute::Resource::create();
+  {
+    std::stringstream text(j.dump(2));
+    smtkTest(smtk::attribute::from_json(text, fromText), "Text attributes not read.");
+  }
+
+  json jBinary = fromBinary;
+  json jText = fromText;
+  smtkTest(jBinary == jText, "Binary and text attribute resources differ.");
+  smtkTest(jBinary == j, "Attribute resource altered by the binary round trip.");
+  auto attribute = fromBinary->findAttribute("material-3");
+  smtkTest(
+    attribute && attribute->findDouble("density")->value() == 0.75 &&
+      attribute->findString("label")->value() == "caf\xc3\xa9 3",
+    "Attribute values altered.");
+
+  std::remove(filename.c_str());
+}
+
+void testModelResource()
+{
+  auto resource = smtk::model::Resource::create();
+  smtk::model::Model model = resource->addModel(2, 3, "square");
+  std::vector<smtk::model::Vertex> vertices;
+  for (int i = 0; i < 4; ++i)
+  {
+    vertices.push_back(resource->addVertex());
+  }
+  smtk::model::Face face = resource->addFace();
+  for (int i = 0; i < 4; ++i)
+  {
+    smtk::model::Edge edge = resource->addEdge();
+    edge.addRawRelation(vertices[i]).addRawRelation(vertices[(i + 1) % 4]);
+    face.addRawRelation(edge);
+    edge.setIntegerProperty("index", i);
+  }
+  model.addCell(face);
+  smtk::model::Group group = resource->addGroup(0, "corners");
+  group.addEntity(vertices[0]).addEntity(vertices[2]);
+  model.addGroup(group);
+  face.setStringProperty("color", "red");
+  face.setFloatProperty("area", 1.0);
+
+  smtk::model::Tessellation tess;
+  tess.addCoords(0., 0., 0.).addCoords(1., 0., 0.).addCoords(1., 1., 0.).addCoords(0., 1., 0.);
+  tess.addTriangle(0, 1, 2).addTriangle(0, 2, 3);
+  face.setTessellationAndBoundingBox(&tess);
+
+  json j = resource;
+  std::string filename = writeBinary(j);
+
+  // Read the binary document both by streaming it and by mapping it lazily;
+  // each should match the resource read from the document's text encoding.
+  smtk::model::ResourcePtr fromBinary = smtk::model::Resource::create();
+  {
+    std::ifstream file(filename, std::ios::in | std::ios::binary);
+    smtkTest(smtk::model::from_json(file, fromBinary), "Binary model not read.");
+  }
+  smtk::model::ResourcePtr fromMapped = smtk::model::Resource::create();
+  smtkTest(
+    smtk::model::from_json(MappedJSON::open(filename), fromMapped), "Mapped model not read.");
+  fromMapped->materializeTopology();
+  smtk::model::ResourcePtr fromText = smtk::model::Resource::create();
+  {
+    std::stringstream text(j.dump(2));
+    smtkTest(smtk::model::from_json(text, fromText), "Text model not read.");
+  }
+
+  json jText = fromText;
+  json jBinary = fromBinary;
+  json jMapped = fromMapped;
+  smtkTest(jBinary == jText, "Binary and text model resources differ.");
+  smtkTest(jMapped == jText, "Mapped and text model resources differ.");
+  smtkTest(jBinary == j, "Model resource altered by the binary round trip.");
+  smtkTest(
+    smtk::model::Face(fromBinary, face.entity()).stringProperty("color")[0] == "red",
+    "Model property altered.");
+  smtkTest(
+    smtk::model::Model(fromMapped, model.entity()).cells().size() == 1,
+    "Mapped model lost its cells.");
+
+  std::remove(filename.c_str());
+}
+} // namespace
+
+int UnitTestBinaryJSON(int /*unused*/, char** const /*unused*/)
+{
+  testRoundTrip();
+  testScalars();
+  testMalformed();
+  testLocations();
+  testMapped();
+  testAttributeResource();
+  testModelResource();
+  return 0;
+}
@@ -0,0 +1,147 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/common/Executor.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <atomic>
+#include <chrono>
+#include <numeric>
+
+namespace
+{
+void testSubmit()
+{
+  smtk::common::Executor executor(4);
+
+  std::future<int> result = executor.submit([] { return 1; });
+  smtkTest(result.get() == 1, "Returned result doesn't match input");
+
+  std::atomic<int> counter{ 0 };
+  std::vector<std::future<void>> futures;
+  for (int i = 0; i < 100; ++i)
+  {
+    futures.push_back(executor.submit(
+      [&counter] { ++counter; },
+      i % 2 ? smtk::common::Executor::Priority::Batch
+            : smtk::common::Executor::Priority::Interactive));
+  }
+  executor.whenAll(futures);
+  smtkTest(counter == 100, "Expected 100 tasks to run, but " << counter << " ran");
+
+  std::future<void> failure = executor.submit([] { throw std::runtime_error("failure"); });
+  bool caught = false;
+  try
+  {
+    failure.get();
+  }
+  catch (const std::runtime_error&)
+  {
+    caught = true;
+  }
+  smtkTest(caught, "Exception thrown by task was not forwarded to its future");
+}
+
+void testPriority()
+{
+  // With a single worker blocked by a long batch task, queued interactive
+  // tasks must run before queued batch tasks.
+  smtk::common::Executor executor(1);
+  std::promise<void> release;
+  std::shared_future<void> gate = release.get_future().share();
+  executor.submit([gate] { gate.wait(); }, smtk::common::Executor::Priority::Batch);
+
+  std::mutex mutex;
+  std::vector<int> order;
+  auto record = [&mutex, &order](int value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    order.push_back(value);
+  };
+  std::vector<std::future<void>> futures;
+  futures.push_back(
+    executor.submit([&record] { record(2); }, smtk::common::Executor::Priority::Batch));
+  futures.push_back(
+    executor.submit([&record] { record(1); }, smtk::common::Executor::Priority::Interactive));
+  release.set_value();
+  executor.whenAll(futures);
+
+  smtkTest(order.size() == 2 && order[0] == 1 && order[1] == 2, "Priority lanes were not honored");
+}
+
+void testCancellation()
+{
+  smtk::common::Executor executor(1);
+  std::promise<void> release;
+  std::shared_future<void> gate = release.get_future().share();
+  executor.submit([gate] { gate.wait(); });
+
+  smtk::common::CancellationToken token;
+  bool ran = false;
+  std::future<void> canceled = executor.submit(
+    [&ran] { ran = true; }, smtk::common::Executor::Priority::Interactive, token);
+  token.cancel();
+  release.set_value();
+
+  bool caught = false;
+  try
+  {
+    canceled.get();
+  }
+  catch (const smtk::common::TaskCanceled&)
+  {
+    caught = true;
+  }
+  smtkTest(caught && !ran, "Canceled task should not run");
+}
+
+void testParallelFor()
+{
+  smtk::common::Executor executor(4);
+  std::vector<int> values(10007, 0);
+  executor.parallelFor(0, values.size(), 64, [&values](std::size_t first, std::size_t last) {
+    for (std::size_t i = first; i < last; ++i)
+    {
+      values[i] += static_cast<int>(i % 3);
+    }
+  });
+  long sum = std::accumulate(values.begin(), values.end(), 0L);
+  long expected = 0;
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    expected += static_cast<long>(i % 3);
+  }
+  smtkTest(sum == expected, "parallelFor did not visit each index exactly once");
+
+  // Nested use from within a task must not deadlock.
+  std::future<int> nested = executor.submit([&executor] {
+    std::atomic<int> count{ 0 };
+    executor.parallelFor(0, 1000, 10, [&count](std::size_t first, std::size_t last) {
+      count += static_cast<int>(last - first);
+    });
+    std::vector<std::future<int>> inner;
+    for (int i = 0; i < 8; ++i)
+    {
+      inner.push_back(executor.submit([i] { return i; }));
+    }
+    std::vector<int> results = executor.whenAll(inner);
+    return count + std::accumulate(results.begin(), results.end(), 0);
+  });
+  smtkTest(nested.get() == 1028, "Nested parallelFor/whenAll returned the wrong result");
+}
+} // namespace
+
+int UnitTestExecutor(int /*unused*/, char** const /*unused*/)
+{
+  testSubmit();
+  testPriority();
+  testCancellation();
+  testParallelFor();
+  return 0;
+}
@@ -11,6 +11,10 @@
 
 #include "smtk/common/testing/cxx/helpers.h"
 
+#include <atomic>
+#include <memory>
+#include <thread>
+
 namespace
 {
 class Observed
@@ -59,9 +63,124 @@ void TestPriority()
   return;
 }
 
+void TestReentrantModification()
+{
+  typedef smtk::common::Observers<std::function<int(int)>> Observers;
+  Observers observers;
+
+  int calls = 0;
+  Observers::Key firstKey;
+  Observers::Key secondKey;
+  Observers::Key insertedKey;
+
+  // The first observer erases itself and the second observer, and inserts a
+  // new observer; none of these changes affect the current notification
+  // except that the second observer is no longer called.
+  firstKey = observers.insert(
+    [&](int value) {
+      ++calls;
+      observers.erase(firstKey);
+      observers.erase(secondKey);
+      insertedKey = observers.insert([&](int inserted) { return inserted * 4; }, -3, false);
+      return value;
+    },
+    -1,
+    false);
+  secondKey = observers.insert([&](int value) { return value * 2; }, -2, false);
+
+  smtkTest(observers(1) == 1, "Erased observer contributed to the result.");
+  smtkTest(calls == 1 && observers.size() == 1, "Unexpected observers after modification.");
+  smtkTest(observers(1) == 4, "Inserted observer was not called.");
+}
+
+void TestTiming()
+{
+  typedef smtk::common::Observers<std::function<void()>> Observers;
+  Observers observers;
+
+  auto fast = observers.insert([]() {}, 1, false, "fast");
+  auto slow = observers.insert(
+    []() { std::this_thread::sleep_for(std::chrono::milliseconds(5)); }, 0, false, "slow");
+
+  observers();
+  smtkTest(observers.timings()[0].calls == 0, "Observers timed while timing was disabled.");
+
+  observers.setTimingEnabled(true);
+  observers();
+  observers();
+  auto timings = observers.timings();
+  smtkTest(timings.size() == 2, "Expected a timing for each observer.");
+  smtkTest(
+    timings[0].description == "fast" && timings[1].description == "slow",
+    "Timings are not in call order.");
+  smtkTest(timings[1].calls == 2, "Unexpected number of timed calls.");
+  smtkTest(timings[1].duration >= std::chrono::milliseconds(10), "Unexpected observer duration.");
+
+  observers.resetTimings();
+  smtkTest(observers.timings()[1].calls == 0, "Timings were not reset.");
+}
+
+class Subject : public std::enable_shared_from_this<Subject>
+{
+public:
+  Subject() = default;
+  Subject(const Subject&) = delete;
+  Subject& operator=(const Subject&) = delete;
+
+  int m_value{ 0 };
+};
+
+void TestAsynchronousObservers()
+{
+  typedef smtk::common::Observers<std::function<int(const Subject&, int)>> Observers;
+  Observers observers;
+
+  std::atomic<int> sum(0);
+  std::atomic<bool> offThread(false);
+  const std::thread::id caller = std::this_thread::get_id();
+  Observers::Key synchronous;
+  Observers::Key asynchronous;
+  {
+    smtk::common::Executor executor(2);
+    synchronous = observers.insert(
+      [](const Subject& subject, int) { return subject.m_value; }, 0, false, "synchronous");
+    asynchronous = observers.insert(
+      [&](const Subject& subject, int value) {
+        sum += subject.m_value + value;
+        offThread = offThread || std::this_thread::get_id() != caller;
+        return 1 << 8;
+      },
+      0,
+      false,
+      "asynchronous",
+      &executor);
+
+    auto subject = std::make_shared<Subject>();
+    subject->m_value = 1;
+    smtkTest(observers(*subject, 2) == 1, "Asynchronous observer contributed to the result.");
+    subject.reset();
+
+    // Objects that are not owned by a shared pointer cannot be held, so the
+    // observer is called synchronously.
+    Subject local;
+    local.m_value = 10;
+    smtkTest(
+      observers(local, 20) == ((1 << 8) | 10) && sum >= 30,
+      "Observer with unheld arguments was not called synchronously.");
+
+    // Destroying the executor waits for the asynchronous observers. (Had
+    // their keys been destroyed first, pending calls would be skipped.)
+  }
+  smtkTest(sum == 33, "Asynchronous observer was not called.");
+  smtkTest(offThread, "Asynchronous observer was called synchronously.");
+}
+
 int UnitTestObservers(int /*unused*/, char** const /*unused*/)
 {
   TestPriority();
+  TestReentrantModification();
+  TestTiming();
+  TestAsynchronousObservers();
 
   return 0;
 }
@@ -0,0 +1,123 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/common/json/jsonBinary.h"
+#include "smtk/common/json/jsonStreaming.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <map>
+#include <sstream>
+#include <string>
+
+using smtk::common::BinaryJSON;
+using smtk::common::StreamingJSON;
+using json = nlohmann::json;
+
+namespace
+{
+// Construct a document resembling a serialized model resource.
+json sampleDocument()
+{
+  json m0 = { { "e0", { { "e", 1 }, { "r", { "e1" } } } }, { "e1", { { "e", 2 } } } };
+  json m1 = { { "e2", { { "e", 3 }, { "s", { { "name", { "x" } } } } } } };
+  json j = { { "id", "resource" },
+             { "models", { { "m0", m0 }, { "m1", m1 } } },
+             { "list", { 1, { { "a", 2 } }, { 3, 4 }, "five" } },
+             { "properties", { { "double", json::object() } } } };
+  return j;
+}
+
+// Parse \a stream, recording each entity record by its path.
+json parseEntities(std::istream& stream, std::map<std::string, json>& records)
+{
+  StreamingJSON streaming;
+  streaming.addHandler(
+    { "models", "*", "*" }, [&records](const StreamingJSON::Path& path, json& record) {
+      smtkTest(path.size() == 3 && path[0] == "models", "Unexpected record path.");
+      records[path[1] + "/" + path[2]] = std::move(record);
+    });
+  return streaming.parse(stream);
+}
+
+void testRecords(bool binary)
+{
+  json j = sampleDocument();
+  std::stringstream stream;
+  BinaryJSON::dump(j, stream, binary);
+
+  std::map<std::string, json> records;
+  json remainder = parseEntities(stream, records);
+
+  smtkTest(records.size() == 3, "Expected 3 records, got " << records.size() << ".");
+  smtkTest(records["m0/e0"] == j["models"]["m0"]["e0"], "Record m0/e0 altered.");
+  smtkTest(records["m0/e1"] == j["models"]["m0"]["e1"], "Record m0/e1 altered.");
+  smtkTest(records["m1/e2"] == j["models"]["m1"]["e2"], "Record m1/e2 altered.");
+
+  json expected = j;
+  expected["models"]["m0"] = json::object();
+  expected["models"]["m1"] = json::object();
+  smtkTest(
+    remainder == expected,
+    "Unexpected remainder " << remainder.dump() << " (binary: " << binary << ").");
+}
+
+void testIndices()
+{
+  json j = sampleDocument();
+  std::stringstream stream(j.dump());
+
+  // Scalars, objects and arrays at the matching indices are all handed off.
+  std::map<std::string, json> records;
+  StreamingJSON streaming;
+  streaming.addHandler({ "list", "*" }, [&records](const StreamingJSON::Path& path, json& r) {
+    records[path[1]] = r;
+  });
+  json remainder = streaming.parse(stream);
+
+  smtkTest(records.size() == 4, "Expected 4 list records, got " << records.size() << ".");
+  for (std::size_t ii = 0; ii < 4; ++ii)
+  {
+    smtkTest(
+      records[std::to_string(ii)] == j["list"][ii],
+      "List record " << ii << " is " << records[std::to_string(ii)].dump() << ".");
+  }
+  smtkTest(remainder["list"].empty(), "Handled list records retained.");
+  smtkTest(remainder["models"] == j["models"], "Unhandled records altered.");
+}
+
+void testUnhandled()
+{
+  json j = sampleDocument();
+  std::stringstream stream(j.dump(2));
+  StreamingJSON streaming;
+  smtkTest(streaming.parse(stream) == j, "Document without handlers altered.");
+
+  std::stringstream malformed("{\"models\": {\"m0\": ");
+  bool threw = false;
+  try
+  {
+    streaming.parse(malformed);
+  }
+  catch (std::exception&)
+  {
+    threw = true;
+  }
+  smtkTest(threw, "Malformed document accepted.");
+}
+} // namespace
+
+int UnitTestStreamingJSON(int /*unused*/, char** const /*unused*/)
+{
+  testRecords(false);
+  testRecords(true);
+  testIndices();
+  testUnhandled();
+  return 0;
+}
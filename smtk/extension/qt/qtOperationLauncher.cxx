@@ -10,6 +10,51 @@
 
 #include "smtk/extension/qt/qtOperationLauncher.h"
 
+namespace
+{
+// Forward an operation's progress to a result handler while the operation
+// runs. Any progress observer the operation already had is still called and
+// is restored afterwards. Progress is posted to \a context's thread, where the
+// handler is locked, so the handler (a QObject) is never released by the
+// thread running the operation.
+class ForwardProgress
+{
+public:
+  ForwardProgress(
+    const smtk::operation::Operation::Ptr& operation,
+    QObject* context,
+    const std::weak_ptr<smtk::extension::ResultHandler>& weakHandler)
+    : m_operation(operation)
+    , m_previous(operation->progressObserver())
+  {
+    smtk::operation::Operation::ProgressObserver previous = m_previous;
+    operation->setProgressObserver(
+      [previous, context, weakHandler](double fraction, const std::string& message) {
+        if (previous)
+        {
+          previous(fraction, message);
+        }
+        QString qmessage = QString::fromStdString(message);
+        QMetaObject::invokeMethod(
+          context,
+          [weakHandler, fraction, qmessage]() {
+            if (auto handler = weakHandler.lock())
+            {
+              emit handler->progressChanged(fraction, qmessage);
+            }
+          },
+          Qt::QueuedConnection);
+      });
+  }
+
+  ~ForwardProgress() { m_operation->setProgressObserver(m_previous); }
+
+private:
+  smtk::operation::Operation::Ptr m_operation;
+  smtk::operation::Operation::ProgressObserver m_previous;
+};
+} // namespace
+
 namespace smtk
 {
 namespace extension
@@ -19,6 +64,7 @@ std::shared_ptr<ResultHandler> qtOperationLauncher::operator()(
 {
   // Create Result Handler
   std::shared_ptr<ResultHandler> handler = std::make_shared<ResultHandler>();
+  handler->m_operation = op;
 
 // To enable SINGLE_THREAD, set CMake variable SMTK_ENABLE_OPERATION_THREADS to OFF.
 #ifdef SINGLE_THREAD
@@ -35,7 +81,11 @@ std::shared_ptr<ResultHandler> qtOperationLauncher::operator()(
   handler->m_future = future;
 
   // Execute the operation in the subthread.
-  auto result = op->operate();
+  smtk::operation::Operation::Result result;
+  {
+    ForwardProgress forwardProgress(op, this, handler);
+    result = op->operate();
+  }
 
   // Set the promise to the output result.
   promise.set_value(result);
@@ -80,7 +130,11 @@ std::shared_ptr<ResultHandler> qtOperationLauncher::operator()(
       }
     });
 
-  handler->m_future = m_threadPool(&qtOperationLauncher::run, this, op);
+  // The subthread only holds a weak reference to the handler so that the
+  // handler (a QObject) is always destroyed on this thread.
+  std::weak_ptr<ResultHandler> weakHandler = handler;
+  handler->m_future = m_executor.submit(
+    [this, operation, weakHandler]() { return this->run(operation, weakHandler); });
 
 #endif
 
@@ -89,10 +143,15 @@ std::shared_ptr<ResultHandler> qtOperationLauncher::operator()(
 }
 
 smtk::operation::Operation::Result qtOperationLauncher::run(
-  smtk::operation::Operation::Ptr operation)
+  smtk::operation::Operation::Ptr operation,
+  const std::weak_ptr<ResultHandler>& handler)
 {
   // Execute the operation in the subthread.
-  auto result = operation->operate();
+  smtk::operation::Operation::Result result;
+  {
+    ForwardProgress forwardProgress(operation, this, handler);
+    result = operation->operate();
+  }
 
   // Privately emit the name of the output result so the contents of this class
   // that reside on the original thread can access it.
@@ -113,5 +172,13 @@ smtk::operation::Operation::Result ResultHandler::waitForResult()
 {
   return m_future.get();
 }
+
+void ResultHandler::cancel()
+{
+  if (auto operation = m_operation.lock())
+  {
+    operation->cancel();
+  }
+}
 } // namespace extension
 } // namespace smtk
@@ -16,7 +16,7 @@
 #include "smtk/attribute/Attribute.h"
 #include "smtk/attribute/Resource.h"
 
-#include "smtk/common/ThreadPool.h"
+#include "smtk/common/Executor.h"
 
 #include "smtk/operation/Operation.h"
 
@@ -43,15 +43,24 @@ public:
   smtk::operation::Operation::Result waitForResult();
   std::shared_future<smtk::operation::Operation::Result>& future() { return m_future; }
 
+public slots:
+  /// Ask the operation to stop (see smtk::operation::Operation::cancel()).
+  void cancel();
+
 signals:
   /// Externally accessible signal on the primary thread containing the
   /// operation results.
   void resultReady(smtk::operation::Operation::Result result);
 
+  /// Emitted (and delivered to the primary thread) as the operation reports
+  /// its progress.
+  void progressChanged(double fraction, QString message);
+
 private:
   friend class qtOperationLauncher;
   friend class Launcher;
   std::shared_future<smtk::operation::Operation::Result> m_future;
+  std::weak_ptr<smtk::operation::Operation> m_operation;
 };
 
 /// An operation launcher that emits a signal containing the operation's result
@@ -79,9 +88,11 @@ signals:
 
 private:
   /// Internal method run on a subthread to invoke the operation.
-  smtk::operation::Operation::Result run(smtk::operation::Operation::Ptr operation);
+  smtk::operation::Operation::Result run(
+    smtk::operation::Operation::Ptr operation,
+    const std::weak_ptr<ResultHandler>& handler);
 
-  smtk::common::ThreadPool<smtk::operation::Operation::Result> m_threadPool;
+  smtk::common::Executor m_executor;
 };
 
 namespace qt
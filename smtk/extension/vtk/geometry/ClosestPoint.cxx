@@ -22,6 +22,8 @@
 #include <vtkDataSet.h>
 #include <vtkPointSet.h>
 
+#include <algorithm>
+
 namespace smtk
 {
 namespace extension
@@ -33,16 +35,27 @@ namespace geometry
 std::array<double, 3> ClosestPoint::operator()(
   const smtk::resource::ComponentPtr& component,
   const std::array<double, 3>& input) const
+{
+  std::array<double, 3> returnValue;
+  this->closestPoints(component, input.data(), 1, returnValue.data());
+  return returnValue;
+}
+
+void ClosestPoint::closestPoints(
+  const smtk::resource::ComponentPtr& component,
+  const double* points,
+  std::size_t numberOfPoints,
+  double* closest) const
 {
   static constexpr const double nan = std::numeric_limits<double>::quiet_NaN();
-  std::array<double, 3> returnValue{ { nan, nan, nan } };
+  std::fill(closest, closest + 3 * numberOfPoints, nan);
 
   smtk::geometry::Resource::Ptr resource =
     std::dynamic_pointer_cast<smtk::geometry::Resource>(component->resource());
 
   if (!resource)
   {
-    return returnValue;
+    return;
   }
 
   vtkDataSet* data = nullptr;
@@ -60,13 +73,13 @@ std::array<double, 3> ClosestPoint::operator()(
     }
     catch (std::bad_cast&)
     {
-      return returnValue;
+      return;
     }
   }
 
   if (data == nullptr)
   {
-    return returnValue;
+    return;
   }
 
   vtkSmartPointer<vtkDataObject> cachedAuxData; // Keep here so it stays in scope
@@ -87,16 +100,17 @@ std::array<double, 3> ClosestPoint::operator()(
         pdata = vtkPointSet::SafeDownCast(cachedAuxData);
       }
     }
+  }
 
-    if (pdata && pdata->GetNumberOfPoints() > 0)
+  if (pdata && pdata->GetNumberOfPoints() > 0)
+  {
+    for (std::size_t i = 0; i < 3 * numberOfPoints; i += 3)
     {
-      vtkIdType closestId = pdata->FindPoint(const_cast<double*>(input.data()));
-      pdata->GetPoint(closestId, returnValue.data());
+      vtkIdType closestId = pdata->FindPoint(const_cast<double*>(points + i));
+      pdata->GetPoint(closestId, closest + i);
     }
   }
-
-  return returnValue;
-};
+}
 } // namespace geometry
 } // namespace vtk
 } // namespace extension
@@ -34,6 +34,12 @@ struct VTKSMTKGEOMETRYEXT_EXPORT ClosestPoint
   std::array<double, 3> operator()(
     const smtk::resource::Component::Ptr&,
     const std::array<double, 3>&) const override;
+
+  void closestPoints(
+    const smtk::resource::Component::Ptr&,
+    const double* points,
+    std::size_t numberOfPoints,
+    double* closest) const override;
 };
 } // namespace geometry
 } // namespace vtk
@@ -22,7 +22,7 @@
 #include "smtk/model/AuxiliaryGeometry.h"
 #include "smtk/model/Entity.h"
 
-#include "smtk/operation/queries/SynchronizedCache.h"
+#include "smtk/operation/queries/ComponentCache.h"
 
 #include <vtkCellLocator.h>
 #include <vtkDataSet.h>
@@ -30,29 +30,14 @@
 #include <vtkPointSet.h>
 #include <vtkSmartPointer.h>
 
+#include <algorithm>
+#include <cmath>
+
 namespace
 {
-struct CellLocatorCache : public smtk::operation::SynchronizedCache
+struct CellLocatorCache : public smtk::operation::ComponentCache<vtkSmartPointer<vtkCellLocator>>
 {
-  void synchronize(const smtk::operation::Operation&, const smtk::operation::Operation::Result&)
-    override;
-
-  std::unordered_map<smtk::common::UUID, vtkSmartPointer<vtkCellLocator>> m_caches;
 };
-
-void CellLocatorCache::synchronize(
-  const smtk::operation::Operation&,
-  const smtk::operation::Operation::Result& result)
-{
-  for (const auto& component :
-       { result->findComponent("expunged"), result->findComponent("modified") })
-  {
-    for (std::size_t i = 0; i < component->numberOfValues(); ++i)
-    {
-      m_caches.erase(component->value(i)->id());
-    }
-  }
-}
 } // namespace
 
 namespace smtk
@@ -66,16 +51,32 @@ namespace geometry
 std::pair<double, std::array<double, 3>> DistanceTo::operator()(
   const smtk::resource::ComponentPtr& component,
   const std::array<double, 3>& input) const
+{
+  std::pair<double, std::array<double, 3>> returnValue;
+  this->distances(component, input.data(), 1, &returnValue.first, returnValue.second.data());
+  return returnValue;
+}
+
+void DistanceTo::distances(
+  const smtk::resource::ComponentPtr& component,
+  const double* points,
+  std::size_t numberOfPoints,
+  double* distances,
+  double* closest) const
 {
   static constexpr const double nan = std::numeric_limits<double>::quiet_NaN();
-  std::pair<double, std::array<double, 3>> returnValue(nan, { { nan, nan, nan } });
+  std::fill(distances, distances + numberOfPoints, nan);
+  if (closest)
+  {
+    std::fill(closest, closest + 3 * numberOfPoints, nan);
+  }
 
   smtk::geometry::Resource::Ptr resource =
     std::dynamic_pointer_cast<smtk::geometry::Resource>(component->resource());
 
   if (!resource)
   {
-    return returnValue;
+    return;
   }
 
   vtkDataSet* data = nullptr;
@@ -93,13 +94,13 @@ std::pair<double, std::array<double, 3>> DistanceTo::operator()(
     }
     catch (std::bad_cast&)
     {
-      return returnValue;
+      return;
     }
   }
 
   if (data == nullptr)
   {
-    return returnValue;
+    return;
   }
 
   vtkSmartPointer<vtkDataObject> cachedAuxData; // Keep here so it stays in scope
@@ -123,28 +124,31 @@ std::pair<double, std::array<double, 3>> DistanceTo::operator()(
 
     CellLocatorCache& pointLocatorCache = resource->queries().cache<CellLocatorCache>();
 
-    auto search = pointLocatorCache.m_caches.find(component->id());
-    if (search == pointLocatorCache.m_caches.end())
-    {
-      search = pointLocatorCache.m_caches
-                 .emplace(std::make_pair(component->id(), vtkSmartPointer<vtkCellLocator>::New()))
-                 .first;
-      search->second->SetDataSet(pdata);
-      search->second->BuildLocator();
-    }
+    auto cellLocator = pointLocatorCache.get(component->id(), [pdata]() {
+      auto locator = vtkSmartPointer<vtkCellLocator>::New();
+      locator->SetDataSet(pdata);
+      locator->BuildLocator();
+      return locator;
+    });
 
     vtkSmartPointer<vtkGenericCell> cell = vtkSmartPointer<vtkGenericCell>::New();
 
     vtkIdType cellId;
     int subId;
-
-    search->second->FindClosestPoint(
-      input.data(), returnValue.second.data(), cell, cellId, subId, returnValue.first);
-    returnValue.first = sqrt(returnValue.first);
+    double distance2;
+    std::array<double, 3> nearest;
+    for (std::size_t i = 0; i < numberOfPoints; ++i)
+    {
+      (*cellLocator)
+        ->FindClosestPoint(points + 3 * i, nearest.data(), cell, cellId, subId, distance2);
+      distances[i] = sqrt(distance2);
+      if (closest)
+      {
+        std::copy(nearest.begin(), nearest.end(), closest + 3 * i);
+      }
+    }
   }
-
-  return returnValue;
-};
+}
 } // namespace geometry
 } // namespace vtk
 } // namespace extension
@@ -36,6 +36,13 @@ struct VTKSMTKGEOMETRYEXT_EXPORT DistanceTo
   std::pair<double, std::array<double, 3>> operator()(
     const smtk::resource::Component::Ptr&,
     const std::array<double, 3>&) const override;
+
+  void distances(
+    const smtk::resource::Component::Ptr&,
+    const double* points,
+    std::size_t numberOfPoints,
+    double* distances,
+    double* closest = nullptr) const override;
 };
 } // namespace geometry
 } // namespace vtk
@@ -0,0 +1,138 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/extension/vtk/geometry/Backend.h"
+#include "smtk/extension/vtk/geometry/ClosestPoint.h"
+#include "smtk/extension/vtk/geometry/DistanceTo.h"
+#include "smtk/extension/vtk/mesh/RegisterVTKBackend.h"
+
+#include "smtk/mesh/core/Component.h"
+#include "smtk/mesh/core/Resource.h"
+#include "smtk/mesh/moab/Interface.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// Check that the VTK batch variants of the geometry queries agree with their
+// single-point counterparts when run on a resource whose geometry is provided
+// by VTK.
+
+namespace
+{
+// The unit square in the z = 0 plane, split into two triangles.
+double pts[4][3] = { { 0., 0., 0. }, { 1., 0., 0. }, { 1., 1., 0. }, { 0., 1., 0. } };
+
+const std::vector<double> points = { 0.9, 0.1, 1., 0.5, 0.4, 2., -1., 0.4, 0., 0.2, 0.9, -0.5 };
+const std::size_t numberOfPoints = points.size() / 3;
+
+bool near(double a, double b)
+{
+  return std::abs(a - b) < 1.e-8;
+}
+
+smtk::resource::ComponentPtr createSquare(smtk::mesh::ResourcePtr& resource)
+{
+  smtk::mesh::InterfacePtr iface = smtk::mesh::moab::make_interface();
+  resource = smtk::mesh::Resource::create(iface);
+  smtk::mesh::BufferedCellAllocatorPtr allocator = resource->interface()->bufferedCellAllocator();
+  allocator->reserveNumberOfCoordinates(4);
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    allocator->setCoordinate(i, pts[i]);
+  }
+  int triangles[2][3] = { { 0, 1, 2 }, { 0, 2, 3 } };
+  for (auto& triangle : triangles)
+  {
+    allocator->addCell(smtk::mesh::Triangle, triangle, 3);
+  }
+  allocator->flush();
+  smtk::mesh::MeshSet mesh =
+    resource->createMesh(smtk::mesh::CellSet(resource, allocator->cells()));
+  return smtk::mesh::Component::create(mesh);
+}
+
+void TestClosestPoints(const smtk::resource::ComponentPtr& component)
+{
+  std::cout << "Verify that batch closest points match single queries.\n";
+  smtk::extension::vtk::geometry::ClosestPoint closestPoint;
+  std::vector<double> closest(points.size());
+  closestPoint.closestPoints(component, points.data(), numberOfPoints, closest.data());
+  for (std::size_t i = 0; i < numberOfPoints; ++i)
+  {
+    auto expected =
+      closestPoint(component, { { points[3 * i], points[3 * i + 1], points[3 * i + 2] } });
+    for (std::size_t j = 0; j < 3; ++j)
+    {
+      smtkTest(near(closest[3 * i + j], expected[j]), "Batch closest point differs.");
+    }
+  }
+
+  // Closest points are the nearest points of the component's geometry.
+  smtkTest(
+    near(closest[0], 1.) && near(closest[1], 0.) && near(closest[2], 0.),
+    "Unexpected closest point.");
+  smtkTest(
+    near(closest[9], 0.) && near(closest[10], 1.) && near(closest[11], 0.),
+    "Unexpected closest point.");
+  std::cout << "  ... Done.\n";
+}
+
+void TestDistances(const smtk::resource::ComponentPtr& component)
+{
+  std::cout << "Verify that batch distances match single queries.\n";
+  smtk::extension::vtk::geometry::DistanceTo distanceTo;
+  std::vector<double> distances(numberOfPoints);
+  std::vector<double> closest(points.size());
+  distanceTo.distances(component, points.data(), numberOfPoints, distances.data(), closest.data());
+  for (std::size_t i = 0; i < numberOfPoints; ++i)
+  {
+    auto expected =
+      distanceTo(component, { { points[3 * i], points[3 * i + 1], points[3 * i + 2] } });
+    smtkTest(near(distances[i], expected.first), "Batch distance differs.");
+    for (std::size_t j = 0; j < 3; ++j)
+    {
+      smtkTest(near(closest[3 * i + j], expected.second[j]), "Batch closest point differs.");
+    }
+  }
+
+  smtkTest(
+    near(distances[0], 1.) && near(distances[1], 2.) && near(distances[2], 1.) &&
+      near(distances[3], 0.5),
+    "Unexpected batch distances.");
+  smtkTest(
+    near(closest[3], 0.5) && near(closest[4], 0.4) && near(closest[5], 0.),
+    "Unexpected batch closest point.");
+
+  // Distances alone may be requested.
+  std::vector<double> distancesOnly(numberOfPoints);
+  distanceTo.distances(component, points.data(), numberOfPoints, distancesOnly.data());
+  smtkTest(distancesOnly == distances, "Distances depend upon requesting closest points.");
+  std::cout << "  ... Done.\n";
+}
+} // namespace
+
+int unitBatchGeometryQueries(int /*unused*/, char** const /*unused*/)
+{
+  smtk::extension::vtk::mesh::RegisterVTKBackend::registerClass();
+
+  smtk::mesh::ResourcePtr resource;
+  smtk::resource::ComponentPtr component = createSquare(resource);
+  smtkTest(
+    !!resource->geometry(smtk::extension::vtk::geometry::Backend()),
+    "Expected the mesh resource to provide VTK geometry.");
+
+  TestClosestPoints(component);
+  TestDistances(component);
+
+  return 0;
+}
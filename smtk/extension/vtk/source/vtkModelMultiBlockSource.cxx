@@ -34,6 +34,7 @@
 #include "smtk/model/Resource.h"
 #include "smtk/model/ShellEntity.h"
 #include "smtk/model/Tessellation.h"
+#include "smtk/model/TessellationBuffers.h"
 #include "smtk/model/UseEntity.h"
 #include "smtk/model/Volume.h"
 
@@ -41,9 +42,11 @@
 #include "vtkCellData.h"
 #include "vtkDataObjectTreeIterator.h"
 #include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
 #include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
+#include "vtkInformationObjectBaseKey.h"
 #include "vtkInformationStringKey.h"
 #include "vtkInformationVector.h"
 #include "vtkLookupTable.h"
@@ -55,6 +58,7 @@
 #include "vtkPolyData.h"
 #include "vtkPolyDataNormals.h"
 #include "vtkStringArray.h"
+#include "vtkTypeInt32Array.h"
 #include "vtkUnstructuredGrid.h"
 
 SMTK_THIRDPARTY_PRE_INCLUDE
@@ -69,6 +73,42 @@ using namespace smtk::model;
 
 vtkStandardNewMacro(vtkModelMultiBlockSource);
 smtkImplementTracksAllInstances(vtkModelMultiBlockSource);
+vtkInformationKeyMacro(vtkModelMultiBlockSource, TESSELLATION_BUFFERS, ObjectBase);
+
+namespace
+{
+// Keeps tessellation buffers alive for as long as VTK arrays wrapping them exist.
+class vtkTessellationBuffersHolder : public vtkObject
+{
+public:
+  static vtkTessellationBuffersHolder* New();
+  vtkTypeMacro(vtkTessellationBuffersHolder, vtkObject);
+
+  std::shared_ptr<const smtk::model::TessellationBuffers> Buffers;
+
+protected:
+  vtkTessellationBuffersHolder() = default;
+  ~vtkTessellationBuffersHolder() override = default;
+};
+
+vtkStandardNewMacro(vtkTessellationBuffersHolder);
+
+// Wrap a buffer in a VTK array without copying it. The array does not own
+// the buffer; the holder stored in the array's information keeps it alive.
+template<typename ArrayType, typename ValueType>
+vtkSmartPointer<ArrayType> WrapBuffer(
+  const smtk::model::TessellationBuffers::Span<const ValueType>& buffer,
+  int numberOfComponents,
+  vtkTessellationBuffersHolder* holder)
+{
+  auto array = vtkSmartPointer<ArrayType>::New();
+  array->SetNumberOfComponents(numberOfComponents);
+  array->SetArray(
+    const_cast<ValueType*>(buffer.data()), static_cast<vtkIdType>(buffer.size()), /*save*/ 1);
+  array->GetInformation()->Set(vtkModelMultiBlockSource::TESSELLATION_BUFFERS(), holder);
+  return array;
+}
+} // anonymous namespace
 
 vtkModelMultiBlockSource::vtkModelMultiBlockSource()
 {
@@ -82,6 +122,7 @@ vtkModelMultiBlockSource::vtkModelMultiBlockSource()
   }
   this->AllowNormalGeneration = 1;
   this->ShowAnalysisTessellation = 0;
+  this->SinglePrecisionPoints = 0;
   this->linkInstance();
 }
 
@@ -100,6 +141,7 @@ void vtkModelMultiBlockSource::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "CachedOutputInst: " << this->CachedOutputInst << "\n";
   os << indent << "AllowNormalGeneration: " << (this->AllowNormalGeneration ? "ON" : "OFF") << "\n";
   os << indent << "ShowAnalysisTessellation: " << this->ShowAnalysisTessellation << "\n";
+  os << indent << "SinglePrecisionPoints: " << (this->SinglePrecisionPoints ? "ON" : "OFF") << "\n";
 }
 
 /// Set the SMTK model to be displayed.
@@ -195,11 +237,30 @@ void vtkModelMultiBlockSource::Dirty()
  *  \brief Request the display tessellation be shown.
  */
 
+/*! \fn vtkModelMultiBlockSource::GetSinglePrecisionPoints()
+ *  \brief Get whether output points are stored as floats.
+ *
+ * The default value is 0 (points hold double-precision coordinates).
+ * A non-zero value halves the memory used by point coordinates
+ * at the cost of precision.
+ */
+
+/*! \fn vtkModelMultiBlockSource::SetSinglePrecisionPoints(int singlePrecision)
+ *  \brief Set whether output points are stored as floats.
+ *
+ *  \fn vtkModelMultiBlockSource::SinglePrecisionPointsOn()
+ *  \brief Request single-precision point coordinates.
+ *
+ *  \fn vtkModelMultiBlockSource::SinglePrecisionPointsOff()
+ *  \brief Request double-precision point coordinates.
+ */
+
 static void AddEntityTessToPolyData(
   const smtk::model::EntityRef& entityref,
   vtkPoints* pts,
   vtkPolyData* pd,
-  int showAnalysisTessellation)
+  int showAnalysisTessellation,
+  int singlePrecision)
 {
   // gotMesh fetches Analysis mesh if it exists, falling back
   // to model tessellation if not.
@@ -208,75 +269,51 @@ static void AddEntityTessToPolyData(
   if (!tess)
     return;
 
-  vtkIdType i;
-  //vtkIdType connOffset = pts->GetNumberOfPoints();
-  std::vector<vtkIdType> conn;
-  std::string uuidStr = entityref.entity().toString();
-  vtkIdType npts = tess->coords().size() / 3;
-  for (i = 0; i < npts; ++i)
+  // Wrap the tessellation's buffers rather than copying them cell by cell.
+  vtkNew<vtkTessellationBuffersHolder> holder;
+  holder->Buffers = tess->buffers(singlePrecision != 0);
+  const TessellationBuffers& buffers(*holder->Buffers);
+  if (buffers.numberOfPoints() > 0)
   {
-    pts->InsertNextPoint(&tess->coords()[3 * i]);
+    if (buffers.isSinglePrecision())
+    {
+      pts->SetData(WrapBuffer<vtkFloatArray>(buffers.floatCoords(), 3, holder));
+    }
+    else
+    {
+      pts->SetData(WrapBuffer<vtkDoubleArray>(buffers.coords(), 3, holder));
+    }
   }
-  Tessellation::size_type off;
-  vtkNew<vtkCellArray> verts;
-  vtkNew<vtkCellArray> lines;
-  vtkNew<vtkCellArray> polys;
-  vtkNew<vtkCellArray> strip;
-  bool have_verts = false;
-  bool have_lines = false;
-  bool have_polys = false;
-  bool have_strip = false;
-  for (off = tess->begin(); off != tess->end(); off = tess->nextCellOffset(off))
+
+  for (int pp = 0; pp < TessellationBuffers::NUMBER_OF_PRIMITIVES; ++pp)
   {
-    Tessellation::size_type cell_type = tess->cellType(off);
-    Tessellation::size_type cell_shape = Tessellation::cellShapeFromType(cell_type);
-    std::vector<int> cell_conn;
-    Tessellation::size_type num_verts = tess->vertexIdsOfCell(off, cell_conn);
-    std::vector<vtkIdType> vtk_conn(cell_conn.begin(), cell_conn.end());
-    switch (cell_shape)
+    TessellationBuffers::Primitive primitive = static_cast<TessellationBuffers::Primitive>(pp);
+    if (buffers.numberOfCells(primitive) == 0)
     {
-      case TESS_VERTEX:
-        have_verts = true;
-        verts->InsertNextCell(1, &vtk_conn[0]);
-        break;
-      case TESS_TRIANGLE:
-        have_polys = true;
-        polys->InsertNextCell(3, &vtk_conn[0]);
-        break;
-      case TESS_QUAD:
-        have_polys = true;
-        polys->InsertNextCell(4, &vtk_conn[0]);
-        break;
-      case TESS_POLYVERTEX:
-        have_verts = true;
-        verts->InsertNextCell(num_verts, &vtk_conn[0]);
+      continue;
+    }
+    vtkNew<vtkCellArray> cells;
+    cells->SetData(
+      WrapBuffer<vtkTypeInt32Array>(buffers.offsets(primitive), 1, holder),
+      WrapBuffer<vtkTypeInt32Array>(buffers.connectivity(primitive), 1, holder));
+    switch (primitive)
+    {
+      case TessellationBuffers::VERTICES:
+        pd->SetVerts(cells.GetPointer());
         break;
-      case TESS_POLYLINE:
-        have_lines = true;
-        lines->InsertNextCell(num_verts, &vtk_conn[0]);
+      case TessellationBuffers::LINES:
+        pd->SetLines(cells.GetPointer());
         break;
-      case TESS_POLYGON:
-        have_polys = true;
-        polys->InsertNextCell(num_verts, &vtk_conn[0]);
+      case TessellationBuffers::POLYGONS:
+        pd->SetPolys(cells.GetPointer());
         break;
-      case TESS_TRIANGLE_STRIP:
-        have_strip = true;
-        strip->InsertNextCell(num_verts, &vtk_conn[0]);
+      case TessellationBuffers::STRIPS:
+        pd->SetStrips(cells.GetPointer());
         break;
       default:
-        std::cerr << "Invalid cell shape " << cell_shape << " at offset " << off << ". Skipping.\n";
-        continue;
         break;
     }
   }
-  if (have_verts)
-    pd->SetVerts(verts.GetPointer());
-  if (have_lines)
-    pd->SetLines(lines.GetPointer());
-  if (have_polys)
-    pd->SetPolys(polys.GetPointer());
-  if (have_strip)
-    pd->SetStrips(strip.GetPointer());
 }
 
 static bool AddColorWithDefault(
@@ -415,7 +452,7 @@ vtkSmartPointer<vtkDataObject> vtkModelMultiBlockSource::GenerateRepresentationF
 
 vtkSmartPointer<vtkPolyData> vtkModelMultiBlockSource::GenerateRepresentationFromTessellation(
   const smtk::model::EntityRef& entity,
-  const smtk::model::Tessellation* tess,
+  const smtk::model::Tessellation* /*tess*/,
   bool genNormals)
 {
   vtkSmartPointer<vtkPolyData> pd = vtkSmartPointer<vtkPolyData>::New();
@@ -423,12 +460,11 @@ vtkSmartPointer<vtkPolyData> vtkModelMultiBlockSource::GenerateRepresentationFro
   pts->SetDataTypeToDouble();
   pd->SetPoints(pts.GetPointer());
 
-  vtkIdType npts = tess->coords().size() / 3;
-  pts->Allocate(npts);
   smtk::model::EntityPtr entrec;
   if (entity.isValid(&entrec))
   {
-    AddEntityTessToPolyData(entity, pts.GetPointer(), pd, this->ShowAnalysisTessellation);
+    AddEntityTessToPolyData(
+      entity, pts.GetPointer(), pd, this->ShowAnalysisTessellation, this->SinglePrecisionPoints);
     AddColorWithDefault(pd, entity, this->DefaultColor);
     if (this->AllowNormalGeneration && pd->GetPolys()->GetSize() > 0)
     {
@@ -515,12 +551,11 @@ void vtkModelMultiBlockSource::GenerateRepresentationFromModel(
   { // Oops.
     return;
   }
-  vtkIdType npts = tess->coords().size() / 3;
-  pts->Allocate(npts);
   smtk::model::EntityPtr entity;
   if (entityref.isValid(&entity))
   {
-    AddEntityTessToPolyData(entityref, pts.GetPointer(), pd, this->ShowAnalysisTessellation);
+    AddEntityTessToPolyData(
+      entityref, pts.GetPointer(), pd, this->ShowAnalysisTessellation, this->SinglePrecisionPoints);
     AddColorWithDefault(pd, entity, this->DefaultColor);
     if (this->AllowNormalGeneration && pd->GetPolys()->GetSize() > 0)
     {
@@ -1091,8 +1126,13 @@ void vtkModelMultiBlockSource::AddPointsAsAttribute(vtkPolyData* data)
     return;
   }
 
-  vtkNew<vtkDoubleArray> pointCoords;
-  pointCoords->ShallowCopy(data->GetPoints()->GetData());
+  // Share (rather than convert) the coordinates, including any wrapped buffers.
+  vtkDataArray* coords = data->GetPoints()->GetData();
+  vtkSmartPointer<vtkDataArray> pointCoords;
+  pointCoords.TakeReference(coords->NewInstance());
+  pointCoords->ShallowCopy(coords);
+  pointCoords->GetInformation()->CopyEntry(
+    coords->GetInformation(), vtkModelMultiBlockSource::TESSELLATION_BUFFERS());
   pointCoords->SetName("PointCoordinates");
   data->GetPointData()->AddArray(pointCoords.GetPointer());
 }
@@ -31,12 +31,17 @@
 
 class vtkPolyData;
 class vtkPolyDataNormals;
+class vtkInformationObjectBaseKey;
 class vtkInformationStringKey;
 
 /**\brief A VTK source for exposing model geometry in SMTK Resource as multiblock data.
   *
   * This filter generates a single block per UUID, for every UUID
   * in model resource with a tessellation entry.
+  *
+  * Points and cells of each block wrap the tessellation's buffers
+  * (see smtk::model::Tessellation::buffers()) rather than copying
+  * them, so the arrays of the output must be treated as read-only.
   */
 class VTKSMTKSOURCEEXT_EXPORT vtkModelMultiBlockSource : public vtkResourceMultiBlockSource
 {
@@ -81,6 +86,13 @@ public:
   vtkSetMacro(AllowNormalGeneration, int);
   vtkBooleanMacro(AllowNormalGeneration, int);
 
+  vtkGetMacro(SinglePrecisionPoints, int);
+  vtkSetMacro(SinglePrecisionPoints, int);
+  vtkBooleanMacro(SinglePrecisionPoints, int);
+
+  /// Key used to hold the tessellation buffers wrapped by an output data array.
+  static vtkInformationObjectBaseKey* TESSELLATION_BUFFERS();
+
   // Description:
   // Functions get string names used to store cell/field data.
   static const char* GetEntityTagName() { return "Entity"; }
@@ -158,6 +170,7 @@ protected:
   double DefaultColor[4];
   int AllowNormalGeneration;
   int ShowAnalysisTessellation;
+  int SinglePrecisionPoints;
   vtkNew<vtkPolyDataNormals> NormalGenerator;
   std::map<smtk::common::UUID, vtkIdType> UUID2BlockIdMap; // UUIDs to block index map
 
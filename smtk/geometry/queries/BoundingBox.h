@@ -18,6 +18,7 @@
 #include "smtk/resource/query/Query.h"
 
 #include <array>
+#include <vector>
 
 namespace smtk
 {
@@ -31,6 +32,20 @@ struct SMTKCORE_EXPORT BoundingBox
   : public smtk::resource::query::DerivedFrom<BoundingBox, smtk::resource::query::Query>
 {
   virtual std::array<double, 6> operator()(const smtk::resource::PersistentObject::Ptr&) const = 0;
+
+  /// Compute the bounding box of each of \a objects. By default, operator()
+  /// is called for each object.
+  virtual std::vector<std::array<double, 6>> boundingBoxes(
+    const std::vector<smtk::resource::PersistentObject::Ptr>& objects) const
+  {
+    std::vector<std::array<double, 6>> boxes;
+    boxes.reserve(objects.size());
+    for (const auto& object : objects)
+    {
+      boxes.push_back((*this)(object));
+    }
+    return boxes;
+  }
 };
 
 inline std::array<double, 6> BoundingBox::operator()(
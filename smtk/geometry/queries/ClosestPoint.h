@@ -17,7 +17,9 @@
 #include "smtk/resource/query/DerivedFrom.h"
 #include "smtk/resource/query/Query.h"
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 
 namespace smtk
 {
@@ -34,6 +36,25 @@ struct SMTKCORE_EXPORT ClosestPoint
   virtual std::array<double, 3> operator()(
     const smtk::resource::Component::Ptr&,
     const std::array<double, 3>&) const = 0;
+
+  /// Compute the closest point on a component to each of \a numberOfPoints
+  /// input \a points (stored as consecutive x, y, z triples), writing them to
+  /// \a closest (stored likewise). Implementations should resolve the
+  /// component's geometry once for the entire batch; by default, operator()
+  /// is called for each point.
+  virtual void closestPoints(
+    const smtk::resource::Component::Ptr& component,
+    const double* points,
+    std::size_t numberOfPoints,
+    double* closest) const
+  {
+    for (std::size_t i = 0; i < 3 * numberOfPoints; i += 3)
+    {
+      std::array<double, 3> result =
+        (*this)(component, { { points[i], points[i + 1], points[i + 2] } });
+      std::copy(result.begin(), result.end(), closest + i);
+    }
+  }
 };
 
 inline std::array<double, 3> ClosestPoint::operator()(
@@ -17,7 +17,9 @@
 #include "smtk/resource/query/DerivedFrom.h"
 #include "smtk/resource/query/Query.h"
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <utility>
 
 namespace smtk
@@ -37,6 +39,31 @@ struct SMTKCORE_EXPORT DistanceTo
   virtual std::pair<double, std::array<double, 3>> operator()(
     const smtk::resource::Component::Ptr&,
     const std::array<double, 3>&) const = 0;
+
+  /// Compute the distance from each of \a numberOfPoints input \a points
+  /// (stored as consecutive x, y, z triples) to a component, writing them to
+  /// \a distances and, unless it is null, the corresponding points on the
+  /// component to \a closest (stored as triples). Implementations should
+  /// resolve the component's geometry once for the entire batch; by default,
+  /// operator() is called for each point.
+  virtual void distances(
+    const smtk::resource::Component::Ptr& component,
+    const double* points,
+    std::size_t numberOfPoints,
+    double* distances,
+    double* closest = nullptr) const
+  {
+    for (std::size_t i = 0; i < numberOfPoints; ++i)
+    {
+      const double* point = points + 3 * i;
+      auto result = (*this)(component, { { point[0], point[1], point[2] } });
+      distances[i] = result.first;
+      if (closest)
+      {
+        std::copy(result.second.begin(), result.second.end(), closest + 3 * i);
+      }
+    }
+  }
 };
 
 inline std::pair<double, std::array<double, 3>> DistanceTo::operator()(
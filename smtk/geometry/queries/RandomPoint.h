@@ -17,7 +17,9 @@
 #include "smtk/resource/query/DerivedFrom.h"
 #include "smtk/resource/query/Query.h"
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 
 namespace smtk
 {
@@ -31,6 +33,22 @@ struct SMTKCORE_EXPORT RandomPoint
 {
   virtual std::array<double, 3> operator()(const smtk::resource::Component::Ptr&) const = 0;
 
+  /// Compute \a numberOfPoints random points on a component, writing them to
+  /// \a points as consecutive x, y, z triples. Implementations should resolve
+  /// the component's geometry once for the entire batch; by default,
+  /// operator() is called for each point.
+  virtual void randomPoints(
+    const smtk::resource::Component::Ptr& component,
+    std::size_t numberOfPoints,
+    double* points) const
+  {
+    for (std::size_t i = 0; i < 3 * numberOfPoints; i += 3)
+    {
+      std::array<double, 3> result = (*this)(component);
+      std::copy(result.begin(), result.end(), points + i);
+    }
+  }
+
   virtual void seed(std::size_t) {}
 };
 
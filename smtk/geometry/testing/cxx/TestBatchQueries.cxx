@@ -0,0 +1,127 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/geometry/queries/BoundingBox.h"
+#include "smtk/geometry/queries/ClosestPoint.h"
+#include "smtk/geometry/queries/DistanceTo.h"
+#include "smtk/geometry/queries/RandomPoint.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <cmath>
+#include <vector>
+
+// Check that the default batch variants of the geometry queries agree with
+// their single-point counterparts. The queries below treat every component
+// as the unit sphere centered at the origin.
+
+namespace
+{
+std::array<double, 3> project(const std::array<double, 3>& point)
+{
+  double length = std::sqrt(point[0] * point[0] + point[1] * point[1] + point[2] * point[2]);
+  return { { point[0] / length, point[1] / length, point[2] / length } };
+}
+
+struct SphereClosestPoint
+  : public smtk::resource::query::DerivedFrom<SphereClosestPoint, smtk::geometry::ClosestPoint>
+{
+  std::array<double, 3> operator()(
+    const smtk::resource::Component::Ptr&,
+    const std::array<double, 3>& point) const override
+  {
+    return project(point);
+  }
+};
+
+struct SphereDistanceTo
+  : public smtk::resource::query::DerivedFrom<SphereDistanceTo, smtk::geometry::DistanceTo>
+{
+  std::pair<double, std::array<double, 3>> operator()(
+    const smtk::resource::Component::Ptr&,
+    const std::array<double, 3>& point) const override
+  {
+    double length = std::sqrt(point[0] * point[0] + point[1] * point[1] + point[2] * point[2]);
+    return std::make_pair(std::abs(length - 1.), project(point));
+  }
+};
+
+struct SphereRandomPoint
+  : public smtk::resource::query::DerivedFrom<SphereRandomPoint, smtk::geometry::RandomPoint>
+{
+  std::array<double, 3> operator()(const smtk::resource::Component::Ptr&) const override
+  {
+    ++m_count;
+    return project({ { 1., static_cast<double>(m_count), 0. } });
+  }
+
+  mutable int m_count{ 0 };
+};
+
+struct SphereBoundingBox
+  : public smtk::resource::query::DerivedFrom<SphereBoundingBox, smtk::geometry::BoundingBox>
+{
+  std::array<double, 6> operator()(const smtk::resource::PersistentObject::Ptr&) const override
+  {
+    return { { -1., 1., -1., 1., -1., 1. } };
+  }
+};
+
+bool near(double a, double b)
+{
+  return std::abs(a - b) < 1.e-12;
+}
+} // namespace
+
+int TestBatchQueries(int /*unused*/, char** const /*unused*/)
+{
+  const std::vector<double> points = { 2., 0., 0., 0., 0.5, 0., 0., 0., -3., 1., 1., 1. };
+  const std::size_t numberOfPoints = points.size() / 3;
+  smtk::resource::Component::Ptr component;
+
+  SphereClosestPoint closestPoint;
+  std::vector<double> closest(points.size());
+  closestPoint.closestPoints(component, points.data(), numberOfPoints, closest.data());
+  for (std::size_t i = 0; i < numberOfPoints; ++i)
+  {
+    auto expected =
+      closestPoint(component, { { points[3 * i], points[3 * i + 1], points[3 * i + 2] } });
+    for (std::size_t j = 0; j < 3; ++j)
+    {
+      smtkTest(near(closest[3 * i + j], expected[j]), "Batch closest point differs.");
+    }
+  }
+
+  SphereDistanceTo distanceTo;
+  std::vector<double> distances(numberOfPoints);
+  std::fill(closest.begin(), closest.end(), 0.);
+  distanceTo.distances(component, points.data(), numberOfPoints, distances.data());
+  smtkTest(near(distances[0], 1.) && near(distances[1], 0.5), "Unexpected batch distances.");
+  smtkTest(closest[0] == 0., "Closest points written without being requested.");
+  distanceTo.distances(component, points.data(), numberOfPoints, distances.data(), closest.data());
+  smtkTest(near(distances[2], 2.) && near(closest[8], -1.), "Unexpected batch closest points.");
+
+  SphereRandomPoint randomPoint;
+  std::vector<double> random(3 * 5);
+  randomPoint.randomPoints(component, 5, random.data());
+  smtkTest(randomPoint.m_count == 5, "Expected one random point per request.");
+  for (std::size_t i = 0; i < random.size(); i += 3)
+  {
+    double length2 =
+      random[i] * random[i] + random[i + 1] * random[i + 1] + random[i + 2] * random[i + 2];
+    smtkTest(near(length2, 1.), "Random point not on the sphere.");
+  }
+
+  SphereBoundingBox boundingBox;
+  auto boxes = boundingBox.boundingBoxes({ nullptr, nullptr });
+  smtkTest(boxes.size() == 2 && boxes[1][5] == 1., "Unexpected batch bounding boxes.");
+
+  return 0;
+}
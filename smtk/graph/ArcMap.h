@@ -16,6 +16,12 @@
 #include "smtk/common/CompilerInformation.h"
 #include "smtk/common/TypeMap.h"
 
+#include "smtk/graph/InverseIndex.h"
+#include "smtk/graph/TypeTraits.h"
+
+#include <string>
+#include <unordered_map>
+
 namespace smtk
 {
 namespace graph
@@ -26,6 +32,11 @@ namespace graph
   * The main reason this currently exists is to delete the copy/assignment
   * constructors so developers must reference the container instead of
   * mistakenly modifying an accidental copy.
+  *
+  * ArcMap also holds the inverse indices of bidirectional arc types. Arcs
+  * inserted, emplaced or erased through ArcMap's API (rather than through
+  * the underlying TypeMapEntry) are attached to or detached from their
+  * type's index.
   */
 class SMTKCORE_EXPORT ArcMap : public smtk::common::TypeMap<smtk::common::UUID>
 {
@@ -43,6 +54,75 @@ public:
   ArcMap& operator=(const ArcMap&) = delete;
 
   ~ArcMap() override = default;
+
+  /// Insert (\a ArcType, \a key, \a arc ) into the map.
+  template<typename ArcType>
+  bool insert(const key_type& key, const ArcType& arc)
+  {
+    if (!Superclass::insert<ArcType>(key, arc))
+    {
+      return false;
+    }
+    this->attach<ArcType>(key);
+    return true;
+  }
+
+  /// Emplace (\a ArcType, \a key, \a arc ) into the map.
+  template<typename ArcType>
+  bool emplace(const key_type& key, ArcType&& arc)
+  {
+    if (!Superclass::emplace<ArcType>(key, std::forward<ArcType>(arc)))
+    {
+      return false;
+    }
+    this->attach<ArcType>(key);
+    return true;
+  }
+
+  /// Erase the arc of type \a ArcType indexed by \a key from the map.
+  template<typename ArcType>
+  void erase(const key_type& key)
+  {
+    this->detach<ArcType>(key);
+    Superclass::erase<ArcType>(key);
+  }
+
+  /// Access the inverse index of \a ArcType, or null if \a ArcType is not
+  /// bidirectional.
+  template<typename ArcType>
+  const InverseIndex* inverse() const
+  {
+    auto it = m_inverses.find(smtk::common::typeName<ArcType>());
+    return it == m_inverses.end() ? nullptr : &it->second;
+  }
+
+private:
+  template<typename ArcType>
+  typename std::enable_if<is_bidirectional<ArcType>::value>::type attach(const key_type& key)
+  {
+    this->at<ArcType>(key).setInverseIndex(&m_inverses[smtk::common::typeName<ArcType>()]);
+  }
+
+  template<typename ArcType>
+  typename std::enable_if<!is_bidirectional<ArcType>::value>::type attach(const key_type&)
+  {
+  }
+
+  template<typename ArcType>
+  typename std::enable_if<is_bidirectional<ArcType>::value>::type detach(const key_type& key)
+  {
+    if (this->contains<ArcType>(key))
+    {
+      this->at<ArcType>(key).setInverseIndex(nullptr);
+    }
+  }
+
+  template<typename ArcType>
+  typename std::enable_if<!is_bidirectional<ArcType>::value>::type detach(const key_type&)
+  {
+  }
+
+  std::unordered_map<std::string, InverseIndex> m_inverses;
 };
 
 } // namespace graph
@@ -37,18 +37,20 @@ bool Component::setId(const smtk::common::UUID& uid)
 {
   if (auto resource = m_resource.lock())
   {
-    const_cast<ResourceBase::NodeSet&>(resource->nodes()).erase(this->shared_from_this());
+    // Re-key the node within its resource. If the new id is taken, the node
+    // is restored under its original id.
+    auto self = this->shared_from_this();
+    bool indexed = resource->eraseNode(self);
     smtk::common::UUID tmp = m_id;
     m_id = uid;
-    if (const_cast<ResourceBase::NodeSet&>(resource->nodes())
-          .insert(this->shared_from_this())
-          .second)
+    if (!indexed || resource->insertNode(self))
     {
       return true;
     }
     else
     {
       m_id = tmp;
+      resource->insertNode(self);
       return false;
     }
   }
@@ -229,6 +229,26 @@ public:
     return API().visit(*static_cast<const typename ArcType::FromType*>(this), visitor);
   }
 
+  /// Visit the nodes that have an arc of type ArcType to this node. ArcType
+  /// must be bidirectional (see smtk::graph::is_bidirectional), so that each
+  /// visit takes time proportional to the number of such nodes. As with
+  /// visit(), visitation is terminated early when the visitor returns true.
+  template<typename ArcType, typename Visitor>
+  bool visitIncoming(const Visitor& visitor) const
+  {
+    static_assert(
+      is_bidirectional<ArcType>::value, "Incoming arcs are only indexed for bidirectional arcs.");
+    auto resource = std::static_pointer_cast<smtk::graph::ResourceBase>(this->resource());
+    const InverseIndex* index = resource ? resource->arcs().inverse<ArcType>() : nullptr;
+    if (!index)
+    {
+      return false;
+    }
+    return index->visit(*this, [&visitor](const smtk::graph::Component& from) {
+      return visitor(static_cast<const typename ArcType::FromType&>(from));
+    });
+  }
+
 protected:
   Component(const std::shared_ptr<smtk::graph::ResourceBase>&);
 
@@ -0,0 +1,73 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/graph/InverseIndex.h"
+
+#include <algorithm>
+
+namespace smtk
+{
+namespace graph
+{
+
+void InverseIndex::insert(const Component& from, const Component& to)
+{
+  auto& incoming = m_incoming[&to];
+  auto it = std::find_if(
+    incoming.begin(), incoming.end(), [&from](const std::pair<const Component*, std::size_t>& e) {
+      return e.first == &from;
+    });
+  if (it == incoming.end())
+  {
+    incoming.emplace_back(&from, 1);
+  }
+  else
+  {
+    ++it->second;
+  }
+}
+
+bool InverseIndex::erase(const Component& from, const Component& to)
+{
+  auto entry = m_incoming.find(&to);
+  if (entry == m_incoming.end())
+  {
+    return false;
+  }
+
+  auto& incoming = entry->second;
+  auto it = std::find_if(
+    incoming.begin(), incoming.end(), [&from](const std::pair<const Component*, std::size_t>& e) {
+      return e.first == &from;
+    });
+  if (it == incoming.end())
+  {
+    return false;
+  }
+
+  if (--it->second == 0)
+  {
+    // Order is not significant, so fill the gap with the last entry.
+    *it = incoming.back();
+    incoming.pop_back();
+    if (incoming.empty())
+    {
+      m_incoming.erase(entry);
+    }
+  }
+  return true;
+}
+
+std::size_t InverseIndex::degree(const Component& to) const
+{
+  auto entry = m_incoming.find(&to);
+  return entry == m_incoming.end() ? 0 : entry->second.size();
+}
+} // namespace graph
+} // namespace smtk
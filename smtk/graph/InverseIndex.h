@@ -0,0 +1,100 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_graph_InverseIndex_h
+#define smtk_graph_InverseIndex_h
+
+#include "smtk/CoreExports.h"
+
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace smtk
+{
+namespace graph
+{
+
+class Component;
+
+/// The incoming arcs of a single arc type, indexed by their destination node.
+///
+/// Bidirectional arc types (see smtk::graph::is_bidirectional) keep an inverse
+/// index up to date as arcs are inserted and erased, so that the nodes with
+/// arcs to a given node can be visited in time proportional to their number
+/// rather than to the number of arcs of that type. Since ordered arcs may
+/// connect the same pair of nodes more than once, each origin is stored with
+/// its multiplicity.
+class SMTKCORE_EXPORT InverseIndex
+{
+public:
+  /// A pointer to the index that an arc container updates as it is modified.
+  /// Copies of a link are detached, so that copying an arc does not register
+  /// its connections a second time.
+  class Link
+  {
+  public:
+    Link() = default;
+    Link(const Link&) {}
+    Link& operator=(const Link&) { return *this; }
+
+    InverseIndex* get() const { return m_index; }
+    void reset(InverseIndex* index) { m_index = index; }
+
+  private:
+    InverseIndex* m_index{ nullptr };
+  };
+
+  InverseIndex() = default;
+  InverseIndex(const InverseIndex&) = delete;
+  InverseIndex& operator=(const InverseIndex&) = delete;
+
+  /// Record an arc from \a from to \a to.
+  void insert(const Component& from, const Component& to);
+
+  /// Remove one arc from \a from to \a to. Returns false if there was none.
+  bool erase(const Component& from, const Component& to);
+
+  /// Return the number of distinct nodes with arcs to \a to.
+  std::size_t degree(const Component& to) const;
+
+  /// Call \a visitor with each distinct node that has an arc to \a to.
+  /// Visitation terminates early when \a visitor returns true, in which case
+  /// true is returned.
+  template<typename Visitor>
+  bool visit(const Component& to, const Visitor& visitor) const
+  {
+    auto it = m_incoming.find(&to);
+    if (it == m_incoming.end())
+    {
+      return false;
+    }
+    for (const auto& entry : it->second)
+    {
+      if (visitor(*entry.first))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Remove all arcs from the index.
+  void clear() { m_incoming.clear(); }
+
+private:
+  std::unordered_map<const Component*, std::vector<std::pair<const Component*, std::size_t>>>
+    m_incoming;
+};
+} // namespace graph
+} // namespace smtk
+
+#endif // smtk_graph_InverseIndex_h
@@ -0,0 +1,165 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/graph/NodeIndex.h"
+
+#include "smtk/resource/Component.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+// The index grows once more than half of its slots are occupied, which
+// keeps linear probe sequences short.
+constexpr std::size_t g_minimumCapacity = 16;
+} // namespace
+
+namespace smtk
+{
+namespace graph
+{
+
+bool NodeIndex::insert(smtk::resource::Component* node)
+{
+  if (!node)
+  {
+    return false;
+  }
+
+  if (2 * (m_size + 1) > m_slots.size())
+  {
+    this->rehash(std::max(g_minimumCapacity, 2 * m_slots.size()));
+  }
+
+  const smtk::common::UUID& id = node->id();
+  for (std::size_t index = this->slot(id);; index = (index + 1) & m_mask)
+  {
+    Slot& slot = m_slots[index];
+    if (!slot.m_node)
+    {
+      slot.m_id = id;
+      slot.m_node = node;
+      ++m_size;
+      return true;
+    }
+    if (slot.m_id == id)
+    {
+      return false;
+    }
+  }
+}
+
+bool NodeIndex::erase(const smtk::common::UUID& id)
+{
+  if (m_size == 0)
+  {
+    return false;
+  }
+
+  std::size_t index = this->slot(id);
+  for (;; index = (index + 1) & m_mask)
+  {
+    if (!m_slots[index].m_node)
+    {
+      return false;
+    }
+    if (m_slots[index].m_id == id)
+    {
+      break;
+    }
+  }
+
+  // Shift back any subsequent entries in the probe sequence that would no
+  // longer be reachable once this slot is emptied.
+  std::size_t hole = index;
+  for (std::size_t next = (hole + 1) & m_mask; m_slots[next].m_node; next = (next + 1) & m_mask)
+  {
+    std::size_t preferred = this->slot(m_slots[next].m_id);
+    // The entry at "next" may fill the hole if its preferred slot does not
+    // lie cyclically within (hole, next].
+    if (((next - preferred) & m_mask) >= ((next - hole) & m_mask))
+    {
+      m_slots[hole] = m_slots[next];
+      hole = next;
+    }
+  }
+  m_slots[hole].m_node = nullptr;
+  --m_size;
+  return true;
+}
+
+smtk::resource::Component* NodeIndex::find(const smtk::common::UUID& id) const
+{
+  if (m_size == 0)
+  {
+    return nullptr;
+  }
+
+  for (std::size_t index = this->slot(id);; index = (index + 1) & m_mask)
+  {
+    const Slot& slot = m_slots[index];
+    if (!slot.m_node)
+    {
+      return nullptr;
+    }
+    if (slot.m_id == id)
+    {
+      return slot.m_node;
+    }
+  }
+}
+
+void NodeIndex::reserve(std::size_t size)
+{
+  std::size_t capacity = g_minimumCapacity;
+  while (capacity < 2 * size)
+  {
+    capacity *= 2;
+  }
+  if (capacity > m_slots.size())
+  {
+    this->rehash(capacity);
+  }
+}
+
+void NodeIndex::clear()
+{
+  m_slots.clear();
+  m_size = 0;
+  m_mask = 0;
+  m_shift = 64;
+}
+
+void NodeIndex::rehash(std::size_t capacity)
+{
+  std::vector<Slot> slots(capacity);
+  std::swap(slots, m_slots);
+  m_mask = capacity - 1;
+  m_shift = 64;
+  for (std::size_t i = capacity; i > 1; i >>= 1)
+  {
+    --m_shift;
+  }
+
+  for (const auto& slot : slots)
+  {
+    if (slot.m_node)
+    {
+      std::size_t index = this->slot(slot.m_id);
+      while (m_slots[index].m_node)
+      {
+        index = (index + 1) & m_mask;
+      }
+      m_slots[index] = slot;
+    }
+  }
+}
+} // namespace graph
+} // namespace smtk
@@ -0,0 +1,87 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_graph_NodeIndex_h
+#define smtk_graph_NodeIndex_h
+
+#include "smtk/CoreExports.h"
+
+#include "smtk/common/UUID.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace smtk
+{
+namespace resource
+{
+class Component;
+}
+namespace graph
+{
+
+/// An open-addressing hash table that maps UUIDs to the nodes of a graph
+/// resource.
+///
+/// Slots are probed linearly and erased entries are removed by shifting
+/// subsequent entries back, so lookups never allocate and no tombstones
+/// accumulate. The index does not own its nodes; ResourceBase keeps it
+/// consistent with its node set.
+class SMTKCORE_EXPORT NodeIndex
+{
+public:
+  NodeIndex() = default;
+
+  /// Index \a node by its current id. Returns false if \a node is null or a
+  /// node with the same id is already indexed.
+  bool insert(smtk::resource::Component* node);
+
+  /// Remove the node indexed by \a id. Returns false if there is none.
+  bool erase(const smtk::common::UUID& id);
+
+  /// Return the node indexed by \a id, or null if there is none.
+  smtk::resource::Component* find(const smtk::common::UUID& id) const;
+
+  /// Prepare the index to hold \a size nodes without rehashing.
+  void reserve(std::size_t size);
+
+  /// Remove all nodes from the index.
+  void clear();
+
+  std::size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+
+private:
+  struct Slot
+  {
+    smtk::common::UUID m_id;
+    smtk::resource::Component* m_node{ nullptr };
+  };
+
+  // Map an id to its preferred slot. The id's hash is mixed with a
+  // multiplicative (Fibonacci) hash so that its high bits select the slot.
+  std::size_t slot(const smtk::common::UUID& id) const
+  {
+    std::uint64_t hash = static_cast<std::uint64_t>(id.hash()) * 0x9E3779B97F4A7C15ull;
+    return static_cast<std::size_t>(hash >> m_shift);
+  }
+
+  void rehash(std::size_t capacity);
+
+  std::vector<Slot> m_slots;
+  std::size_t m_size{ 0 };
+  std::size_t m_mask{ 0 };
+  unsigned int m_shift{ 64 };
+};
+} // namespace graph
+} // namespace smtk
+
+#endif // smtk_graph_NodeIndex_h
@@ -78,7 +78,7 @@ public:
     enable_if<smtk::tuple_contains<NodeType, typename GraphTraits::NodeTypes>::value, bool>::type
     add(const std::shared_ptr<NodeType>& node)
   {
-    return ResourceBase::m_nodes.insert(node).second;
+    return this->insertNode(node);
   }
 
   /// Remove a node from the resource. Return true if the removal took place.
@@ -87,7 +87,7 @@ public:
     enable_if<smtk::tuple_contains<NodeType, typename GraphTraits::NodeTypes>::value, bool>::type
     remove(const std::shared_ptr<NodeType>& node)
   {
-    return ResourceBase::m_nodes.erase(node) > 0;
+    return this->eraseNode(node);
   }
 
   /// Create an arc of type ArcType with additional constructor arguments.
@@ -137,6 +137,15 @@ public:
   Resource(const Resource&) = delete;
 
 protected:
+  bool queryCandidates(
+    const std::function<bool(const smtk::resource::Component&)>& queryOp,
+    smtk::common::UUIDs& candidates) const override
+  {
+    const auto* filter =
+      queryOp.target<smtk::resource::filter::Filter<smtk::graph::filter::Grammar>>();
+    return filter && filter->candidates(this->properties(), candidates);
+  }
+
   Resource(smtk::resource::ManagerPtr manager = nullptr)
     : Superclass(manager)
     , m_arcs(identity<typename GraphTraits::ArcTypes>())
@@ -27,30 +27,32 @@ bool ResourceBase::Compare::operator()(
 std::shared_ptr<smtk::resource::Component> ResourceBase::find(
   const smtk::common::UUID& compId) const
 {
-  // Components are stored in a set, so we construct a dummy component to find
-  // the component we want.
-  struct QueryKey : resource::Component
+  if (smtk::resource::Component* node = m_index.find(compId))
   {
-    QueryKey(const smtk::common::UUID& id)
-      : m_id(id)
-    {
-    }
-    const smtk::common::UUID& id() const final { return m_id; }
-    bool setId(const smtk::common::UUID&) final { return false; }
-    const smtk::resource::ResourcePtr resource() const final
-    {
-      return smtk::resource::ResourcePtr();
-    }
+    return node->shared_from_this();
+  }
+  return std::shared_ptr<smtk::resource::Component>();
+}
 
-    const smtk::common::UUID& m_id;
-  };
+bool ResourceBase::insertNode(const std::shared_ptr<smtk::resource::Component>& node)
+{
+  if (!node || !m_index.insert(node.get()))
+  {
+    return false;
+  }
+  m_nodes.insert(node);
+  return true;
+}
 
-  auto it = m_nodes.find(std::make_shared<QueryKey>(compId));
-  if (it != m_nodes.end())
+bool ResourceBase::eraseNode(const std::shared_ptr<smtk::resource::Component>& node)
+{
+  if (!node || m_index.find(node->id()) != node.get())
   {
-    return *it;
+    return false;
   }
-  return std::shared_ptr<smtk::resource::Component>();
+  m_index.erase(node->id());
+  m_nodes.erase(node);
+  return true;
 }
 
 void ResourceBase::visit(std::function<void(const smtk::resource::ComponentPtr&)>& v) const
@@ -61,5 +63,15 @@ void ResourceBase::visit(std::function<void(const smtk::resource::ComponentPtr&)
   }
 }
 
+bool ResourceBase::gatherComponents(std::vector<smtk::resource::Component*>& components) const
+{
+  components.reserve(components.size() + m_nodes.size());
+  for (const auto& node : m_nodes)
+  {
+    components.push_back(node.get());
+  }
+  return true;
+}
+
 } // namespace graph
 } // namespace smtk
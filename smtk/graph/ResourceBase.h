@@ -15,6 +15,7 @@
 #include "smtk/geometry/Resource.h"
 
 #include "smtk/graph/ArcMap.h"
+#include "smtk/graph/NodeIndex.h"
 
 #include <memory>
 #include <string>
@@ -48,6 +49,8 @@ public:
 
   using NodeSet = std::set<std::shared_ptr<smtk::resource::Component>, Compare>;
 
+  /// Find a node by its id. Nodes are indexed by a hash table, so lookups
+  /// take constant time and do not allocate.
   std::shared_ptr<smtk::resource::Component> find(const smtk::common::UUID&) const override;
 
   void visit(std::function<void(const smtk::resource::ComponentPtr&)>& v) const override;
@@ -58,6 +61,14 @@ public:
   virtual ArcMap& arcs() = 0;
 
 protected:
+  friend class Component;
+
+  bool gatherComponents(std::vector<smtk::resource::Component*>& components) const override;
+
+  // Add a node to (or remove a node from) both the node set and the index.
+  bool insertNode(const std::shared_ptr<smtk::resource::Component>& node);
+  bool eraseNode(const std::shared_ptr<smtk::resource::Component>& node);
+
   ResourceBase(smtk::resource::ManagerPtr manager = nullptr)
     : Superclass(manager)
   {
@@ -69,6 +80,7 @@ protected:
   }
 
   NodeSet m_nodes;
+  NodeIndex m_index;
 };
 
 } // namespace graph
@@ -78,6 +78,21 @@ public:
   static constexpr bool value = type::value;
 };
 
+/// Arc types that declare `typedef std::true_type Bidirectional;` have their
+/// incoming arcs indexed by the resource (see smtk::graph::InverseIndex).
+template<typename ArcType>
+class is_bidirectional
+{
+  template<typename X>
+  static typename X::Bidirectional testBidirectional(typename X::Bidirectional*);
+  template<typename X>
+  static std::false_type testBidirectional(...);
+
+public:
+  using type = decltype(testBidirectional<ArcType>(nullptr));
+  static constexpr bool value = type::value;
+};
+
 template<typename Functor, typename Input>
 class accepts
 {
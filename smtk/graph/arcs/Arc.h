@@ -13,6 +13,10 @@
 
 #include "smtk/common/CompilerInformation.h"
 
+#include "smtk/graph/InverseIndex.h"
+
+#include <type_traits>
+
 namespace smtk
 {
 namespace graph
@@ -21,13 +25,15 @@ namespace graph
 /// A basic arc type that restricts its endpoints.
 ///
 /// The endpoint nodes must be types derived from smtk::graph::Component and
-/// are specified as template parameters.
+/// are specified as template parameters. Derived arc types that declare
+/// `typedef std::true_type Bidirectional;` are indexed by their destination.
 template<typename from_type, typename to_type>
 class SMTK_ALWAYS_EXPORT Arc
 {
 public:
   typedef to_type ToType;
   typedef from_type FromType;
+  typedef std::false_type Bidirectional;
 
   /// Force arcs to connect components of the proper type at construction.
   Arc(const FromType& from, ToType& to)
@@ -41,6 +47,21 @@ public:
   const ToType& to() const { return m_to; }
   ToType& to() { return m_to; }
 
+  /// Register the arc with \a index (or unregister it if \a index is null).
+  /// This is called by ArcMap as bidirectional arcs are added and removed.
+  void setInverseIndex(InverseIndex* index)
+  {
+    if (m_inverse.get())
+    {
+      m_inverse.get()->erase(m_from, m_to);
+    }
+    m_inverse.reset(index);
+    if (index)
+    {
+      index->insert(m_from, m_to);
+    }
+  }
+
   /// An API for accessing this class's information using
   /// smtk::graph::Component's API.
   template<typename SelfType>
@@ -82,6 +103,7 @@ public:
 private:
   const FromType& m_from;
   ToType& m_to;
+  InverseIndex::Link m_inverse;
 };
 } // namespace graph
 } // namespace smtk
@@ -18,6 +18,7 @@
 
 #include "smtk/common/CompilerInformation.h"
 
+#include "smtk/graph/InverseIndex.h"
 #include "smtk/graph/ResourceBase.h"
 #include "smtk/graph/TypeTraits.h"
 
@@ -29,6 +30,8 @@ namespace graph
 /// An unordered collection of arcs of the same type.
 ///
 /// All arcs must have components with the same origin and destination types.
+/// Derived arc types that declare `typedef std::true_type Bidirectional;` are
+/// indexed by their destinations as the collection is modified.
 template<typename from_type, typename to_type>
 class SMTK_ALWAYS_EXPORT Arcs
 {
@@ -45,16 +48,149 @@ class SMTK_ALWAYS_EXPORT Arcs
 public:
   typedef from_type FromType;
   typedef to_type ToType;
-  typedef std::unordered_set<std::reference_wrapper<const ToType>, HashByUUID, EqualityByUUID>
-    Container;
+  typedef std::false_type Bidirectional;
+
+  /// The destination nodes of the arcs. Modifications are forwarded to the
+  /// inverse index (if any) of the arc type that owns the container.
+  class Container
+  {
+    typedef std::unordered_set<std::reference_wrapper<const ToType>, HashByUUID, EqualityByUUID>
+      Set;
+
+  public:
+    typedef typename Set::value_type value_type;
+    typedef typename Set::size_type size_type;
+    typedef typename Set::const_iterator iterator;
+    typedef typename Set::const_iterator const_iterator;
+
+    explicit Container(const FromType& from)
+      : m_from(&from)
+    {
+    }
+
+    Container(const Container& other)
+      : m_from(other.m_from)
+      , m_to(other.m_to)
+    {
+    }
+
+    // Containers are moved into the arc map before they are indexed; an
+    // indexed container is copied instead so that its index stays valid.
+    Container(Container&& other)
+      : m_from(other.m_from)
+    {
+      if (other.m_inverse.get())
+      {
+        m_to = other.m_to;
+      }
+      else
+      {
+        m_to = std::move(other.m_to);
+      }
+    }
+
+    Container& operator=(const Container& other)
+    {
+      if (this != &other)
+      {
+        this->clear();
+        for (const ToType& to : other)
+        {
+          this->insert(to);
+        }
+      }
+      return *this;
+    }
+
+    const_iterator begin() const { return m_to.begin(); }
+    const_iterator end() const { return m_to.end(); }
+    size_type size() const { return m_to.size(); }
+    bool empty() const { return m_to.empty(); }
+    size_type count(const ToType& to) const { return m_to.count(std::cref(to)); }
+    const_iterator find(const ToType& to) const { return m_to.find(std::cref(to)); }
+    void reserve(size_type size) { m_to.reserve(size); }
+
+    std::pair<const_iterator, bool> insert(const ToType& to)
+    {
+      auto inserted = m_to.insert(std::cref(to));
+      if (inserted.second && m_inverse.get())
+      {
+        m_inverse.get()->insert(*m_from, to);
+      }
+      return inserted;
+    }
+
+    size_type erase(const ToType& to)
+    {
+      const_iterator it = m_to.find(std::cref(to));
+      if (it == m_to.end())
+      {
+        return 0;
+      }
+      this->erase(it);
+      return 1;
+    }
+
+    const_iterator erase(const_iterator position)
+    {
+      if (m_inverse.get())
+      {
+        m_inverse.get()->erase(*m_from, position->get());
+      }
+      return m_to.erase(position);
+    }
+
+    void clear()
+    {
+      if (m_inverse.get())
+      {
+        for (const ToType& to : m_to)
+        {
+          m_inverse.get()->erase(*m_from, to);
+        }
+      }
+      m_to.clear();
+    }
+
+    /// Register the container's arcs with \a index (or unregister them if
+    /// \a index is null).
+    void setInverseIndex(InverseIndex* index)
+    {
+      if (m_inverse.get())
+      {
+        for (const ToType& to : m_to)
+        {
+          m_inverse.get()->erase(*m_from, to);
+        }
+      }
+      m_inverse.reset(index);
+      if (index)
+      {
+        for (const ToType& to : m_to)
+        {
+          index->insert(*m_from, to);
+        }
+      }
+    }
+
+  private:
+    const FromType* m_from;
+    Set m_to;
+    InverseIndex::Link m_inverse;
+  };
 
   /// Construct an Arcs instance from a node of type FromType to multiple nodes
   /// of type ToType.
   template<typename... ToTypes, typename = CompatibleTypes<ToType, ToTypes...>>
   Arcs(const FromType& from, ToTypes const&... to)
     : m_from(from)
-    , m_to({ std::ref(to)... })
+    , m_to(from)
   {
+    std::vector<std::reference_wrapper<const ToType>> toNodes{ std::cref(to)... };
+    for (const ToType& toNode : toNodes)
+    {
+      m_to.insert(toNode);
+    }
   }
 
   /// Construct an Arcs instance from a node of type FromType to multiple nodes
@@ -65,11 +201,12 @@ public:
     typename std::enable_if<is_iterable<Iterator>::type, const Iterator&>::type begin,
     const Iterator& end)
     : m_from(from)
+    , m_to(from)
   {
     m_to.reserve(std::distance(begin, end));
     for (Iterator it = begin; it != end; ++it)
     {
-      m_to.insert(std::ref(*it));
+      m_to.insert(*it);
     }
   }
 
@@ -87,6 +224,11 @@ public:
   const Container& to() const { return m_to; }
   Container& to() { return m_to; }
 
+  /// Register the arcs with \a index (or unregister them if \a index is
+  /// null). This is called by ArcMap as bidirectional arcs are added and
+  /// removed.
+  void setInverseIndex(InverseIndex* index) { m_to.setInverseIndex(index); }
+
   /// An API for accessing this class's information using
   /// smtk::graph::Component's API.
   template<typename SelfType>
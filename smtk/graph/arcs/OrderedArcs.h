@@ -17,6 +17,7 @@
 
 #include "smtk/common/CompilerInformation.h"
 
+#include "smtk/graph/InverseIndex.h"
 #include "smtk/graph/TypeTraits.h"
 
 namespace smtk
@@ -28,22 +29,154 @@ namespace graph
 ///
 /// All arcs must have components with the same origin and destination types.
 /// Furthermore, the arcs are ordered so that they are reported or visited in a
-/// consistent, user-specified order.
+/// consistent, user-specified order. Derived arc types that declare
+/// `typedef std::true_type Bidirectional;` are indexed by their destinations
+/// as the collection is modified.
 template<typename from_type, typename to_type>
 class SMTK_ALWAYS_EXPORT OrderedArcs
 {
 public:
   typedef from_type FromType;
   typedef to_type ToType;
-  typedef std::vector<std::reference_wrapper<const ToType>> Container;
+  typedef std::false_type Bidirectional;
+
+  /// The destination nodes of the arcs, in order. Modifications are forwarded
+  /// to the inverse index (if any) of the arc type that owns the container.
+  class Container
+  {
+    typedef std::vector<std::reference_wrapper<const ToType>> Vector;
+
+  public:
+    typedef typename Vector::value_type value_type;
+    typedef typename Vector::size_type size_type;
+    typedef typename Vector::const_iterator iterator;
+    typedef typename Vector::const_iterator const_iterator;
+
+    explicit Container(const FromType& from)
+      : m_from(&from)
+    {
+    }
+
+    Container(const Container& other)
+      : m_from(other.m_from)
+      , m_to(other.m_to)
+    {
+    }
+
+    // Containers are moved into the arc map before they are indexed; an
+    // indexed container is copied instead so that its index stays valid.
+    Container(Container&& other)
+      : m_from(other.m_from)
+    {
+      if (other.m_inverse.get())
+      {
+        m_to = other.m_to;
+      }
+      else
+      {
+        m_to = std::move(other.m_to);
+      }
+    }
+
+    Container& operator=(const Container& other)
+    {
+      if (this != &other)
+      {
+        this->clear();
+        for (const ToType& to : other)
+        {
+          this->push_back(to);
+        }
+      }
+      return *this;
+    }
+
+    const_iterator begin() const { return m_to.begin(); }
+    const_iterator end() const { return m_to.end(); }
+    size_type size() const { return m_to.size(); }
+    bool empty() const { return m_to.empty(); }
+    const value_type& at(size_type i) const { return m_to.at(i); }
+    const value_type& operator[](size_type i) const { return m_to[i]; }
+    const value_type& front() const { return m_to.front(); }
+    const value_type& back() const { return m_to.back(); }
+    void reserve(size_type size) { m_to.reserve(size); }
+
+    void push_back(const ToType& to)
+    {
+      m_to.push_back(std::cref(to));
+      if (m_inverse.get())
+      {
+        m_inverse.get()->insert(*m_from, to);
+      }
+    }
+
+    const_iterator insert(const_iterator position, const ToType& to)
+    {
+      if (m_inverse.get())
+      {
+        m_inverse.get()->insert(*m_from, to);
+      }
+      return m_to.insert(position, std::cref(to));
+    }
+
+    const_iterator erase(const_iterator position) { return this->erase(position, position + 1); }
+
+    const_iterator erase(const_iterator first, const_iterator last)
+    {
+      if (m_inverse.get())
+      {
+        for (auto it = first; it != last; ++it)
+        {
+          m_inverse.get()->erase(*m_from, it->get());
+        }
+      }
+      return m_to.erase(first, last);
+    }
+
+    void pop_back() { this->erase(m_to.end() - 1); }
+
+    void clear() { this->erase(m_to.begin(), m_to.end()); }
+
+    /// Register the container's arcs with \a index (or unregister them if
+    /// \a index is null).
+    void setInverseIndex(InverseIndex* index)
+    {
+      if (m_inverse.get())
+      {
+        for (const ToType& to : m_to)
+        {
+          m_inverse.get()->erase(*m_from, to);
+        }
+      }
+      m_inverse.reset(index);
+      if (index)
+      {
+        for (const ToType& to : m_to)
+        {
+          index->insert(*m_from, to);
+        }
+      }
+    }
+
+  private:
+    const FromType* m_from;
+    Vector m_to;
+    InverseIndex::Link m_inverse;
+  };
 
   /// Construct an OrderedArcs instance from a node of type FromType to multiple
   /// nodes of type ToType.
   template<typename... ToTypes, typename = CompatibleTypes<ToType, ToTypes...>>
   OrderedArcs(const FromType& from, ToTypes const&... to)
     : m_from(from)
-    , m_to({ std::ref(to)... })
+    , m_to(from)
   {
+    std::vector<std::reference_wrapper<const ToType>> toNodes{ std::cref(to)... };
+    m_to.reserve(toNodes.size());
+    for (const ToType& toNode : toNodes)
+    {
+      m_to.push_back(toNode);
+    }
   }
 
   /// Construct an OrderedArcs instance from a node of type FromType to multiple
@@ -54,11 +187,12 @@ public:
     typename std::enable_if<is_iterable<Iterator>::type, const Iterator&>::type begin,
     const Iterator& end)
     : m_from(from)
+    , m_to(from)
   {
     m_to.reserve(std::distance(begin, end));
     for (Iterator it = begin; it != end; ++it)
     {
-      m_to.push_back(std::ref(*it));
+      m_to.push_back(*it);
     }
   }
 
@@ -76,6 +210,11 @@ public:
   const Container& to() const { return m_to; }
   Container& to() { return m_to; }
 
+  /// Register the arcs with \a index (or unregister them if \a index is
+  /// null). This is called by ArcMap as bidirectional arcs are added and
+  /// removed.
+  void setInverseIndex(InverseIndex* index) { m_to.setInverseIndex(index); }
+
   /// An API for accessing this class's information using
   /// smtk::graph::Component's API.
   template<typename SelfType>
@@ -115,7 +254,7 @@ public:
 
 private:
   const FromType& m_from;
-  std::vector<std::reference_wrapper<const ToType>> m_to;
+  Container m_to;
 };
 } // namespace graph
 } // namespace smtk
@@ -0,0 +1,170 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/graph/Component.h"
+#include "smtk/graph/Resource.h"
+#include "smtk/graph/arcs/Arc.h"
+#include "smtk/graph/arcs/Arcs.h"
+#include "smtk/graph/arcs/OrderedArcs.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <set>
+
+/// Exercise the inverse indices of bidirectional arc types as arcs are
+/// created, modified and replaced.
+
+namespace test_incoming_arcs
+{
+class Vertex : public smtk::graph::Component
+{
+public:
+  template<typename... Args>
+  Vertex(Args&&... args)
+    : smtk::graph::Component::Component(std::forward<Args>(args)...)
+  {
+  }
+};
+
+class Edge : public smtk::graph::Component
+{
+public:
+  template<typename... Args>
+  Edge(Args&&... args)
+    : smtk::graph::Component::Component(std::forward<Args>(args)...)
+  {
+  }
+};
+
+// The ordered vertices of an edge, indexed so that a vertex's edges can be
+// visited.
+class Vertices : public smtk::graph::OrderedArcs<Edge, Vertex>
+{
+public:
+  typedef std::true_type Bidirectional;
+  using smtk::graph::OrderedArcs<Edge, Vertex>::OrderedArcs;
+};
+
+// An unordered, indexed set of vertices adjacent to a vertex.
+class Neighbors : public smtk::graph::Arcs<Vertex, Vertex>
+{
+public:
+  typedef std::true_type Bidirectional;
+  using smtk::graph::Arcs<Vertex, Vertex>::Arcs;
+};
+
+// A single, indexed arc from an edge to a vertex.
+class Start : public smtk::graph::Arc<Edge, Vertex>
+{
+public:
+  typedef std::true_type Bidirectional;
+  using smtk::graph::Arc<Edge, Vertex>::Arc;
+};
+
+// An arc that is not indexed.
+class Previous : public smtk::graph::Arc<Edge, Edge>
+{
+public:
+  using smtk::graph::Arc<Edge, Edge>::Arc;
+};
+
+struct Traits
+{
+  typedef std::tuple<Vertex, Edge> NodeTypes;
+  typedef std::tuple<Vertices, Neighbors, Start, Previous> ArcTypes;
+};
+
+template<typename ArcType, typename NodeType>
+std::multiset<const smtk::graph::Component*> incoming(const NodeType& node)
+{
+  std::multiset<const smtk::graph::Component*> result;
+  node.template visitIncoming<ArcType>([&result](const typename ArcType::FromType& from) {
+    result.insert(&from);
+    return false;
+  });
+  return result;
+}
+
+typedef std::multiset<const smtk::graph::Component*> Nodes;
+} // namespace test_incoming_arcs
+
+int TestIncomingArcs(int, char*[])
+{
+  using namespace test_incoming_arcs;
+
+  auto resource = smtk::graph::Resource<Traits>::create();
+  auto v1 = resource->create<Vertex>();
+  auto v2 = resource->create<Vertex>();
+  auto v3 = resource->create<Vertex>();
+  auto e1 = resource->create<Edge>();
+  auto e2 = resource->create<Edge>();
+
+  // Ordered arcs
+  {
+    resource->create<Vertices>(*e1, *v1, *v2);
+    e2->set<Vertices>(*v2, *v3);
+    smtkTest(incoming<Vertices>(*v1) == Nodes({ e1.get() }), "Unexpected edges of v1.");
+    smtkTest(incoming<Vertices>(*v2) == Nodes({ e1.get(), e2.get() }), "Unexpected edges of v2.");
+    smtkTest(incoming<Vertices>(*v3) == Nodes({ e2.get() }), "Unexpected edges of v3.");
+
+    e1->get<Vertices>().push_back(*v3);
+    e1->get<Vertices>().erase(e1->get<Vertices>().begin());
+    smtkTest(incoming<Vertices>(*v1).empty(), "Erased arc still indexed.");
+    smtkTest(incoming<Vertices>(*v3) == Nodes({ e1.get(), e2.get() }), "Appended arc not indexed.");
+
+    // Repeated arcs are visited once and remain indexed until all are erased.
+    e2->get<Vertices>().push_back(*v3);
+    smtkTest(incoming<Vertices>(*v3) == Nodes({ e1.get(), e2.get() }), "Repeated arc visited.");
+    e2->get<Vertices>().pop_back();
+    smtkTest(incoming<Vertices>(*v3) == Nodes({ e1.get(), e2.get() }), "Repeated arc lost.");
+
+    // Replacing an arc re-indexes it.
+    e2->set<Vertices>(*v1);
+    smtkTest(incoming<Vertices>(*v1) == Nodes({ e2.get() }), "Replaced arc not indexed.");
+    smtkTest(incoming<Vertices>(*v2) == Nodes({ e1.get() }), "Replaced arc still indexed.");
+    smtkTest(incoming<Vertices>(*v3) == Nodes({ e1.get() }), "Replaced arc still indexed.");
+
+    e1->get<Vertices>().clear();
+    smtkTest(incoming<Vertices>(*v2).empty(), "Cleared arc still indexed.");
+    smtkTest(
+      resource->arcs().inverse<Vertices>()->degree(*v1) == 1, "Unexpected number of edges of v1.");
+  }
+
+  // Unordered arcs, created on first access
+  {
+    v1->get<Neighbors>().insert(*v2);
+    v1->get<Neighbors>().insert(*v3);
+    v2->get<Neighbors>().insert(*v3);
+    smtkTest(incoming<Neighbors>(*v3) == Nodes({ v1.get(), v2.get() }), "Unexpected neighbors.");
+    v1->get<Neighbors>().erase(*v3);
+    smtkTest(incoming<Neighbors>(*v3) == Nodes({ v2.get() }), "Erased neighbor still indexed.");
+    smtkTest(incoming<Neighbors>(*v2) == Nodes({ v1.get() }), "Unexpected neighbors.");
+
+    // Early termination is reported.
+    smtkTest(
+      v2->visitIncoming<Neighbors>([](const Vertex&) { return true; }),
+      "Visitation should terminate early.");
+  }
+
+  // Single arcs
+  {
+    resource->create<Start>(*e1, *v3);
+    e2->set<Start>(*v3);
+    smtkTest(incoming<Start>(*v3) == Nodes({ e1.get(), e2.get() }), "Unexpected start vertices.");
+    e2->set<Start>(*v1);
+    smtkTest(incoming<Start>(*v3) == Nodes({ e1.get() }), "Replaced start still indexed.");
+    smtkTest(incoming<Start>(*v1) == Nodes({ e2.get() }), "Replaced start not indexed.");
+  }
+
+  // Arcs that are not bidirectional have no index.
+  resource->create<Previous>(*e2, *e1);
+  smtkTest(!resource->arcs().inverse<Previous>(), "Unidirectional arcs should not be indexed.");
+
+  return 0;
+}
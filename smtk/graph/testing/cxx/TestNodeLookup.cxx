@@ -0,0 +1,95 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/graph/Component.h"
+#include "smtk/graph/Resource.h"
+#include "smtk/graph/arcs/Arc.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <vector>
+
+namespace test_node_lookup
+{
+class Node : public smtk::graph::Component
+{
+public:
+  template<typename... Args>
+  Node(Args&&... args)
+    : smtk::graph::Component::Component(std::forward<Args>(args)...)
+  {
+  }
+};
+
+class Arc : public smtk::graph::Arc<Node, Node>
+{
+public:
+  template<typename... Args>
+  Arc(Args&&... args)
+    : smtk::graph::Arc<Node, Node>::Arc(std::forward<Args>(args)...)
+  {
+  }
+};
+
+struct Traits
+{
+  typedef std::tuple<Node> NodeTypes;
+  typedef std::tuple<Arc> ArcTypes;
+};
+} // namespace test_node_lookup
+
+int TestNodeLookup(int, char*[])
+{
+  using test_node_lookup::Node;
+
+  auto resource = smtk::graph::Resource<test_node_lookup::Traits>::create();
+
+  // Enough nodes to force the index to grow several times.
+  const std::size_t numberOfNodes = 10000;
+  std::vector<std::shared_ptr<Node>> nodes;
+  for (std::size_t i = 0; i < numberOfNodes; ++i)
+  {
+    nodes.push_back(resource->create<Node>());
+  }
+  smtkTest(resource->nodes().size() == numberOfNodes, "Unexpected number of nodes.");
+
+  for (const auto& node : nodes)
+  {
+    smtkTest(resource->find(node->id()) == node, "Could not find node " << node->id() << ".");
+  }
+  smtkTest(!resource->find(smtk::common::UUID::random()), "Found a node that does not exist.");
+  smtkTest(!resource->find(smtk::common::UUID::null()), "Found a node with a null id.");
+
+  // Remove every other node; the remainder must still be reachable.
+  for (std::size_t i = 0; i < numberOfNodes; i += 2)
+  {
+    smtkTest(resource->remove(nodes[i]), "Could not remove node.");
+    smtkTest(!resource->remove(nodes[i]), "A node should only be removed once.");
+  }
+  for (std::size_t i = 0; i < numberOfNodes; ++i)
+  {
+    bool found = resource->find(nodes[i]->id()) != nullptr;
+    smtkTest(found == (i % 2 == 1), "Unexpected lookup result for node " << i << ".");
+  }
+  smtkTest(resource->nodes().size() == numberOfNodes / 2, "Unexpected number of nodes.");
+
+  // Changing a node's id re-keys it; ids that are in use are rejected.
+  auto node = nodes[1];
+  smtk::common::UUID oldId = node->id();
+  smtk::common::UUID newId = smtk::common::UUID::random();
+  smtkTest(node->setId(newId), "Could not change a node's id.");
+  smtkTest(resource->find(newId) == node, "Node not found by its new id.");
+  smtkTest(!resource->find(oldId), "Node found by its old id.");
+  smtkTest(!node->setId(nodes[3]->id()), "A node's id should be unique.");
+  smtkTest(node->id() == newId, "A rejected id should not be assigned.");
+  smtkTest(resource->find(newId) == node, "Node not found after a rejected id change.");
+  smtkTest(resource->find(nodes[3]->id()) == nodes[3], "Existing node lost.");
+
+  return 0;
+}
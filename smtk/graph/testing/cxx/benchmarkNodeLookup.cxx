@@ -0,0 +1,102 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/graph/Component.h"
+#include "smtk/graph/Resource.h"
+#include "smtk/graph/arcs/Arc.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace benchmark_node_lookup
+{
+class Node : public smtk::graph::Component
+{
+public:
+  template<typename... Args>
+  Node(Args&&... args)
+    : smtk::graph::Component::Component(std::forward<Args>(args)...)
+  {
+  }
+};
+
+class Arc : public smtk::graph::Arc<Node, Node>
+{
+public:
+  template<typename... Args>
+  Arc(Args&&... args)
+    : smtk::graph::Arc<Node, Node>::Arc(std::forward<Args>(args)...)
+  {
+  }
+};
+
+struct Traits
+{
+  typedef std::tuple<Node> NodeTypes;
+  typedef std::tuple<Arc> ArcTypes;
+};
+
+double secondsSince(const std::chrono::steady_clock::time_point& start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+} // namespace benchmark_node_lookup
+
+// Measure the rate at which a graph resource finds its nodes by id. Pass the
+// number of nodes as the first argument (1,000,000 by default).
+int main(int argc, char* argv[])
+{
+  using namespace benchmark_node_lookup;
+
+  std::size_t numberOfNodes = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  auto resource = smtk::graph::Resource<Traits>::create();
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<smtk::common::UUID> ids;
+  ids.reserve(numberOfNodes);
+  for (std::size_t i = 0; i < numberOfNodes; ++i)
+  {
+    ids.push_back(resource->create<Node>()->id());
+  }
+  double deltaT = secondsSince(start);
+  std::cout << numberOfNodes << " nodes created in " << deltaT << " seconds "
+            << (numberOfNodes / deltaT) << " nodes/sec\n";
+
+  // Successful lookups.
+  std::size_t found = 0;
+  start = std::chrono::steady_clock::now();
+  for (const auto& id : ids)
+  {
+    found += resource->find(id) ? 1 : 0;
+  }
+  deltaT = secondsSince(start);
+  std::cout << found << " good lookups in " << deltaT << " seconds " << (numberOfNodes / deltaT)
+            << " lookups/sec\n";
+
+  // Failed lookups.
+  std::vector<smtk::common::UUID> missing;
+  missing.reserve(numberOfNodes);
+  for (std::size_t i = 0; i < numberOfNodes; ++i)
+  {
+    missing.push_back(smtk::common::UUID::random());
+  }
+  found = 0;
+  start = std::chrono::steady_clock::now();
+  for (const auto& id : missing)
+  {
+    found += resource->find(id) ? 1 : 0;
+  }
+  deltaT = secondsSince(start);
+  std::cout << (numberOfNodes - found) << " missed lookups in " << deltaT << " seconds "
+            << (numberOfNodes / deltaT) << " lookups/sec\n";
+
+  return 0;
+}
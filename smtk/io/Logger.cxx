@@ -10,15 +10,94 @@
 
 #include "smtk/io/Logger.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 
+namespace smtk
+{
+namespace io
+{
+// Captures are linked into a stack. Once linked, a sink's logger and
+// predecessor never change, so a stack may be shared by several threads.
+struct Logger::Capture::Sink
+{
+  Sink(const Logger* logger, const std::shared_ptr<Sink>& previous)
+    : m_logger(logger)
+    , m_previous(previous)
+  {
+  }
+
+  const Logger* m_logger;
+  const std::shared_ptr<Sink> m_previous;
+  std::mutex m_mutex;
+  std::vector<Record> m_records;
+};
+} // namespace io
+} // namespace smtk
+
+namespace
+{
+// The innermost active capture on this thread.
+thread_local std::shared_ptr<smtk::io::Logger::Capture::Sink> t_captures;
+} // namespace
+
 namespace smtk
 {
 namespace io
 {
 Logger Logger::m_instance;
 
+Logger::Capture::Scope::Scope(const Context& context)
+  : m_previous(t_captures)
+{
+  t_captures = std::static_pointer_cast<Sink>(context);
+}
+
+Logger::Capture::Scope::~Scope()
+{
+  t_captures = m_previous;
+}
+
+Logger::Capture::Capture(const Logger& logger)
+  : m_sink(std::make_shared<Sink>(&logger, t_captures))
+{
+  t_captures = m_sink;
+}
+
+Logger::Capture::~Capture()
+{
+  // Captures are destroyed in reverse order of construction on the thread
+  // that constructed them.
+  if (t_captures == m_sink)
+  {
+    t_captures = m_sink->m_previous;
+  }
+}
+
+Logger::Capture::Context Logger::Capture::context()
+{
+  return t_captures;
+}
+
+std::vector<Logger::Record> Logger::Capture::records() const
+{
+  std::lock_guard<std::mutex> lock(m_sink->m_mutex);
+  return m_sink->m_records;
+}
+
+void Logger::captureRecord(const Record& record) const
+{
+  for (Capture::Sink* sink = t_captures.get(); sink != nullptr; sink = sink->m_previous.get())
+  {
+    if (sink->m_logger == this)
+    {
+      std::lock_guard<std::mutex> lock(sink->m_mutex);
+      sink->m_records.push_back(record);
+    }
+  }
+}
+
 Logger& Logger::instance()
 {
   return Logger::m_instance;
@@ -47,12 +126,18 @@ void Logger::addRecord(
   const std::string& fname,
   unsigned int line)
 {
+  Record record(s, m, fname, line);
+  if (t_captures)
+  {
+    this->captureRecord(record);
+  }
+
   std::lock_guard<std::mutex> lock(m_mutex);
   if ((s == Logger::ERROR) || (s == Logger::FATAL))
   {
     m_hasErrors = true;
   }
-  m_records.emplace_back(s, m, fname, line);
+  m_records.push_back(std::move(record));
   std::size_t nr = this->numberOfRecords();
   this->flushRecordsToStream(nr - 1, nr);
 }
@@ -65,6 +150,14 @@ void Logger::append(const Logger& l)
     return;
   }
 
+  if (t_captures)
+  {
+    for (const auto& record : l.m_records)
+    {
+      this->captureRecord(record);
+    }
+  }
+
   std::lock_guard<std::mutex> lock(m_mutex);
   m_records.insert(m_records.end(), l.m_records.begin(), l.m_records.end());
   if (l.m_hasErrors)
@@ -88,6 +181,17 @@ std::vector<Logger::Record> Logger::records() const
   return m_records;
 }
 
+std::vector<Logger::Record> Logger::records(std::size_t begin, std::size_t end) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  end = std::min(end, m_records.size());
+  if (begin >= end)
+  {
+    return std::vector<Record>();
+  }
+  return std::vector<Record>(m_records.begin() + begin, m_records.begin() + end);
+}
+
 Logger::Record Logger::record(std::size_t i) const
 {
   std::lock_guard<std::mutex> lock(m_mutex);
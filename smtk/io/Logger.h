@@ -15,6 +15,7 @@
 #include "smtk/SystemConfig.h"
 #include <functional>
 #include <iosfwd>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -121,6 +122,57 @@ public:
     Record() = default;
   };
 
+  /**\brief Collect the records that the calling thread adds to a logger
+   *        while the capture is in scope.
+   *
+   * Captured records are stored with the capture itself, so retrieving them
+   * does not copy (or lock) the logger's full record history and costs
+   * time proportional to the number of records captured. Captures may be
+   * nested; records are delivered to every active capture of the logger on
+   * the calling thread. Records added by other threads are not captured
+   * unless those threads install the calling thread's context() with a
+   * Scope; smtk::common::Executor does this for every task it runs, so
+   * records added by tasks submitted while a capture is active are captured.
+   */
+  class SMTKCORE_EXPORT Capture
+  {
+  public:
+    struct Sink;
+
+    /// An opaque handle to the captures active on a thread.
+    typedef std::shared_ptr<void> Context;
+
+    /// Install a \a context obtained from another thread on the calling
+    /// thread for the lifetime of the scope.
+    class SMTKCORE_EXPORT Scope
+    {
+    public:
+      Scope(const Context& context);
+      Scope(const Scope&) = delete;
+      Scope& operator=(const Scope&) = delete;
+      ~Scope();
+
+    private:
+      std::shared_ptr<Sink> m_previous;
+    };
+
+    Capture(const Logger& logger);
+    Capture(const Capture&) = delete;
+    Capture& operator=(const Capture&) = delete;
+    ~Capture();
+
+    /// Return the captures active on the calling thread.
+    static Context context();
+
+    /// Return a copy of the records captured since the capture was constructed.
+    std::vector<Record> records() const;
+
+  private:
+    friend class Logger;
+
+    std::shared_ptr<Sink> m_sink;
+  };
+
   Logger() = default;
 
   Logger(const Logger& logger)
@@ -145,6 +197,8 @@ public:
   /// Note - the reason a copy of the records is returned instead of a reference is to make
   /// the call threadsafe
   std::vector<Record> records() const;
+  ///\brief Return a copy of the records in the range [\a begin, \a end)
+  std::vector<Record> records(std::size_t begin, std::size_t end) const;
   ///\brief Return a copy of the ith record in the logger
   Record record(std::size_t i) const;
 
@@ -172,6 +226,7 @@ public:
 
 protected:
   void flushRecordsToStream(std::size_t beginRec, std::size_t endRec);
+  void captureRecord(const Record& record) const;
   std::string toStringInternal(std::size_t i, std::size_t j, bool includeSourceLoc = false) const;
 
   bool m_hasErrors{ false };
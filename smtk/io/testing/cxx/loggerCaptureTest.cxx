@@ -0,0 +1,81 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/common/Executor.h"
+#include "smtk/io/Logger.h"
+#include <iostream>
+#include <thread>
+
+int main()
+{
+  smtk::io::Logger logger;
+  smtkInfoMacro(logger, "before capture");
+
+  std::size_t outer = 0;
+  std::size_t inner = 0;
+  {
+    smtk::io::Logger::Capture outerCapture(logger);
+    smtkWarningMacro(logger, "outer");
+    {
+      smtk::io::Logger::Capture innerCapture(logger);
+      smtkErrorMacro(logger, "inner");
+
+      // Records from other threads and other loggers are not captured.
+      std::thread other([&logger]() { smtkInfoMacro(logger, "other thread"); });
+      other.join();
+      smtk::io::Logger unrelated;
+      smtkInfoMacro(unrelated, "other logger");
+
+      inner = innerCapture.records().size();
+    }
+    smtkInfoMacro(logger, "outer again");
+    outer = outerCapture.records().size();
+  }
+  smtkInfoMacro(logger, "after capture");
+
+  if (inner != 1 || outer != 3)
+  {
+    std::cerr << "Captured " << inner << " inner and " << outer
+              << " outer records; expected 1 and 3.\n";
+    return -1;
+  }
+  if (logger.numberOfRecords() != 6)
+  {
+    std::cerr << "Wrong number of records!  Got " << logger.numberOfRecords()
+              << " Should be 6!\n";
+    return -1;
+  }
+
+  auto range = logger.records(1, 3);
+  if (range.size() != 2 || range[0].message != "outer" || range[1].message != "inner")
+  {
+    std::cerr << "Record range is incorrect.\n";
+    return -1;
+  }
+
+  // Records added by executor tasks are captured by the captures active where
+  // the tasks were submitted.
+  std::size_t executed = 0;
+  {
+    smtk::common::Executor executor(2);
+    smtk::io::Logger::Capture capture(logger);
+    executor.submit([&logger]() { smtkInfoMacro(logger, "submitted task"); }).get();
+    executor.parallelFor(0, 8, 1, [&logger](std::size_t first, std::size_t) {
+      smtkInfoMacro(logger, "parallel chunk " << first);
+    });
+    executed = capture.records().size();
+  }
+  if (executed != 9)
+  {
+    std::cerr << "Captured " << executed << " executor records; expected 9.\n";
+    return -1;
+  }
+  return 0;
+}
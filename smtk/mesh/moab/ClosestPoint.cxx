@@ -17,6 +17,8 @@
 #include "smtk/mesh/moab/Interface.h"
 #include "smtk/mesh/moab/PointLocatorCache.h"
 
+#include <algorithm>
+
 namespace smtk
 {
 namespace mesh
@@ -46,47 +48,86 @@ std::array<double, 3> ClosestPoint::operator()(
 std::array<double, 3> ClosestPoint::operator()(
   const smtk::mesh::MeshSet& meshset,
   const std::array<double, 3>& point) const
+{
+  std::array<double, 3> returnValue;
+  this->closestPoints(meshset, point.data(), 1, returnValue.data());
+  return returnValue;
+}
+
+void ClosestPoint::closestPoints(
+  const smtk::resource::Component::Ptr& component,
+  const double* points,
+  std::size_t numberOfPoints,
+  double* closest) const
+{
+  auto meshComponent = std::dynamic_pointer_cast<smtk::mesh::Component>(component);
+  if (meshComponent)
+  {
+    this->closestPoints(meshComponent->mesh(), points, numberOfPoints, closest);
+    return;
+  }
+
+  auto modelComponent = std::dynamic_pointer_cast<smtk::model::Entity>(component);
+  if (modelComponent)
+  {
+    this->closestPoints(
+      modelComponent->referenceAs<smtk::model::EntityRef>().meshTessellation(),
+      points,
+      numberOfPoints,
+      closest);
+    return;
+  }
+
+  this->Parent::closestPoints(component, points, numberOfPoints, closest);
+}
+
+void ClosestPoint::closestPoints(
+  const smtk::mesh::MeshSet& meshset,
+  const double* points,
+  std::size_t numberOfPoints,
+  double* closest) const
 {
   static constexpr const double nan = std::numeric_limits<double>::quiet_NaN();
-  std::array<double, 3> returnValue{ { nan, nan, nan } };
+  std::fill(closest, closest + 3 * numberOfPoints, nan);
 
   // If the entity has a mesh tessellation, and the mesh backend is moab, and
   // the tessellation has triangles...
   if (
-    meshset.isValid() && meshset.resource()->interfaceName() == "moab" &&
-    meshset.types().hasCell(smtk::mesh::Triangle))
+    !meshset.isValid() || meshset.resource()->interfaceName() != "moab" ||
+    !meshset.types().hasCell(smtk::mesh::Triangle))
   {
-    PointLocatorCache& pointLocatorCache = meshset.resource()->queries().cache<PointLocatorCache>();
+    return;
+  }
 
-    //...then we can use Moab's AdaptiveKDTree to find closest points.
-    const smtk::mesh::moab::InterfacePtr& interface =
-      std::static_pointer_cast<smtk::mesh::moab::Interface>(meshset.resource()->interface());
+  PointLocatorCache& pointLocatorCache = meshset.resource()->queries().cache<PointLocatorCache>();
 
-    auto search = pointLocatorCache.m_caches.find(meshset.id());
-    if (search == pointLocatorCache.m_caches.end())
-    {
-      // This option restricts the KD tree from subdividing too much
-      ::moab::FileOptions treeOptions("MAX_DEPTH=13");
-
-      search =
-        pointLocatorCache.m_caches
-          .emplace(std::make_pair(
-            meshset.id(),
-            std::unique_ptr<PointLocatorCache::CacheForIndex>(new PointLocatorCache::CacheForIndex(
-              interface->moabInterface(), smtkToMOABRange(meshset.cells().range()), &treeOptions))))
-          .first;
-    }
+  //...then we can use Moab's AdaptiveKDTree to find closest points.
+  const smtk::mesh::moab::InterfacePtr& interface =
+    std::static_pointer_cast<smtk::mesh::moab::Interface>(meshset.resource()->interface());
 
-    ::moab::EntityHandle triangleOut;
+  auto cacheForIndex = pointLocatorCache.get(meshset.id(), [&]() {
+    // This option restricts the KD tree from subdividing too much
+    ::moab::FileOptions treeOptions("MAX_DEPTH=13");
+
+    return std::make_shared<PointLocatorCache::CacheForIndex>(
+      interface->moabInterface(), smtkToMOABRange(meshset.cells().range()), &treeOptions);
+  });
+
+  ::moab::EntityHandle triangleOut;
+  ::moab::Range connectivity;
+  std::array<double, 9> coords;
+  for (std::size_t i = 0; i < numberOfPoints; ++i)
+  {
+    const double* point = points + 3 * i;
+    double* returnValue = closest + 3 * i;
 
     // Identify the nearest point and the associated triangle
-    search->second->m_tree.closest_triangle(
-      search->second->m_treeRootSet, point.data(), returnValue.data(), triangleOut);
+    cacheForIndex->m_tree.closest_triangle(
+      cacheForIndex->m_treeRootSet, point, returnValue, triangleOut);
 
     // ...access the three vertices of the nearest triangle
-    ::moab::Range connectivity;
+    connectivity.clear();
     interface->moabInterface()->get_connectivity(&triangleOut, 1, connectivity);
-    std::array<double, 9> coords;
     interface->moabInterface()->get_coords(connectivity, coords.data());
 
     // Compute the squared distance betwen the source point and the vertex
@@ -107,8 +148,6 @@ std::array<double, 3> ClosestPoint::operator()(
       returnValue[j] = coords[3 * index + j];
     }
   }
-
-  return returnValue;
 }
 } // namespace moab
 } // namespace mesh
@@ -40,6 +40,18 @@ struct SMTKCORE_EXPORT ClosestPoint
     const std::array<double, 3>&) const override;
 
   std::array<double, 3> operator()(const smtk::mesh::MeshSet&, const std::array<double, 3>&) const;
+
+  void closestPoints(
+    const smtk::resource::Component::Ptr&,
+    const double* points,
+    std::size_t numberOfPoints,
+    double* closest) const override;
+
+  void closestPoints(
+    const smtk::mesh::MeshSet&,
+    const double* points,
+    std::size_t numberOfPoints,
+    double* closest) const;
 };
 } // namespace moab
 } // namespace mesh
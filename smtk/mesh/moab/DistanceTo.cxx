@@ -17,6 +17,9 @@
 #include "smtk/mesh/moab/Interface.h"
 #include "smtk/mesh/moab/PointLocatorCache.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace smtk
 {
 namespace mesh
@@ -46,54 +49,99 @@ std::pair<double, std::array<double, 3>> DistanceTo::operator()(
 std::pair<double, std::array<double, 3>> DistanceTo::operator()(
   const smtk::mesh::MeshSet& meshset,
   const std::array<double, 3>& point) const
+{
+  std::pair<double, std::array<double, 3>> returnValue;
+  this->distances(meshset, point.data(), 1, &returnValue.first, returnValue.second.data());
+  return returnValue;
+}
+
+void DistanceTo::distances(
+  const smtk::resource::Component::Ptr& component,
+  const double* points,
+  std::size_t numberOfPoints,
+  double* distances,
+  double* closest) const
+{
+  auto meshComponent = std::dynamic_pointer_cast<smtk::mesh::Component>(component);
+  if (meshComponent)
+  {
+    this->distances(meshComponent->mesh(), points, numberOfPoints, distances, closest);
+    return;
+  }
+
+  auto modelComponent = std::dynamic_pointer_cast<smtk::model::Entity>(component);
+  if (modelComponent)
+  {
+    this->distances(
+      modelComponent->referenceAs<smtk::model::EntityRef>().meshTessellation(),
+      points,
+      numberOfPoints,
+      distances,
+      closest);
+    return;
+  }
+
+  this->Parent::distances(component, points, numberOfPoints, distances, closest);
+}
+
+void DistanceTo::distances(
+  const smtk::mesh::MeshSet& meshset,
+  const double* points,
+  std::size_t numberOfPoints,
+  double* distances,
+  double* closest) const
 {
   static constexpr const double nan = std::numeric_limits<double>::quiet_NaN();
-  std::pair<double, std::array<double, 3>> returnValue(nan, { { nan, nan, nan } });
+  std::fill(distances, distances + numberOfPoints, nan);
+  if (closest)
+  {
+    std::fill(closest, closest + 3 * numberOfPoints, nan);
+  }
 
   // If the entity has a mesh tessellation, and the mesh backend is moab, and
   // the tessellation has triangles...
   if (
-    meshset.isValid() && meshset.resource()->interfaceName() == "moab" &&
-    meshset.types().hasCell(smtk::mesh::Triangle))
+    !meshset.isValid() || meshset.resource()->interfaceName() != "moab" ||
+    !meshset.types().hasCell(smtk::mesh::Triangle))
   {
-    PointLocatorCache& pointLocatorCache = meshset.resource()->queries().cache<PointLocatorCache>();
+    return;
+  }
 
-    //...then we can use Moab's AdaptiveKDTree to find closest points.
-    const smtk::mesh::moab::InterfacePtr& interface =
-      std::static_pointer_cast<smtk::mesh::moab::Interface>(meshset.resource()->interface());
+  PointLocatorCache& pointLocatorCache = meshset.resource()->queries().cache<PointLocatorCache>();
 
-    auto search = pointLocatorCache.m_caches.find(meshset.id());
-    if (search == pointLocatorCache.m_caches.end())
-    {
-      // This option restricts the KD tree from subdividing too much
-      ::moab::FileOptions treeOptions("MAX_DEPTH=13");
-
-      search =
-        pointLocatorCache.m_caches
-          .emplace(std::make_pair(
-            meshset.id(),
-            std::unique_ptr<PointLocatorCache::CacheForIndex>(new PointLocatorCache::CacheForIndex(
-              interface->moabInterface(), smtkToMOABRange(meshset.cells().range()), &treeOptions))))
-          .first;
-    }
+  //...then we can use Moab's AdaptiveKDTree to find closest points.
+  const smtk::mesh::moab::InterfacePtr& interface =
+    std::static_pointer_cast<smtk::mesh::moab::Interface>(meshset.resource()->interface());
+
+  auto cacheForIndex = pointLocatorCache.get(meshset.id(), [&]() {
+    // This option restricts the KD tree from subdividing too much
+    ::moab::FileOptions treeOptions("MAX_DEPTH=13");
 
-    ::moab::EntityHandle triangleOut;
+    return std::make_shared<PointLocatorCache::CacheForIndex>(
+      interface->moabInterface(), smtkToMOABRange(meshset.cells().range()), &treeOptions);
+  });
+
+  ::moab::EntityHandle triangleOut;
+  std::array<double, 3> nearest;
+  for (std::size_t i = 0; i < numberOfPoints; ++i)
+  {
+    const double* point = points + 3 * i;
 
     // Identify the nearest point and the associated triangle
-    // cacheForIndex->m_tree.closest_triangle(
-    //   cacheForIndex->m_treeRootSet, &point[0], &returnValue.second[0], triangleOut);
-    search->second->m_tree.closest_triangle(
-      search->second->m_treeRootSet, &point[0], &returnValue.second[0], triangleOut);
+    cacheForIndex->m_tree.closest_triangle(
+      cacheForIndex->m_treeRootSet, point, nearest.data(), triangleOut);
 
-    returnValue.first = 0.;
-    for (int i = 0; i < 3; i++)
+    double distance2 = 0.;
+    for (int j = 0; j < 3; j++)
     {
-      returnValue.first += (point[i] - returnValue.second[i]) * (point[i] - returnValue.second[i]);
+      distance2 += (point[j] - nearest[j]) * (point[j] - nearest[j]);
+    }
+    distances[i] = sqrt(distance2);
+    if (closest)
+    {
+      std::copy(nearest.begin(), nearest.end(), closest + 3 * i);
     }
-    returnValue.first = sqrt(returnValue.first);
   }
-
-  return returnValue;
 }
 } // namespace moab
 } // namespace mesh
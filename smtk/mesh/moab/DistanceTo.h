@@ -45,6 +45,20 @@ struct SMTKCORE_EXPORT DistanceTo
   std::pair<double, std::array<double, 3>> operator()(
     const smtk::mesh::MeshSet&,
     const std::array<double, 3>&) const;
+
+  void distances(
+    const smtk::resource::Component::Ptr&,
+    const double* points,
+    std::size_t numberOfPoints,
+    double* distances,
+    double* closest = nullptr) const override;
+
+  void distances(
+    const smtk::mesh::MeshSet&,
+    const double* points,
+    std::size_t numberOfPoints,
+    double* distances,
+    double* closest = nullptr) const;
 };
 } // namespace moab
 } // namespace mesh
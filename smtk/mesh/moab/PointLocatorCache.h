@@ -13,7 +13,7 @@
 
 #include "smtk/CoreExports.h"
 
-#include "smtk/operation/queries/SynchronizedCache.h"
+#include "smtk/operation/queries/ComponentCache.h"
 
 SMTK_THIRDPARTY_PRE_INCLUDE
 #include "moab/AdaptiveKDTree.hpp"
@@ -28,43 +28,27 @@ namespace mesh
 namespace moab
 {
 
-struct SMTKCORE_EXPORT PointLocatorCache : public smtk::operation::SynchronizedCache
+struct PointLocatorCacheForIndex
 {
-  struct CacheForIndex
+  PointLocatorCacheForIndex(
+    ::moab::Interface* interface,
+    const ::moab::Range& range,
+    ::moab::FileOptions* fileOptions)
+    : m_interface(interface)
+    , m_tree(m_interface, range, &m_treeRootSet, fileOptions)
   {
-    CacheForIndex(
-      ::moab::Interface* interface,
-      const ::moab::Range& range,
-      ::moab::FileOptions* fileOptions)
-      : m_interface(interface)
-      , m_tree(m_interface, range, &m_treeRootSet, fileOptions)
-    {
-    }
-
-    ::moab::Interface* m_interface;
-    ::moab::EntityHandle m_treeRootSet;
-    ::moab::AdaptiveKDTree m_tree;
-  };
-
-  PointLocatorCache() = default;
-  ~PointLocatorCache() override = default;
-  PointLocatorCache(const PointLocatorCache&) = delete;
-  PointLocatorCache(PointLocatorCache&& rhs) noexcept
-    : m_caches(std::move(rhs.m_caches))
-  {
-  }
-
-  PointLocatorCache& operator=(const PointLocatorCache&) = delete;
-  PointLocatorCache& operator=(PointLocatorCache&& rhs) noexcept
-  {
-    m_caches = std::move(rhs.m_caches);
-    return *this;
   }
 
-  void synchronize(const smtk::operation::Operation&, const smtk::operation::Operation::Result&)
-    override;
+  ::moab::Interface* m_interface;
+  ::moab::EntityHandle m_treeRootSet;
+  ::moab::AdaptiveKDTree m_tree;
+};
 
-  std::unordered_map<smtk::common::UUID, std::unique_ptr<CacheForIndex>> m_caches;
+/// A cache of KD trees used to locate points on the triangles of a meshset,
+/// keyed by the meshset's id.
+struct PointLocatorCache : public smtk::operation::ComponentCache<PointLocatorCacheForIndex>
+{
+  typedef PointLocatorCacheForIndex CacheForIndex;
 };
 } // namespace moab
 } // namespace mesh
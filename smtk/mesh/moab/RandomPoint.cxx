@@ -23,6 +23,7 @@ SMTK_THIRDPARTY_PRE_INCLUDE
 #include "moab/CartVect.hpp"
 SMTK_THIRDPARTY_POST_INCLUDE
 
+#include <algorithm>
 #include <cmath>
 #include <random>
 
@@ -67,6 +68,41 @@ std::array<double, 3> RandomPoint::operator()(const smtk::resource::Component::P
 }
 
 std::array<double, 3> RandomPoint::operator()(const smtk::mesh::MeshSet& meshset) const
+{
+  std::array<double, 3> returnValue;
+  this->randomPoints(meshset, 1, returnValue.data());
+  return returnValue;
+}
+
+void RandomPoint::randomPoints(
+  const smtk::resource::Component::Ptr& component,
+  std::size_t numberOfPoints,
+  double* points) const
+{
+  auto meshComponent = std::dynamic_pointer_cast<smtk::mesh::Component>(component);
+  if (meshComponent)
+  {
+    this->randomPoints(meshComponent->mesh(), numberOfPoints, points);
+    return;
+  }
+
+  auto modelComponent = std::dynamic_pointer_cast<smtk::model::Entity>(component);
+  if (modelComponent)
+  {
+    this->randomPoints(
+      modelComponent->referenceAs<smtk::model::EntityRef>().meshTessellation(),
+      numberOfPoints,
+      points);
+    return;
+  }
+
+  this->Parent::randomPoints(component, numberOfPoints, points);
+}
+
+void RandomPoint::randomPoints(
+  const smtk::mesh::MeshSet& meshset,
+  std::size_t numberOfPoints,
+  double* points) const
 {
   // Select random points on an entity based on the following:
   //
@@ -86,7 +122,7 @@ std::array<double, 3> RandomPoint::operator()(const smtk::mesh::MeshSet& meshset
   //    of the intersection points
 
   static constexpr const double nan = std::numeric_limits<double>::quiet_NaN();
-  std::array<double, 3> returnValue{ { nan, nan, nan } };
+  std::fill(points, points + 3 * numberOfPoints, nan);
 
   // If the entity has a mesh tessellation, and the mesh backend is moab, and
   // the tessellation has triangles...
@@ -100,22 +136,15 @@ std::array<double, 3> RandomPoint::operator()(const smtk::mesh::MeshSet& meshset
 
     PointLocatorCache& pointLocatorCache = meshset.resource()->queries().cache<PointLocatorCache>();
 
-    auto search = pointLocatorCache.m_caches.find(meshset.id());
-    if (search == pointLocatorCache.m_caches.end())
-    {
+    auto cacheForIndex = pointLocatorCache.get(meshset.id(), [&]() {
       // This option restricts the KD tree from subdividing too much
       ::moab::FileOptions treeOptions("MAX_DEPTH=13");
 
-      search =
-        pointLocatorCache.m_caches
-          .emplace(std::make_pair(
-            meshset.id(),
-            std::unique_ptr<PointLocatorCache::CacheForIndex>(new PointLocatorCache::CacheForIndex(
-              interface->moabInterface(), smtkToMOABRange(meshset.cells().range()), &treeOptions))))
-          .first;
-    }
+      return std::make_shared<PointLocatorCache::CacheForIndex>(
+        interface->moabInterface(), smtkToMOABRange(meshset.cells().range()), &treeOptions);
+    });
 
-    ::moab::AdaptiveKDTree& tree = search->second->m_tree;
+    ::moab::AdaptiveKDTree& tree = cacheForIndex->m_tree;
 
     // Get the bounding box for the tree
     ::moab::BoundBox box;
@@ -144,83 +173,88 @@ std::array<double, 3> RandomPoint::operator()(const smtk::mesh::MeshSet& meshset
     // Moab's ray intersection algorithm requires a tolerance. So, here it is.
     const double tolerance = 1.e-8;
 
-    bool computed = false;
-    do
+    std::vector<::moab::EntityHandle> trianglesOut;
+    std::vector<double> distanceOut;
+    for (std::size_t n = 0; n < numberOfPoints; ++n)
     {
-      // Select a random point on the surface of our bounding sphere
-      double theta = M_PI * dist(mt);
-      double phi = 2. * M_PI * dist(mt);
-
-      double sinTheta = std::sin(theta);
-      double cosTheta = std::cos(theta);
-      double sinPhi = std::sin(phi);
-      double cosPhi = std::cos(phi);
-
-      const std::array<double, 3> dUnit = { sinTheta * cosPhi, sinTheta * sinPhi, cosTheta };
-      const std::array<double, 3> d = { radius * dUnit[0], radius * dUnit[1], radius * dUnit[2] };
-
-      // Construct a pair of orthonormal vectors tangent to the sphere at the
-      // above random point
-      double sinThetaPlusPiOver2 = std::sin(theta + M_PI / 2.);
-      double cosThetaPlusPiOver2 = std::cos(theta + M_PI / 2.);
-      double sinPhiPlusPiOver2 = std::sin(phi + M_PI / 2.);
-      double cosPhiPlusPiOver2 = std::cos(phi + M_PI / 2.);
-
-      const std::array<double, 3> tangent1 = { sinThetaPlusPiOver2 * cosPhi,
-                                               sinThetaPlusPiOver2 * sinPhi,
-                                               cosThetaPlusPiOver2 };
-      const std::array<double, 3> tangent2 = { sinTheta * cosPhiPlusPiOver2,
-                                               sinTheta * sinPhiPlusPiOver2,
-                                               cosTheta };
-
-      // Construct a random point on a disk with radius equal to the radius of
-      // our bounding sphere
-      double bMag = radius * std::sqrt(dist(mt));
-      double theta2 = 2. * M_PI * dist(mt);
-
-      double sinTheta2 = std::sin(theta2);
-      double cosTheta2 = std::cos(theta2);
-
-      const std::array<double, 2> b = { bMag * cosTheta2, bMag * sinTheta2 };
-
-      // Superimpose the second random point onto the tangent plane of our
-      // bounding sphere, and offset the point according to the bounding
-      // sphere's origin.
-      std::array<double, 3> p = d;
-      for (unsigned int i = 0; i < 3; i++)
+      double* returnValue = points + 3 * n;
+      bool computed = false;
+      do
       {
-        p[i] += b[0] * tangent1[i] + b[1] * tangent2[i] + origin[i];
-      }
-
-      // Finally, the ray trajectory is simply the negative unit d vector
-      std::array<double, 3> dir = { -dUnit[0], -dUnit[1], -dUnit[2] };
-
-      // Compute the intersection of our ray and the surface
-      std::vector<::moab::EntityHandle> trianglesOut;
-      std::vector<double> distanceOut;
-      tree.ray_intersect_triangles(
-        search->second->m_treeRootSet,
-        tolerance,
-        dir.data(),
-        p.data(),
-        trianglesOut,
-        distanceOut,
-        0,
-        diameter);
-
-      if (!distanceOut.empty())
-      {
-        // We randomly select which intersection site to use as our sample point
-        std::size_t index = static_cast<std::size_t>(distanceOut.size() * dist(mt));
-        for (std::size_t i = 0; i < 3; i++)
+        // Select a random point on the surface of our bounding sphere
+        double theta = M_PI * dist(mt);
+        double phi = 2. * M_PI * dist(mt);
+
+        double sinTheta = std::sin(theta);
+        double cosTheta = std::cos(theta);
+        double sinPhi = std::sin(phi);
+        double cosPhi = std::cos(phi);
+
+        const std::array<double, 3> dUnit = { sinTheta * cosPhi, sinTheta * sinPhi, cosTheta };
+        const std::array<double, 3> d = { radius * dUnit[0], radius * dUnit[1], radius * dUnit[2] };
+
+        // Construct a pair of orthonormal vectors tangent to the sphere at the
+        // above random point
+        double sinThetaPlusPiOver2 = std::sin(theta + M_PI / 2.);
+        double cosThetaPlusPiOver2 = std::cos(theta + M_PI / 2.);
+        double sinPhiPlusPiOver2 = std::sin(phi + M_PI / 2.);
+        double cosPhiPlusPiOver2 = std::cos(phi + M_PI / 2.);
+
+        const std::array<double, 3> tangent1 = { sinThetaPlusPiOver2 * cosPhi,
+                                                 sinThetaPlusPiOver2 * sinPhi,
+                                                 cosThetaPlusPiOver2 };
+        const std::array<double, 3> tangent2 = { sinTheta * cosPhiPlusPiOver2,
+                                                 sinTheta * sinPhiPlusPiOver2,
+                                                 cosTheta };
+
+        // Construct a random point on a disk with radius equal to the radius of
+        // our bounding sphere
+        double bMag = radius * std::sqrt(dist(mt));
+        double theta2 = 2. * M_PI * dist(mt);
+
+        double sinTheta2 = std::sin(theta2);
+        double cosTheta2 = std::cos(theta2);
+
+        const std::array<double, 2> b = { bMag * cosTheta2, bMag * sinTheta2 };
+
+        // Superimpose the second random point onto the tangent plane of our
+        // bounding sphere, and offset the point according to the bounding
+        // sphere's origin.
+        std::array<double, 3> p = d;
+        for (unsigned int i = 0; i < 3; i++)
+        {
+          p[i] += b[0] * tangent1[i] + b[1] * tangent2[i] + origin[i];
+        }
+
+        // Finally, the ray trajectory is simply the negative unit d vector
+        std::array<double, 3> dir = { -dUnit[0], -dUnit[1], -dUnit[2] };
+
+        // Compute the intersection of our ray and the surface
+        trianglesOut.clear();
+        distanceOut.clear();
+        tree.ray_intersect_triangles(
+          cacheForIndex->m_treeRootSet,
+          tolerance,
+          dir.data(),
+          p.data(),
+          trianglesOut,
+          distanceOut,
+          0,
+          diameter);
+
+        if (!distanceOut.empty())
         {
-          returnValue[i] = p[i] + distanceOut[index] * dir[i];
+          // We randomly select which intersection site to use as our sample point
+          std::size_t index = static_cast<std::size_t>(distanceOut.size() * dist(mt));
+          for (std::size_t i = 0; i < 3; i++)
+          {
+            returnValue[i] = p[i] + distanceOut[index] * dir[i];
+          }
+          computed = true;
         }
-        computed = true;
-      }
-    } while (!computed);
+      } while (!computed);
+    }
   }
-  return returnValue;
 }
 } // namespace moab
 } // namespace mesh
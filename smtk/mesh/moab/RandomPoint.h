@@ -39,6 +39,13 @@ struct SMTKCORE_EXPORT RandomPoint
 
   std::array<double, 3> operator()(const smtk::mesh::MeshSet&) const;
 
+  void randomPoints(
+    const smtk::resource::Component::Ptr&,
+    std::size_t numberOfPoints,
+    double* points) const override;
+
+  void randomPoints(const smtk::mesh::MeshSet&, std::size_t numberOfPoints, double* points) const;
+
   void seed(std::size_t seed) override { m_seed = seed; }
 
 private:
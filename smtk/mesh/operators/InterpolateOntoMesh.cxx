@@ -122,6 +122,72 @@ std::function<double(std::array<double, 3>)> inverseDistanceWeightingFrom(
 
   return idw;
 }
+
+// The contents of a mesh's field before the operation overwrites it, so that
+// a canceled operation can restore the field (or remove it, if the operation
+// created it).
+class FieldBackup
+{
+public:
+  FieldBackup(const smtk::mesh::MeshSet& mesh, const std::string& name, bool cellField)
+    : m_mesh(mesh)
+    , m_name(name)
+    , m_cellField(cellField)
+  {
+    if (m_cellField)
+    {
+      this->save(smtk::mesh::CellField(m_mesh, m_name));
+    }
+    else
+    {
+      this->save(smtk::mesh::PointField(m_mesh, m_name));
+    }
+  }
+
+  void restore()
+  {
+    if (m_cellField)
+    {
+      m_mesh.removeCellField(smtk::mesh::CellField(m_mesh, m_name));
+      if (m_existed)
+      {
+        m_mesh.createCellField(m_name, m_dimension, m_type, m_data.data());
+      }
+    }
+    else
+    {
+      m_mesh.removePointField(smtk::mesh::PointField(m_mesh, m_name));
+      if (m_existed)
+      {
+        m_mesh.createPointField(m_name, m_dimension, m_type, m_data.data());
+      }
+    }
+  }
+
+private:
+  template<typename FieldType>
+  void save(const FieldType& field)
+  {
+    m_existed = field.isValid();
+    if (m_existed)
+    {
+      m_dimension = static_cast<int>(field.dimension());
+      m_type = field.type();
+      std::size_t valueSize =
+        (m_type == smtk::mesh::FieldType::Double ? sizeof(double) : sizeof(int));
+      m_data.resize(field.size() * field.dimension() * valueSize);
+      field.get(m_data.data());
+    }
+  }
+
+  smtk::mesh::MeshSet m_mesh;
+  std::string m_name;
+  bool m_cellField;
+  bool m_existed{ false };
+  int m_dimension{ 0 };
+  smtk::mesh::FieldType m_type{ smtk::mesh::FieldType::Double };
+  std::vector<char> m_data;
+};
 } // namespace
 
 namespace smtk
@@ -370,7 +436,39 @@ InterpolateOntoMesh::Result InterpolateOntoMesh::operateInternal()
   // Mark the modified mesh components to update their representative geometry
   smtk::operation::MarkGeometry markGeometry(resource);
 
+  // Count the points (or cells) to be evaluated so we can report progress.
+  std::size_t numberOfEvaluations = 0;
+  for (std::size_t i = 0; i < meshItem->numberOfValues(); i++)
+  {
+    smtk::mesh::MeshSet mesh = meshItem->valueAs<smtk::mesh::Component>(i)->mesh();
+    numberOfEvaluations += (modeItem->value(0) == CELL_FIELD ? mesh.cells().size()
+                                                             : mesh.points().size());
+  }
+
+  // Progress is reported (and cancellation is checked) every so many
+  // evaluations. Once canceled, the remaining evaluations are skipped.
+  const std::size_t progressStride = 4096;
+  std::size_t evaluated = 0;
+  bool canceled = false;
+
+  // The fraction of evaluations performed (meshes without points or cells
+  // require none, so they are complete as soon as they are visited).
+  auto fractionEvaluated = [&]() {
+    return numberOfEvaluations > 0
+      ? static_cast<double>(evaluated) / static_cast<double>(numberOfEvaluations)
+      : 1.;
+  };
+
   std::function<double(std::array<double, 3>)> fn = [&](std::array<double, 3> x) {
+    if (canceled)
+    {
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (++evaluated % progressStride == 0)
+    {
+      canceled = !this->reportProgress(fractionEvaluated());
+    }
+
     double f_x = postProcess(interpolation(x));
     if (std::isnan(f_x))
     {
@@ -381,11 +479,13 @@ InterpolateOntoMesh::Result InterpolateOntoMesh::operateInternal()
   };
 
   // apply the interpolator to the meshes and populate the result attributes
+  std::vector<FieldBackup> backups;
   for (std::size_t i = 0; i < meshItem->numberOfValues(); i++)
   {
     smtk::mesh::Component::Ptr meshComponent = meshItem->valueAs<smtk::mesh::Component>(i);
     smtk::mesh::MeshSet mesh = meshComponent->mesh();
 
+    backups.emplace_back(mesh, nameItem->value(), modeItem->value(0) == CELL_FIELD);
     if (modeItem->value(0) == CELL_FIELD)
     {
       smtk::mesh::utility::applyScalarCellField(fn, nameItem->value(), mesh);
@@ -395,6 +495,19 @@ InterpolateOntoMesh::Result InterpolateOntoMesh::operateInternal()
       smtk::mesh::utility::applyScalarPointField(fn, nameItem->value(), mesh);
     }
 
+    if (canceled || !this->reportProgress(fractionEvaluated()))
+    {
+      // Restore the fields written so far (removing those this operation
+      // created) so that a canceled operation leaves the meshes unchanged.
+      // Meshes may share cells or points, so backups are restored in reverse
+      // order to undo each write on top of the ones preceding it.
+      for (auto it = backups.rbegin(); it != backups.rend(); ++it)
+      {
+        it->restore();
+      }
+      return this->createResult(smtk::operation::Operation::Outcome::CANCELED);
+    }
+
     modified->appendValue(meshComponent);
     markGeometry.markModified(meshComponent);
 
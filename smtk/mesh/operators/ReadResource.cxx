@@ -21,6 +21,7 @@
 #include "smtk/common/CompilerInformation.h"
 #include "smtk/common/FileLocation.h"
 #include "smtk/common/Paths.h"
+#include "smtk/common/json/jsonBinary.h"
 
 #include "smtk/io/ReadMesh.h"
 
@@ -57,7 +58,7 @@ ReadResource::Result ReadResource::operateInternal()
   }
   else
   {
-    file.open(filename);
+    file.open(filename, std::ios::in | std::ios::binary);
   }
 
   if (!file.good())
@@ -70,7 +71,7 @@ ReadResource::Result ReadResource::operateInternal()
   nlohmann::json j;
   try
   {
-    j = nlohmann::json::parse(file);
+    j = smtk::common::BinaryJSON::parse(file);
   }
   catch (...)
   {
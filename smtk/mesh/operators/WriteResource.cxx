@@ -19,6 +19,7 @@
 #include "smtk/common/Archive.h"
 #include "smtk/common/CompilerInformation.h"
 #include "smtk/common/Paths.h"
+#include "smtk/common/json/jsonBinary.h"
 
 #include "smtk/mesh/WriteResource_xml.h"
 #include "smtk/mesh/core/Resource.h"
@@ -66,6 +67,8 @@ WriteResource::Result WriteResource::operateInternal()
   smtk::mesh::Resource::Ptr resource =
     std::dynamic_pointer_cast<smtk::mesh::Resource>(resourceItem->value());
 
+  bool binary = smtk::common::BinaryJSON::isBinaryLocation(resource->location());
+
   // Serialize resource into a set of JSON records:
   nlohmann::json j = resource;
   if (j.is_null())
@@ -95,13 +98,13 @@ WriteResource::Result WriteResource::operateInternal()
 
     // Write the smtk index
     {
-      std::ofstream file(tmpsmtkPath.string());
+      std::ofstream file(tmpsmtkPath.string(), std::ios::out | std::ios::binary);
       if (!file.good())
       {
         smtkErrorMacro(log(), "Unable to open \"" << tmpsmtkPath.string() << "\" for writing.");
         return this->createResult(smtk::operation::Operation::Outcome::FAILED);
       }
-      file << j.dump(2);
+      smtk::common::BinaryJSON::dump(j, file, binary);
       file.close();
     }
 
@@ -156,13 +159,13 @@ WriteResource::Result WriteResource::operateInternal()
     j["Mesh URL"] = meshFilename;
 
     {
-      std::ofstream file(resource->location());
+      std::ofstream file(resource->location(), std::ios::out | std::ios::binary);
       if (!file.good())
       {
         smtkErrorMacro(log(), "Unable to open \"" << resource->location() << "\" for writing.");
         return this->createResult(smtk::operation::Operation::Outcome::FAILED);
       }
-      file << j.dump(2);
+      smtk::common::BinaryJSON::dump(j, file, binary);
       file.close();
     }
 
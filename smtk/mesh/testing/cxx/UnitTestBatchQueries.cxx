@@ -0,0 +1,139 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/core/Component.h"
+#include "smtk/mesh/core/Resource.h"
+
+#include "smtk/mesh/moab/Interface.h"
+
+#include "smtk/geometry/queries/ClosestPoint.h"
+#include "smtk/geometry/queries/DistanceTo.h"
+#include "smtk/geometry/queries/RandomPoint.h"
+
+#include "smtk/mesh/testing/cxx/helpers.h"
+
+#include <cmath>
+#include <vector>
+
+// Check that the moab batch variants of the geometry queries agree with
+// their single-point counterparts when run on a mesh resource.
+
+namespace
+{
+// The unit square in the z = 0 plane, split into two triangles.
+double pts[4][3] = { { 0., 0., 0. }, { 1., 0., 0. }, { 1., 1., 0. }, { 0., 1., 0. } };
+
+const std::vector<double> points = { 0.9, 0.1, 1., 0.5, 0.5, 2., -1., 0.4, 0., 0.2, 0.9, -0.5 };
+const std::size_t numberOfPoints = points.size() / 3;
+
+bool near(double a, double b)
+{
+  return std::abs(a - b) < 1.e-8;
+}
+
+smtk::mesh::ResourcePtr createSquare()
+{
+  smtk::mesh::InterfacePtr iface = smtk::mesh::moab::make_interface();
+  smtk::mesh::ResourcePtr resource = smtk::mesh::Resource::create(iface);
+  smtk::mesh::BufferedCellAllocatorPtr allocator = resource->interface()->bufferedCellAllocator();
+  test(allocator->reserveNumberOfCoordinates(4));
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    test(allocator->setCoordinate(i, pts[i]));
+  }
+  int triangles[2][3] = { { 0, 1, 2 }, { 0, 2, 3 } };
+  for (auto& triangle : triangles)
+  {
+    test(allocator->addCell(smtk::mesh::Triangle, triangle, 3));
+  }
+  test(allocator->flush());
+  resource->createMesh(smtk::mesh::CellSet(resource, allocator->cells()));
+  return resource;
+}
+
+void verify_closest_points(const smtk::resource::ComponentPtr& component)
+{
+  auto& closestPoint = component->resource()->queries().get<smtk::geometry::ClosestPoint>();
+  std::vector<double> closest(points.size());
+  closestPoint.closestPoints(component, points.data(), numberOfPoints, closest.data());
+  for (std::size_t i = 0; i < numberOfPoints; ++i)
+  {
+    auto expected =
+      closestPoint(component, { { points[3 * i], points[3 * i + 1], points[3 * i + 2] } });
+    for (std::size_t j = 0; j < 3; ++j)
+    {
+      test(near(closest[3 * i + j], expected[j]), "Batch closest point differs.");
+    }
+  }
+
+  // Closest points are snapped to the nearest vertex of the nearest triangle.
+  test(
+    near(closest[0], 1.) && near(closest[1], 0.) && near(closest[2], 0.),
+    "Unexpected closest point.");
+}
+
+void verify_distances(const smtk::resource::ComponentPtr& component)
+{
+  auto& distanceTo = component->resource()->queries().get<smtk::geometry::DistanceTo>();
+  std::vector<double> distances(numberOfPoints);
+  std::vector<double> closest(points.size());
+  distanceTo.distances(component, points.data(), numberOfPoints, distances.data(), closest.data());
+  for (std::size_t i = 0; i < numberOfPoints; ++i)
+  {
+    auto expected =
+      distanceTo(component, { { points[3 * i], points[3 * i + 1], points[3 * i + 2] } });
+    test(near(distances[i], expected.first), "Batch distance differs.");
+    for (std::size_t j = 0; j < 3; ++j)
+    {
+      test(near(closest[3 * i + j], expected.second[j]), "Batch closest point differs.");
+    }
+  }
+
+  test(
+    near(distances[0], 1.) && near(distances[1], 2.) && near(distances[2], 1.) &&
+      near(distances[3], 0.5),
+    "Unexpected batch distances.");
+  test(
+    near(closest[3], 0.5) && near(closest[4], 0.5) && near(closest[5], 0.),
+    "Unexpected batch closest point.");
+}
+
+void verify_random_points(const smtk::resource::ComponentPtr& component)
+{
+  auto& randomPoint = component->resource()->queries().get<smtk::geometry::RandomPoint>();
+  randomPoint.seed(1);
+  std::vector<double> random(3 * 16);
+  randomPoint.randomPoints(component, 16, random.data());
+  for (std::size_t i = 0; i < random.size(); i += 3)
+  {
+    test(
+      random[i] >= -1.e-8 && random[i] <= 1. + 1.e-8 && random[i + 1] >= -1.e-8 &&
+        random[i + 1] <= 1. + 1.e-8 && near(random[i + 2], 0.),
+      "Random point not on the square.");
+  }
+
+  auto single = randomPoint(component);
+  test(near(single[2], 0.), "Single random point not on the square.");
+}
+} // namespace
+
+int UnitTestBatchQueries(int /*unused*/, char** const /*unused*/)
+{
+  smtk::mesh::ResourcePtr resource = createSquare();
+  smtk::mesh::MeshSet mesh = resource->meshes();
+  test(mesh.size() == 1, "Expected a single mesh.");
+  smtk::resource::ComponentPtr component = smtk::mesh::Component::create(mesh);
+
+  verify_closest_points(component);
+  verify_distances(component);
+  verify_random_points(component);
+
+  return 0;
+}
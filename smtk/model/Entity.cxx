@@ -49,7 +49,10 @@ using boost::sregex_token_iterator;
 #include <cctype>
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include <sstream>
@@ -124,6 +127,8 @@ EntityPtr Entity::create(BitFlags entityFlags, int dimension, ResourcePtr resour
   */
 EntityPtr Entity::setup(BitFlags entFlags, int dim, Resource::Ptr resource, bool resetRelations)
 {
+  this->materialize();
+  this->topologyModified();
   m_entityFlags = entFlags;
   m_resource = resource;
   // Override the dimension bits if the dimension is specified
@@ -139,6 +144,7 @@ EntityPtr Entity::setup(BitFlags entFlags, int dim, Resource::Ptr resource, bool
     m_firstInvalid = -1;
     m_relations.clear();
   }
+  this->entityTypeModified();
   return shared_from_this();
 }
 
@@ -174,6 +180,7 @@ BitFlags Entity::entityFlags() const
 
 bool Entity::setEntityFlags(BitFlags flags)
 {
+  this->topologyModified();
   bool allowed = false;
   if (m_entityFlags == INVALID)
   {
@@ -191,6 +198,11 @@ bool Entity::setEntityFlags(BitFlags flags)
       allowed = true;
     }
   }
+  if (allowed)
+  {
+    this->entityTypeModified();
+    this->resourceTopologyModified();
+  }
   return allowed;
 }
 
@@ -246,10 +258,13 @@ BitFlags Entity::dimensionBits() const
 
 UUIDArray& Entity::relations()
 {
+  this->materialize();
+  this->topologyModified();
   return m_relations;
 }
 const UUIDArray& Entity::relations() const
 {
+  this->materialize();
   return m_relations;
 }
 
@@ -267,6 +282,8 @@ const UUIDArray& Entity::relations() const
   */
 int Entity::appendRelation(const UUID& b, bool useHoles)
 {
+  this->materialize();
+  this->resourceTopologyModified();
   int idx;
   if (useHoles)
   {
@@ -280,6 +297,8 @@ int Entity::appendRelation(const UUID& b, bool useHoles)
 
 EntityPtr Entity::pushRelation(const UUID& b)
 {
+  this->materialize();
+  this->resourceTopologyModified();
   m_relations.push_back(b);
   return shared_from_this();
 }
@@ -297,6 +316,8 @@ EntityPtr Entity::pushRelation(const UUID& b)
   */
 EntityPtr Entity::removeRelation(const UUID& b)
 {
+  this->materialize();
+  this->resourceTopologyModified();
   UUIDArray& arr(m_relations);
   UUIDArray::size_type size = arr.size();
   UUIDArray::size_type curr;
@@ -319,6 +340,8 @@ EntityPtr Entity::removeRelation(const UUID& b)
   */
 void Entity::resetRelations()
 {
+  this->materialize();
+  this->resourceTopologyModified();
   m_relations.clear();
   m_firstInvalid = -1;
 }
@@ -327,6 +350,8 @@ void Entity::resetRelations()
   */
 int Entity::findOrAppendRelation(const UUID& r)
 {
+  this->materialize();
+  this->resourceTopologyModified();
   for (UUIDArray::size_type i = 0; i < m_relations.size(); ++i)
   {
     if (m_relations[i] == r)
@@ -367,6 +392,8 @@ int Entity::findOrAppendRelation(const UUID& r)
   */
 int Entity::invalidateRelation(const UUID& r)
 {
+  this->materialize();
+  this->resourceTopologyModified();
   for (UUIDArray::size_type i = 0; i < m_relations.size(); ++i)
   {
     if (m_relations[i] == r)
@@ -383,6 +410,8 @@ int Entity::invalidateRelation(const UUID& r)
   */
 int Entity::invalidateRelationByIndex(int relIdx)
 {
+  this->materialize();
+  this->resourceTopologyModified();
   if (relIdx < 0 || relIdx >= static_cast<int>(m_relations.size()))
     return -1;
 
@@ -1216,8 +1245,6 @@ bool IsValueValid(const smtk::resource::Component& comp, smtk::model::BitFlags m
   const auto* modelEnt = dynamic_cast<const smtk::model::Entity*>(&comp);
   if (modelEnt)
   {
-    smtk::model::EntityRef c = modelEnt->referenceAs<smtk::model::EntityRef>();
-
     if (!mask)
     {
       return false; // Nothing can possibly match.
@@ -1244,6 +1271,8 @@ bool IsValueValid(const smtk::resource::Component& comp, smtk::model::BitFlags m
       // if the mask is only defined as "group", don't have to check further for members
       mask != smtk::model::GROUP_ENTITY)
     {
+      smtk::model::EntityRef c = modelEnt->referenceAs<smtk::model::EntityRef>();
+
       // If the mask does not explicitly include groups and if the component is an empty
       // group, reject the component.
       if (!(mask & smtk::model::GROUP_ENTITY))
@@ -1275,8 +1304,34 @@ bool IsValueValid(const smtk::resource::Component& comp, smtk::model::BitFlags m
   return false;
 }
 
-bool CheckPropStringValues(const StringList& propValues, const LimitingClause& clause)
+/// A LimitingClause along with its compiled regular expressions, so that they
+/// are compiled once per query rather than once per component evaluated.
+struct CompiledClause
+{
+  CompiledClause(const LimitingClause& clause)
+    : m_clause(clause)
+  {
+    if (clause.m_propNameIsRegex)
+    {
+      m_propNameRegex = regex(clause.m_propName);
+    }
+    auto rit = clause.m_propStringIsRegex.begin();
+    for (auto sit = clause.m_propStringValues.begin(); sit != clause.m_propStringValues.end();
+         ++sit)
+    {
+      bool isRegex = rit != clause.m_propStringIsRegex.end() && *rit++;
+      m_propStringRegexes.push_back(isRegex ? regex(*sit) : regex());
+    }
+  }
+
+  LimitingClause m_clause;
+  regex m_propNameRegex;
+  std::vector<regex> m_propStringRegexes;
+};
+
+bool CheckPropStringValues(const StringList& propValues, const CompiledClause& compiled)
 {
+  const LimitingClause& clause = compiled.m_clause;
   if (clause.m_propStringValues.empty())
   {
     return true;
@@ -1287,17 +1342,17 @@ bool CheckPropStringValues(const StringList& propValues, const LimitingClause& c
   }
   auto sit = clause.m_propStringValues.begin();
   auto rit = clause.m_propStringIsRegex.begin();
+  auto xit = compiled.m_propStringRegexes.begin();
   for (auto vit = propValues.begin();
 
        sit != clause.m_propStringValues.end();
 
-       ++sit, ++rit, ++vit)
+       ++sit, ++rit, ++xit, ++vit)
   {
     if (*rit)
     {
       // This is a regex, test it.
-      regex match(*sit);
-      if (!std::regex_search(*vit, match))
+      if (!regex_search(*vit, *xit))
       {
         return false;
       }
@@ -1318,8 +1373,9 @@ Entity::QueryFunctor limitedQueryFunctor(
   smtk::model::BitFlags bitFlags,
   LimitingClause& limitClause)
 {
-  LimitingClause clause(limitClause);
-  return [bitFlags, clause](const smtk::resource::Component& comp) -> bool {
+  auto compiled = std::make_shared<const CompiledClause>(limitClause);
+  return [bitFlags, compiled](const smtk::resource::Component& comp) -> bool {
+    const LimitingClause& clause = compiled->m_clause;
     // See if the component matches the bitFlags:
     if (!IsValueValid(comp, bitFlags))
     {
@@ -1379,17 +1435,17 @@ Entity::QueryFunctor limitedQueryFunctor(
           {
             return false;
           }
-          return CheckPropStringValues(stringProperties.at(clause.m_propName), clause);
+          return CheckPropStringValues(stringProperties.at(clause.m_propName), *compiled);
         }
         else
         {
-          regex re(clause.m_propName);
+          const regex& re = compiled->m_propNameRegex;
           std::set<std::string> keys = stringProperties.keys();
           return std::any_of(
-            keys.begin(), keys.end(), [&re, &stringProperties, &clause](const std::string& key) {
+            keys.begin(), keys.end(), [&re, &stringProperties, &compiled](const std::string& key) {
               // A matching property name with matching values
               return regex_search(key, re) &&
-                CheckPropStringValues(stringProperties.at(key), clause);
+                CheckPropStringValues(stringProperties.at(key), *compiled);
             });
         }
       }
@@ -1430,7 +1486,10 @@ Entity::QueryFunctor limitedQueryFunctor(
   };
 }
 
-Entity::QueryFunctor Entity::filterStringToQueryFunctor(const std::string& filter)
+namespace
+{
+/// Construct a functor that evaluates the given filter string.
+Entity::QueryFunctor parseFilterString(const std::string& filter)
 {
   // If we can turn the filter string into a simple bit-vector comparison,
   // do that since it will be much faster to evaluate:
@@ -1473,9 +1532,40 @@ Entity::QueryFunctor Entity::filterStringToQueryFunctor(const std::string& filte
 
   return limitedQueryFunctor(bitflags, limitClause);
 }
+} // namespace
+
+Entity::QueryFunctor Entity::filterStringToQueryFunctor(const std::string& filter)
+{
+  // Parsing a filter string costs far more than evaluating the functor it
+  // produces, and the same few strings are parsed repeatedly (e.g., by UI
+  // filters and reference item acceptance checks). The functors do not refer
+  // to any resource, so they are cached by filter string.
+  static const std::size_t maxCachedFunctors = 256;
+  static std::mutex mutex;
+  static std::unordered_map<std::string, QueryFunctor> functors;
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    auto it = functors.find(filter);
+    if (it != functors.end())
+    {
+      return it->second;
+    }
+  }
+
+  QueryFunctor functor = parseFilterString(filter);
+
+  std::lock_guard<std::mutex> guard(mutex);
+  if (functors.size() >= maxCachedFunctors)
+  {
+    functors.clear();
+  }
+  return functors.emplace(filter, functor).first->second;
+}
 
 int Entity::arrange(ArrangementKind kind, const Arrangement& arr, int index)
 {
+  this->materialize();
+  this->resourceTopologyModified();
   KindsToArrangements::iterator kit = m_arrangements.find(kind);
   if (kit == m_arrangements.end())
   {
@@ -1505,6 +1595,8 @@ int Entity::arrange(ArrangementKind kind, const Arrangement& arr, int index)
 
 int Entity::unarrange(ArrangementKind kind, int index, bool removeIfLast)
 {
+  this->materialize();
+  this->resourceTopologyModified();
   int result = 0;
   if (index < 0 || m_arrangements.empty())
   {
@@ -1566,6 +1658,8 @@ int Entity::unarrange(ArrangementKind kind, int index, bool removeIfLast)
 
 bool Entity::clearArrangements()
 {
+  this->materialize();
+  this->resourceTopologyModified();
   bool didRemove = !m_arrangements.empty();
   if (didRemove)
     m_arrangements.clear();
@@ -1574,6 +1668,7 @@ bool Entity::clearArrangements()
 
 const Arrangements* Entity::hasArrangementsOfKind(ArrangementKind kind) const
 {
+  this->materialize();
   auto ait = m_arrangements.find(kind);
   if (ait != m_arrangements.end())
   {
@@ -1584,6 +1679,8 @@ const Arrangements* Entity::hasArrangementsOfKind(ArrangementKind kind) const
 
 Arrangements* Entity::hasArrangementsOfKind(ArrangementKind kind)
 {
+  this->materialize();
+  this->topologyModified();
   ArrangementKindWithArrangements ait = m_arrangements.find(kind);
   if (ait != m_arrangements.end())
   {
@@ -1594,11 +1691,14 @@ Arrangements* Entity::hasArrangementsOfKind(ArrangementKind kind)
 
 Arrangements& Entity::arrangementsOfKind(ArrangementKind kind)
 {
+  this->materialize();
+  this->topologyModified();
   return m_arrangements[kind];
 }
 
 const Arrangement* Entity::findArrangement(ArrangementKind kind, int index) const
 {
+  this->materialize();
   if (index < 0)
   {
     return nullptr;
@@ -1620,6 +1720,8 @@ const Arrangement* Entity::findArrangement(ArrangementKind kind, int index) cons
 
 Arrangement* Entity::findArrangement(ArrangementKind kind, int index)
 {
+  this->materialize();
+  this->topologyModified();
   if (index < 0)
   {
     return nullptr;
@@ -1642,6 +1744,7 @@ Arrangement* Entity::findArrangement(ArrangementKind kind, int index)
 int Entity::findArrangementInvolvingEntity(ArrangementKind kind, const smtk::common::UUID& involved)
   const
 {
+  this->materialize();
   const Arrangements* arr = this->hasArrangementsOfKind(kind);
   if (!arr)
     return -1;
@@ -1669,6 +1772,7 @@ int Entity::findArrangementInvolvingEntity(ArrangementKind kind, const smtk::com
 bool Entity::findDualArrangements(ArrangementKind kind, int index, ArrangementReferences& duals)
   const
 {
+  this->materialize();
   const Arrangements* arr = this->hasArrangementsOfKind(kind);
   if (!arr || index < 0 || index >= static_cast<int>(arr->size()))
   {
@@ -1832,6 +1936,8 @@ bool Entity::findDualArrangements(ArrangementKind kind, int index, ArrangementRe
 
 int Entity::consumeInvalidIndex(const smtk::common::UUID& uid)
 {
+  this->materialize();
+  this->topologyModified();
   int result = m_firstInvalid;
   if (result < 0)
     return result; // no hole to consume
@@ -1857,6 +1963,60 @@ int Entity::consumeInvalidIndex(const smtk::common::UUID& uid)
   return result;
 }
 
+void Entity::deferTopology(const std::shared_ptr<const DeferredTopology>& topology)
+{
+  this->materialize();
+  this->resourceTopologyModified();
+  m_deferredTopology = topology;
+  m_topologyDeferred.store(!!topology, std::memory_order_release);
+}
+
+void Entity::resourceTopologyModified()
+{
+  this->topologyModified();
+  ResourcePtr resource = m_resource.lock();
+  if (resource)
+  {
+    resource->topologyModified();
+  }
+}
+
+// Keep the owning resource's index of entities by type up to date.
+void Entity::entityTypeModified()
+{
+  ResourcePtr resource = this->modelResource();
+  if (resource)
+  {
+    resource->m_entityTypes.update(m_id, m_entityFlags);
+  }
+}
+
+void Entity::materializeDeferredTopology() const
+{
+  // Materialization is rare (once per entity), so a single lock suffices.
+  static std::mutex mutex;
+  std::lock_guard<std::mutex> guard(mutex);
+  if (!m_topologyDeferred.load(std::memory_order_relaxed))
+  {
+    return; // Another thread materialized the topology while we waited.
+  }
+
+  // Deferred topology is logically part of the (const) entity.
+  auto* self = const_cast<Entity*>(this);
+  try
+  {
+    m_deferredTopology->materialize(*this, self->m_relations, self->m_arrangements);
+  }
+  catch (std::exception& e)
+  {
+    smtkErrorMacro(
+      smtk::io::Logger::instance(),
+      "Could not read the topology of entity " << m_id << ": " << e.what());
+  }
+  m_deferredTopology.reset();
+  m_topologyDeferred.store(false, std::memory_order_release);
+}
+
 /**\brief Return the attributes associated with the entity
 that are of type (or derived type) def.
   */
@@ -20,7 +20,10 @@
 #include "smtk/model/IntegerData.h"    // for IntegerList
 #include "smtk/model/StringData.h"     // for StringList
 
+#include <atomic>
+#include <cstdint>
 #include <map>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <string>
@@ -89,6 +92,8 @@ public:
   BitFlags entityFlags() const;
   bool setEntityFlags(BitFlags flags);
 
+  /// Access the entity's relations. Callers that modify the relations through
+  /// the non-const reference must call Resource::topologyModified() afterward.
   smtk::common::UUIDArray& relations();
   const smtk::common::UUIDArray& relations() const;
 
@@ -138,7 +143,52 @@ public:
   int findArrangementInvolvingEntity(ArrangementKind k, const smtk::common::UUID& involved) const;
   bool findDualArrangements(ArrangementKind kind, int index, ArrangementReferences& duals) const;
 
-  const KindsToArrangements& arrangementMap() const { return m_arrangements; }
+  const KindsToArrangements& arrangementMap() const
+  {
+    this->materialize();
+    return m_arrangements;
+  }
+
+  /**\brief A source of relations and arrangements for entities whose
+    *       topology has not been read yet.
+    *
+    * Lazy readers create entities with only their type and defer the rest
+    * of each entity's topology to an instance of this class.
+    */
+  class SMTKCORE_EXPORT DeferredTopology
+  {
+  public:
+    virtual ~DeferredTopology() = default;
+
+    /// Populate the \a relations and \a arrangements of \a entity.
+    virtual void materialize(
+      const Entity& entity,
+      smtk::common::UUIDArray& relations,
+      KindsToArrangements& arrangements) const = 0;
+  };
+
+  /**\brief Defer this entity's relations and arrangements to \a topology.
+    *
+    * The entity's relations and arrangements are materialized by \a topology
+    * (and the reference to \a topology released) the first time either is
+    * accessed. Materialization is thread-safe.
+    */
+  void deferTopology(const std::shared_ptr<const DeferredTopology>& topology);
+  /// Return true if the entity's relations and arrangements have yet to be materialized.
+  bool isTopologyDeferred() const { return m_topologyDeferred.load(std::memory_order_acquire); }
+
+  /**\brief Return a counter incremented each time the entity's type, relations,
+    *       or arrangements may have been modified.
+    *
+    * Accessors that return modifiable references to relations or arrangements
+    * count as modifications, so code that only reads them should use the const
+    * accessors. This allows caches of the topology (such as
+    * smtk::model::TopologyIndex) to detect entries that are out of date.
+    */
+  std::uint32_t topologyVersion() const
+  {
+    return m_topologyVersion.load(std::memory_order_relaxed);
+  }
 
   const common::UUID& id() const override { return m_id; }
   bool setId(const common::UUID& uid) override
@@ -177,12 +227,32 @@ protected:
   Entity();
   int consumeInvalidIndex(const smtk::common::UUID& uid);
 
+  // Materialize any deferred relations and arrangements.
+  void materialize() const
+  {
+    if (this->isTopologyDeferred())
+    {
+      this->materializeDeferredTopology();
+    }
+  }
+  void materializeDeferredTopology() const;
+  // Note that the entity's type, relations, or arrangements may be modified.
+  void topologyModified() { m_topologyVersion.fetch_add(1, std::memory_order_relaxed); }
+  // Note that the entity's type, relations, or arrangements were modified,
+  // which may change the owners of entities in its resource.
+  void resourceTopologyModified();
+  // Note that the entity's type has been modified.
+  void entityTypeModified();
+
   BitFlags m_entityFlags{ INVALID };
   smtk::common::UUIDArray m_relations;
   smtk::model::WeakResourcePtr m_resource;
   KindsToArrangements m_arrangements;
   int m_firstInvalid{ -1 };
   smtk::common::UUID m_id;
+  mutable std::atomic<bool> m_topologyDeferred{ false };
+  mutable std::shared_ptr<const DeferredTopology> m_deferredTopology;
+  std::atomic<std::uint32_t> m_topologyVersion{ 0 };
 };
 
 /// An abbreviation for the record type used by maps of Entity records.
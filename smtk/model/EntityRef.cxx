@@ -71,6 +71,7 @@ bool EntityRef::setResource(ResourcePtr rsrc)
     return false;
   }
   m_resource = rsrc;
+  m_cache = RecordCache();
   return true;
 }
 
@@ -93,6 +94,7 @@ bool EntityRef::setEntity(const smtk::common::UUID& inEntity)
     return false;
 
   m_entity = inEntity;
+  m_cache = RecordCache();
   return true;
 }
 
@@ -105,23 +107,53 @@ const smtk::common::UUID& EntityRef::entity() const
 /// Return the smtk::model::Entity record for this model entity.
 smtk::model::EntityPtr EntityRef::entityRecord() const
 {
-  auto rsrc = this->resource();
-  if (!rsrc)
-  {
-    return nullptr;
-  }
-  return rsrc->findEntity(m_entity, true);
+  Entity* record = this->resolve(m_resource.lock());
+  return record ? record->shared_from_this() : nullptr;
 }
 
 /// Return the resource component for this model entity.
 smtk::resource::ComponentPtr EntityRef::component() const
 {
-  auto rsrc = this->resource();
-  if (!rsrc)
+  return this->entityRecord();
+}
+
+EntityRef::RecordCache::RecordCache(const RecordCache& other)
+  : m_record(other.m_record.load(std::memory_order_relaxed))
+  , m_generation(other.m_generation.load(std::memory_order_acquire))
+{
+}
+
+EntityRef::RecordCache& EntityRef::RecordCache::operator=(const RecordCache& other)
+{
+  m_record.store(other.m_record.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  m_generation.store(other.m_generation.load(std::memory_order_acquire), std::memory_order_release);
+  return *this;
+}
+
+/**\brief Return the entity record of this entityref in \a rsrc.
+  *
+  * Records are looked up in the resource only when the resource's
+  * entityGeneration() differs from the one cached with the last record
+  * found; records that are not found are never cached.
+  */
+Entity* EntityRef::resolve(const ResourcePtr& rsrc, bool trySessions) const
+{
+  if (!rsrc || m_entity.isNull())
   {
     return nullptr;
   }
-  return rsrc->find(m_entity);
+  if (m_cache.m_generation.load(std::memory_order_acquire) == rsrc->entityGeneration())
+  {
+    return m_cache.m_record.load(std::memory_order_relaxed);
+  }
+  EntityPtr record = rsrc->findEntity(m_entity, trySessions);
+  if (record)
+  {
+    // Fetch the generation after the lookup since sessions may transcribe entities.
+    m_cache.m_record.store(record.get(), std::memory_order_relaxed);
+    m_cache.m_generation.store(rsrc->entityGeneration(), std::memory_order_release);
+  }
+  return record.get();
 }
 
 /**\brief Return the nominal parametric dimension of the entity (or -1).
@@ -135,7 +167,7 @@ int EntityRef::dimension() const
   ResourcePtr rsrc = m_resource.lock();
   if (rsrc && !m_entity.isNull())
   {
-    EntityPtr entRec = rsrc->findEntity(m_entity);
+    Entity* entRec = this->resolve(rsrc);
     if (entRec)
     {
       return entRec->dimension();
@@ -155,7 +187,7 @@ int EntityRef::dimensionBits() const
   ResourcePtr rsrc = m_resource.lock();
   if (rsrc && !m_entity.isNull())
   {
-    EntityPtr entRec = rsrc->findEntity(m_entity);
+    Entity* entRec = this->resolve(rsrc);
     if (entRec)
     {
       return entRec->dimensionBits();
@@ -174,7 +206,7 @@ void EntityRef::setDimensionBits(BitFlags dimBits)
   ResourcePtr rsrc = m_resource.lock();
   if (rsrc && !m_entity.isNull())
   {
-    EntityPtr entRec = rsrc->findEntity(m_entity);
+    Entity* entRec = this->resolve(rsrc);
     if (entRec)
     {
       BitFlags old = entRec->entityFlags() & ~ANY_DIMENSION;
@@ -236,7 +268,7 @@ BitFlags EntityRef::entityFlags() const
   ResourcePtr rsrc = m_resource.lock();
   if (rsrc && !m_entity.isNull())
   {
-    EntityPtr entRec = rsrc->findEntity(m_entity);
+    Entity* entRec = this->resolve(rsrc);
     if (entRec)
     {
       return entRec->entityFlags();
@@ -254,7 +286,7 @@ std::string EntityRef::flagSummary(int form) const
   ResourcePtr rsrc = m_resource.lock();
   if (rsrc)
   {
-    EntityPtr ent = rsrc->findEntity(m_entity);
+    Entity* ent = this->resolve(rsrc);
     if (ent)
     {
       std::ostringstream summary;
@@ -299,7 +331,25 @@ std::string EntityRef::flagSummary(int form) const
 std::string EntityRef::name() const
 {
   ResourcePtr rsrc = m_resource.lock();
-  return rsrc ? rsrc->name(m_entity) : "(null model)";
+  if (!rsrc)
+  {
+    return "(null model)";
+  }
+  Entity* ent = this->resolve(rsrc);
+  if (!ent)
+  {
+    return rsrc->name(m_entity);
+  }
+  const auto& stringProperties = ent->properties().get<std::vector<std::string>>();
+  if (stringProperties.contains("name"))
+  {
+    const auto& names = stringProperties.at("name");
+    if (!names.empty())
+    {
+      return names[0];
+    }
+  }
+  return Resource::shortUUIDName(m_entity, ent->entityFlags());
 }
 
 /** Assign a name to an entity.
@@ -473,18 +523,12 @@ bool EntityRef::isValid() const
   */
 bool EntityRef::isValid(EntityPtr* entityRecord) const
 {
-  ResourcePtr rsrc = m_resource.lock();
-  bool status = rsrc && !m_entity.isNull();
-  if (status)
+  Entity* rec = this->resolve(m_resource.lock(), false);
+  if (rec && entityRecord)
   {
-    EntityPtr rec = rsrc->findEntity(m_entity, false);
-    status = static_cast<bool>(rec);
-    if (status && entityRecord)
-    {
-      *entityRecord = rec;
-    }
+    *entityRecord = rec->shared_from_this();
   }
-  return status;
+  return rec != nullptr;
 }
 
 /**\brief A wrapper around EntityRef::isValid() which also verifies an arrangement exists.
@@ -504,6 +548,20 @@ bool EntityRef::checkForArrangements(ArrangementKind k, EntityPtr& entRec, Arran
   return false;
 }
 
+bool EntityRef::checkForArrangements(
+  ArrangementKind k,
+  const Entity*& entRec,
+  const Arrangements*& arr) const
+{
+  entRec = this->isValid() ? this->resolve(m_resource.lock(), false) : nullptr;
+  if (entRec)
+  {
+    arr = entRec->hasArrangementsOfKind(k);
+    return arr && !arr->empty();
+  }
+  return false;
+}
+
 EntityRefs EntityRef::bordantEntities(int ofDimension) const
 {
   EntityRefs result;
@@ -740,7 +798,7 @@ EntityRef& EntityRef::addRawRelation(const EntityRef& ent)
     rsrc && !m_entity.isNull() && rsrc == ent.resource() && !ent.entity().isNull() &&
     ent.entity() != m_entity)
   {
-    EntityPtr entRec = rsrc->findEntity(m_entity);
+    Entity* entRec = this->resolve(rsrc);
     if (entRec)
       entRec->appendRelation(ent.entity());
   }
@@ -761,7 +819,7 @@ EntityRef& EntityRef::findOrAddRawRelation(const EntityRef& ent)
     rsrc && !m_entity.isNull() && rsrc == ent.resource() && !ent.entity().isNull() &&
     ent.entity() != m_entity)
   {
-    EntityPtr entRec = rsrc->findEntity(m_entity);
+    Entity* entRec = this->resolve(rsrc);
     if (
       entRec &&
       std::find(entRec->relations().begin(), entRec->relations().end(), ent.entity()) ==
@@ -1501,8 +1559,8 @@ std::set<std::string> EntityRef::integerPropertyNames() const
 /// Return the number of arrangements of the given kind \a k.
 int EntityRef::numberOfArrangementsOfKind(ArrangementKind k) const
 {
-  ResourcePtr rsrc = m_resource.lock();
-  const Arrangements* arr = rsrc->hasArrangementsOfKindForEntity(m_entity, k);
+  const Entity* entRec = this->resolve(m_resource.lock(), false);
+  const Arrangements* arr = entRec ? entRec->hasArrangementsOfKind(k) : nullptr;
   return arr ? static_cast<int>(arr->size()) : 0;
 }
 
@@ -1516,8 +1574,8 @@ Arrangement* EntityRef::findArrangement(ArrangementKind k, int i)
 /// Return the \a i-th arrangement of kind \a k (or nullptr).
 const Arrangement* EntityRef::findArrangement(ArrangementKind k, int i) const
 {
-  ResourcePtr rsrc = m_resource.lock();
-  return rsrc->findArrangement(m_entity, k, i);
+  const Entity* entRec = this->resolve(m_resource.lock(), false);
+  return entRec ? entRec->findArrangement(k, i) : nullptr;
 }
 
 /// Delete all arrangements of this entity with prejudice.
@@ -1534,10 +1592,10 @@ EntityRef EntityRef::relationFromArrangement(ArrangementKind k, int arrangementI
   const
 {
   ResourcePtr rsrc = m_resource.lock();
-  EntityPtr ent = rsrc->findEntity(m_entity);
+  const Entity* ent = this->resolve(rsrc);
   if (ent)
   {
-    const Arrangement* arr = this->findArrangement(k, arrangementIndex);
+    const Arrangement* arr = ent->findArrangement(k, arrangementIndex);
     if (arr && static_cast<int>(arr->details().size()) > offset)
     {
       int idx = arr->details()[offset];
@@ -27,6 +27,8 @@
 #include "smtk/model/StringData.h"           // for String, StringData, ...
 
 #include <array>
+#include <atomic>
+#include <cstdint>
 #include <iostream>
 #include <set>
 #include <vector>
@@ -166,6 +168,10 @@ public:
   bool isValid() const;
   virtual bool isValid(EntityPtr* entityRecord) const;
   virtual bool checkForArrangements(ArrangementKind k, EntityPtr& entry, Arrangements*& arr) const;
+  /// A read-only variant of checkForArrangements() that does not count as a
+  /// modification of the entity's topology (see Entity::topologyVersion()).
+  bool checkForArrangements(ArrangementKind k, const Entity*& entry, const Arrangements*& arr)
+    const;
 
   bool isCellEntity() const { return smtk::model::isCellEntity(this->entityFlags()); }
   bool isUseEntity() const { return smtk::model::isUseEntity(this->entityFlags()); }
@@ -359,6 +365,26 @@ protected:
   smtk::model::WeakResourcePtr m_resource;
   smtk::common::UUID m_entity;
 
+  /**\brief The entity record that m_entity was last resolved to.
+    *
+    * The record is owned by the resource and remains valid until the
+    * resource's entityGeneration() changes. Its members are atomic so
+    * that a single entityref may be resolved from several threads.
+    */
+  struct SMTKCORE_EXPORT RecordCache
+  {
+    RecordCache() = default;
+    RecordCache(const RecordCache& other);
+    RecordCache& operator=(const RecordCache& other);
+
+    std::atomic<Entity*> m_record{ nullptr };
+    std::atomic<std::uint64_t> m_generation{ 0 };
+  };
+  mutable RecordCache m_cache;
+
+  // Return the entity record of m_entity in \a rsrc (or nullptr), using the cache when valid.
+  Entity* resolve(const ResourcePtr& rsrc, bool trySessions = true) const;
+
   // Manage subset_of/superset_of relationships
   EntityRef& addMemberEntity(const EntityRef& memberToAdd);
   template<typename T>
@@ -381,8 +407,8 @@ T EntityRef::relationsAs() const
 {
   T result;
   ResourcePtr mgr = m_resource.lock();
-  smtk::model::EntityPtr entRec;
-  if (!this->isValid(&entRec))
+  const Entity* entRec = this->isValid() ? this->resolve(mgr, false) : nullptr;
+  if (!entRec)
     return result;
 
   smtk::common::UUIDArray::const_iterator it;
@@ -36,14 +36,14 @@ public:
   template<typename T>
   static T firstRelation(const EntityRef& c, ArrangementKind k)
   {
-    EntityPtr entRec;
-    Arrangements* arr;
+    const Entity* entRec;
+    const Arrangements* arr;
     if (c.checkForArrangements(k, entRec, arr))
     {
       smtk::common::UUIDArray const& relations(entRec->relations());
-      for (Arrangements::iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
+      for (Arrangements::const_iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
       {
-        std::vector<int>::iterator it;
+        std::vector<int>::const_iterator it;
         for (it = arrIt->details().begin(); it != arrIt->details().end(); ++it)
         {
           return T(c.resource(), relations[*it]);
@@ -61,8 +61,8 @@ public:
   template<typename T>
   static void appendAllRelations(const EntityRef& c, ArrangementKind k, T& result)
   {
-    EntityPtr entRec;
-    Arrangements* arr;
+    const Entity* entRec;
+    const Arrangements* arr;
     if (c.checkForArrangements(k, entRec, arr))
     {
       switch (k)
@@ -96,11 +96,14 @@ public:
   /**\brief Helper methods used by appendAllRelations.
     */
   template<typename T>
-  static void
-  appendAllUseHasCellRelations(ResourcePtr resource, EntityPtr entRec, Arrangements* arr, T& result)
+  static void appendAllUseHasCellRelations(
+    ResourcePtr resource,
+    const Entity* entRec,
+    const Arrangements* arr,
+    T& result)
   {
     smtk::common::UUIDArray const& relations(entRec->relations());
-    for (Arrangements::iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
+    for (Arrangements::const_iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
     {
       // Use HAS_CELL arrangements are specified as [relIdx, sense] tuples.
       int relIdx, relSense;
@@ -113,11 +116,14 @@ public:
     }
   }
   template<typename T>
-  static void
-  appendAllCellHasUseRelations(ResourcePtr resource, EntityPtr entRec, Arrangements* arr, T& result)
+  static void appendAllCellHasUseRelations(
+    ResourcePtr resource,
+    const Entity* entRec,
+    const Arrangements* arr,
+    T& result)
   {
     smtk::common::UUIDArray const& relations(entRec->relations());
-    for (Arrangements::iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
+    for (Arrangements::const_iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
     {
       // Cell HAS_USE arrangements are specified as [relIdx, sense, orientation] tuples.
       int relIdx, relSense;
@@ -133,12 +139,12 @@ public:
   template<typename T>
   static void appendAllShellHasUseRelations(
     ResourcePtr resource,
-    EntityPtr entRec,
-    Arrangements* arr,
+    const Entity* entRec,
+    const Arrangements* arr,
     T& result)
   {
     smtk::common::UUIDArray const& relations(entRec->relations());
-    for (Arrangements::iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
+    for (Arrangements::const_iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
     {
       // Shell HAS_USE arrangements are specified as [min,max[ offset-ranges,
       // not arrays of offset values.
@@ -186,13 +192,16 @@ public:
     arr->clear();
   }
   template<typename T>
-  static void
-  appendAllSimpleRelations(ResourcePtr resource, EntityPtr entRec, Arrangements* arr, T& result)
+  static void appendAllSimpleRelations(
+    ResourcePtr resource,
+    const Entity* entRec,
+    const Arrangements* arr,
+    T& result)
   {
     smtk::common::UUIDArray const& relations(entRec->relations());
-    for (Arrangements::iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
+    for (Arrangements::const_iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
     {
-      std::vector<int>::iterator it;
+      std::vector<int>::const_iterator it;
       for (it = arrIt->details().begin(); it != arrIt->details().end(); ++it)
       {
         if (*it < 0)
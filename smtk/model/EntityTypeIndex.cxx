@@ -0,0 +1,102 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/model/EntityTypeIndex.h"
+
+namespace smtk
+{
+namespace model
+{
+
+std::size_t EntityTypeIndex::Range::size() const
+{
+  std::size_t result = 0;
+  for (const auto* bucket : m_buckets)
+  {
+    result += bucket->size();
+  }
+  return result;
+}
+
+bool EntityTypeIndex::matches(BitFlags flags, BitFlags mask, bool exactMatch)
+{
+  BitFlags masked = flags & mask;
+  // NB: exactMatch still allows some mismatches; specifically, we want to
+  //     disregard dimension bits set on models and groups when asking for
+  //     exact matches for MODEL_ENTITY and GROUP_ENTITY. Hence the final
+  //     condition that (flags & ENTITY_MASK) == (mask & ENTITY_MASK)
+  //     rather than just flags == mask.
+  return (masked && (mask == ANY_ENTITY)) || (!exactMatch && masked) ||
+    (exactMatch && masked == mask && ((flags & ENTITY_MASK) == (mask & ENTITY_MASK)));
+}
+
+EntityTypeIndex::Range EntityTypeIndex::find(BitFlags mask, bool exactMatch) const
+{
+  Range result;
+  for (const auto& entry : m_buckets)
+  {
+    if (!entry.second.empty() && EntityTypeIndex::matches(entry.first, mask, exactMatch))
+    {
+      result.m_buckets.push_back(&entry.second);
+    }
+  }
+  return result;
+}
+
+void EntityTypeIndex::insert(const smtk::common::UUID& uid, BitFlags flags)
+{
+  auto it = m_locations.find(uid);
+  if (it != m_locations.end())
+  {
+    this->update(uid, flags);
+    return;
+  }
+  Bucket& bucket(m_buckets[flags]);
+  m_locations[uid] = Location{ flags, bucket.size() };
+  bucket.push_back(uid);
+}
+
+void EntityTypeIndex::update(const smtk::common::UUID& uid, BitFlags flags)
+{
+  auto it = m_locations.find(uid);
+  if (it == m_locations.end() || it->second.m_flags == flags)
+  {
+    return;
+  }
+  this->erase(uid);
+  this->insert(uid, flags);
+}
+
+void EntityTypeIndex::erase(const smtk::common::UUID& uid)
+{
+  auto it = m_locations.find(uid);
+  if (it == m_locations.end())
+  {
+    return;
+  }
+  // Move the last entry of the bucket into the erased entry's position.
+  Bucket& bucket(m_buckets[it->second.m_flags]);
+  std::size_t position = it->second.m_position;
+  if (position + 1 < bucket.size())
+  {
+    bucket[position] = bucket.back();
+    m_locations[bucket[position]].m_position = position;
+  }
+  bucket.pop_back();
+  m_locations.erase(it);
+}
+
+void EntityTypeIndex::clear()
+{
+  m_buckets.clear();
+  m_locations.clear();
+}
+
+} // namespace model
+} // namespace smtk
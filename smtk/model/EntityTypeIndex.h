@@ -0,0 +1,142 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_model_EntityTypeIndex_h
+#define smtk_model_EntityTypeIndex_h
+
+#include "smtk/CoreExports.h"
+
+#include "smtk/model/EntityTypeBits.h"
+
+#include "smtk/common/UUID.h"
+
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace smtk
+{
+namespace model
+{
+
+/**\brief An index of a model resource's entities by type.
+  *
+  * Entities are held in buckets keyed by their entity flags. Since models
+  * hold few distinct combinations of flags, a query for entities of some
+  * type need only test the key of each bucket and is then proportional to
+  * the number of entities that match (rather than the number of entities
+  * in the resource).
+  */
+class SMTKCORE_EXPORT EntityTypeIndex
+{
+public:
+  using Bucket = std::vector<smtk::common::UUID>;
+
+  /**\brief The UUIDs of the entities matching a query, in no particular order.
+    *
+    * A range refers to the index's buckets rather than copying them, so it is
+    * only valid until the resource's entities are next added, removed, or
+    * modified.
+    */
+  class SMTKCORE_EXPORT Range
+  {
+  public:
+    class const_iterator
+    {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = smtk::common::UUID;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const smtk::common::UUID*;
+      using reference = const smtk::common::UUID&;
+
+      reference operator*() const { return (*(*m_buckets)[m_bucket])[m_entry]; }
+      pointer operator->() const { return &(*(*m_buckets)[m_bucket])[m_entry]; }
+      const_iterator& operator++()
+      {
+        if (++m_entry >= (*m_buckets)[m_bucket]->size())
+        {
+          m_entry = 0;
+          ++m_bucket;
+        }
+        return *this;
+      }
+      const_iterator operator++(int)
+      {
+        const_iterator result = *this;
+        ++*this;
+        return result;
+      }
+      bool operator==(const const_iterator& other) const
+      {
+        return m_bucket == other.m_bucket && m_entry == other.m_entry;
+      }
+      bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+    private:
+      friend class Range;
+      const_iterator(const std::vector<const Bucket*>* buckets, std::size_t bucket)
+        : m_buckets(buckets)
+        , m_bucket(bucket)
+      {
+      }
+
+      // Buckets in a range are never empty, so (bucket, 0) is the end of a range
+      // holding that many buckets.
+      const std::vector<const Bucket*>* m_buckets;
+      std::size_t m_bucket;
+      std::size_t m_entry{ 0 };
+    };
+
+    const_iterator begin() const { return const_iterator(&m_buckets, 0); }
+    const_iterator end() const { return const_iterator(&m_buckets, m_buckets.size()); }
+    bool empty() const { return m_buckets.empty(); }
+    std::size_t size() const;
+
+  private:
+    friend class EntityTypeIndex;
+    std::vector<const Bucket*> m_buckets;
+  };
+
+  /// Return true if an entity with the given \a flags matches a query for
+  /// entities of type \a mask (as Resource::entitiesMatchingFlags() defines it).
+  static bool matches(BitFlags flags, BitFlags mask, bool exactMatch);
+
+  /// Return the entities whose flags match \a mask.
+  Range find(BitFlags mask, bool exactMatch) const;
+
+  /// Add the entity \a uid with the given \a flags to the index.
+  void insert(const smtk::common::UUID& uid, BitFlags flags);
+  /// Move the entity \a uid (if indexed) into the bucket for \a flags.
+  void update(const smtk::common::UUID& uid, BitFlags flags);
+  /// Remove the entity \a uid from the index.
+  void erase(const smtk::common::UUID& uid);
+  /// Remove all entities from the index.
+  void clear();
+
+  /// Return the number of entities in the index.
+  std::size_t size() const { return m_locations.size(); }
+
+private:
+  struct Location
+  {
+    BitFlags m_flags;
+    std::size_t m_position;
+  };
+
+  std::map<BitFlags, Bucket> m_buckets;
+  std::unordered_map<smtk::common::UUID, Location> m_locations;
+};
+
+} // namespace model
+} // namespace smtk
+
+#endif // smtk_model_EntityTypeIndex_h
@@ -125,9 +125,11 @@ static void GenerateRandomOnSurfaceTessellation(Instance& inst, Tessellation* pl
 
     randomPoint.seed(seed[0]);
 
-    for (std::size_t i = 0; i < npts; ++i)
+    std::vector<double> points(3 * npts);
+    randomPoint.randomPoints(sampleSurfaceEntity, npts, points.data());
+    for (std::size_t i = 0; i < points.size(); i += 3)
     {
-      placements->addPoint(randomPoint(sampleSurfaceEntity).data());
+      placements->addPoint(&points[i]);
     }
   }
 }
@@ -166,15 +168,9 @@ static void SnapPlacementsTo(const Instance& inst, const EntityRefs& snaps, Tess
     {
       auto& closestPoint = inst.resource()->queries().get<smtk::geometry::ClosestPoint>();
       auto& coords = tess->coords();
-      for (std::size_t i = 0; i < tess->coords().size(); i += 3)
-      {
-        std::array<double, 3> input{ { coords[i], coords[i + 1], coords[i + 2] } };
-        std::array<double, 3> closest = closestPoint(snapEntity, input);
-        for (int j = 0; j < 3; j++)
-        {
-          coords[i + j] = closest[j];
-        }
-      }
+      std::vector<double> closest(coords.size());
+      closestPoint.closestPoints(snapEntity, coords.data(), coords.size() / 3, closest.data());
+      coords.swap(closest);
     }
   }
   else
@@ -183,15 +179,11 @@ static void SnapPlacementsTo(const Instance& inst, const EntityRefs& snaps, Tess
     {
       auto& distanceTo = inst.resource()->queries().get<smtk::geometry::DistanceTo>();
       auto& coords = tess->coords();
-      for (std::size_t i = 0; i < tess->coords().size(); i += 3)
-      {
-        std::array<double, 3> input{ { coords[i], coords[i + 1], coords[i + 2] } };
-        std::array<double, 3> closest = distanceTo(snapEntity, input).second;
-        for (int j = 0; j < 3; j++)
-        {
-          coords[i + j] = closest[j];
-        }
-      }
+      std::vector<double> distances(coords.size() / 3);
+      std::vector<double> closest(coords.size());
+      distanceTo.distances(
+        snapEntity, coords.data(), distances.size(), distances.data(), closest.data());
+      coords.swap(closest);
     }
   }
 }
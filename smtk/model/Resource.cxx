@@ -45,12 +45,15 @@
 #include <cfloat>
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iterator>
 #include <map>
+#include <mutex>
 #include <numeric>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <sstream>
@@ -72,7 +75,76 @@ constexpr smtk::resource::Links::RoleType Resource::TessellationRole;
 namespace
 {
 using QueryList = std::tuple<SelectionFootprint>;
+
+// Return a read-only view of an entity record. Reading relations or
+// arrangements through it does not count as a modification of the entity's
+// topology (see Entity::topologyVersion()), so cached topology stays valid.
+const Entity& readOnly(const EntityPtr& entity)
+{
+  return *entity;
 }
+} // namespace
+
+/**\brief Owners of entities memoized by modelOwningEntity() and sessionOwningEntity().
+  *
+  * Owners are found by searching an entity's relations (and those of its
+  * bordants), so they remain valid until the resource's topology generation
+  * changes; all memoized owners are then discarded at once. Owners may be
+  * queried concurrently, so access to the memoized values is serialized.
+  */
+class Resource::OwnerCache
+{
+public:
+  enum Kind
+  {
+    MODEL,
+    SESSION
+  };
+
+  /// Set \a owner to the memoized owner of \a uid and return true if there is one.
+  bool find(Kind kind, const UUID& uid, UUID& owner)
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    this->expire();
+    const auto& owners = m_owners[kind];
+    auto it = owners.find(uid);
+    if (it == owners.end())
+    {
+      return false;
+    }
+    owner = it->second;
+    return true;
+  }
+
+  /// Memoize the \a owner of \a uid found while the generation was \a generation.
+  void insert(Kind kind, const UUID& uid, const UUID& owner, std::uint64_t generation)
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    this->expire();
+    if (generation == m_cachedGeneration)
+    {
+      m_owners[kind][uid] = owner;
+    }
+  }
+
+  std::atomic<std::uint64_t> m_generation{ 1 };
+
+private:
+  void expire()
+  {
+    std::uint64_t generation = m_generation.load(std::memory_order_acquire);
+    if (generation != m_cachedGeneration)
+    {
+      m_owners[MODEL].clear();
+      m_owners[SESSION].clear();
+      m_cachedGeneration = generation;
+    }
+  }
+
+  std::mutex m_mutex;
+  std::uint64_t m_cachedGeneration{ 1 };
+  std::unordered_map<UUID, UUID> m_owners[2];
+};
 
 /**@name Constructors and destructors.
   *\brief Model resource instances should always be created using the static create() method.
@@ -83,6 +155,8 @@ using QueryList = std::tuple<SelectionFootprint>;
 Resource::Resource(smtk::resource::ManagerPtr mgr)
   : smtk::resource::DerivedFrom<Resource, smtk::geometry::Resource>(mgr)
   , m_topology(new UUIDsToEntities)
+  , m_topologyIndex(new TopologyIndex(*m_topology))
+  , m_owners(new OwnerCache)
   , m_tessellations(new UUIDsToTessellations)
   , m_analysisMesh(new UUIDsToTessellations)
   , m_attributeAssignments(new UUIDsToAttributeAssignments)
@@ -97,6 +171,8 @@ Resource::Resource(smtk::resource::ManagerPtr mgr)
 Resource::Resource(const smtk::common::UUID& uid, smtk::resource::ManagerPtr mgr)
   : smtk::resource::DerivedFrom<Resource, smtk::geometry::Resource>(uid, mgr)
   , m_topology(new UUIDsToEntities)
+  , m_topologyIndex(new TopologyIndex(*m_topology))
+  , m_owners(new OwnerCache)
   , m_tessellations(new UUIDsToTessellations)
   , m_analysisMesh(new UUIDsToTessellations)
   , m_attributeAssignments(new UUIDsToAttributeAssignments)
@@ -118,12 +194,18 @@ Resource::Resource(
   smtk::resource::ManagerPtr mgr)
   : smtk::resource::DerivedFrom<Resource, smtk::geometry::Resource>(uid, mgr)
   , m_topology(inTopology)
+  , m_topologyIndex(new TopologyIndex(*m_topology))
+  , m_owners(new OwnerCache)
   , m_tessellations(tess)
   , m_analysisMesh(analysismesh)
   , m_attributeAssignments(attribs)
   , m_sessions(new UUIDsToSessions)
   , m_globalCounters(2, 1) // first entry is session counter, second is model counter
 {
+  for (const auto& entry : *m_topology)
+  {
+    m_entityTypes.insert(entry.first, entry.second->entityFlags());
+  }
   this->queries().registerQueries<QueryList>();
   this->properties().insertPropertyType<smtk::common::UUID>();
 }
@@ -158,6 +240,29 @@ const UUIDsToEntities& Resource::topology() const
   return *m_topology;
 }
 
+void Resource::materializeTopology()
+{
+  for (const auto& entry : *m_topology)
+  {
+    const Entity& entity(*entry.second);
+    if (entity.isTopologyDeferred())
+    {
+      // Accessing an entity's topology materializes it.
+      entity.relations();
+    }
+  }
+}
+
+std::uint64_t Resource::topologyGeneration() const
+{
+  return m_owners->m_generation.load(std::memory_order_acquire);
+}
+
+void Resource::topologyModified()
+{
+  m_owners->m_generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
 UUIDsToTessellations& Resource::tessellations()
 {
   return *m_tessellations;
@@ -210,6 +315,10 @@ smtk::mesh::ResourcePtr Resource::meshTessellations() const
 void Resource::clear()
 {
   m_topology->clear();
+  m_topologyIndex->invalidate();
+  m_entityTypes.clear();
+  ++m_entityGeneration;
+  this->topologyModified();
   m_tessellations->clear();
   m_analysisMesh->clear();
   {
@@ -354,6 +463,10 @@ SessionInfoBits Resource::erase(const UUID& uid, SessionInfoBits flags)
     //       from obtaining a shared pointer to the resource
     //       to pass to any observers...
     m_topology->erase(uid);
+    m_topologyIndex->erase(uid);
+    m_entityTypes.erase(uid);
+    ++m_entityGeneration;
+    this->topologyModified();
   }
 
   return actual;
@@ -402,6 +515,10 @@ SessionInfoBits Resource::hardErase(const EntityRef& eref, SessionInfoBits flags
     { // without an Entity record, we cannot erase these things:
       actual &= ~(SESSION_ENTITY_TYPE | SESSION_ENTITY_RELATIONS | SESSION_ARRANGEMENTS);
     }
+    m_topologyIndex->erase(uid);
+    m_entityTypes.erase(uid);
+    ++m_entityGeneration;
+    this->topologyModified();
   }
 
   if (actual & SESSION_TESSELLATION)
@@ -582,6 +699,9 @@ Resource::setEntityOfTypeAndDimension(const UUID& uid, BitFlags entityFlags, int
 
   if (result.second)
   {
+    m_topologyIndex->insert(entrec);
+    m_entityTypes.insert(uid, entrec->entityFlags());
+    this->topologyModified();
     this->trigger(
       std::make_pair(ADD_EVENT, ENTITY_ENTRY), EntityRef(this->shared_from_this(), uid));
   }
@@ -615,12 +735,19 @@ Resource::iter_type Resource::setEntity(EntityPtr c)
     }
     this->removeEntityReferences(it);
     it->second = c;
+    m_topologyIndex->insert(c);
+    m_entityTypes.insert(c->id(), c->entityFlags());
+    ++m_entityGeneration;
+    this->topologyModified();
     this->insertEntityReferences(it);
     return it;
   }
   std::pair<UUID, EntityPtr> entry(c->id(), c);
   this->prepareForEntity(entry);
   it = m_topology->insert(entry).first;
+  m_topologyIndex->insert(c);
+  m_entityTypes.insert(c->id(), c->entityFlags());
+  this->topologyModified();
   this->insertEntityReferences(it);
   return it;
 }
@@ -721,47 +848,12 @@ std::string Resource::name(const UUID& ofEntity) const
 UUIDs Resource::bordantEntities(const UUID& ofEntity, int ofDimension) const
 {
   UUIDs result;
-  UUIDWithConstEntityPtr it = m_topology->find(ofEntity);
-  if (it == m_topology->end())
-  {
-    return result;
-  }
-  if (ofDimension >= 0 && it->second->dimension() >= ofDimension)
-  {
-    // can't ask for "higher" dimensional boundaries that are lower than the dimension of this cell.
-    return result;
-  }
-  UUIDWithConstEntityPtr other;
-  for (UUIDArray::const_iterator ai = it->second->relations().begin();
-       ai != it->second->relations().end();
-       ++ai)
-  {
-    other = m_topology->find(*ai);
-    if (other == m_topology->end())
-    { // TODO: silently skip bad relations or complain?
-      continue;
-    }
-    if (
-      (ofDimension >= 0 && other->second->dimension() == ofDimension) ||
-      (ofDimension == -2 && other->second->dimension() >= it->second->dimension()))
-    { // The dimension is higher, so dumbly push it into the result:
-      result.insert(*ai);
-    }
-    else if (
-      (it->second->entityFlags() & CELL_ENTITY) && (other->second->entityFlags() & USE_ENTITY))
-    { // ... or it is a use: follow the use upwards.
-      ShellEntities bshells = UseEntity(smtk::const_pointer_cast<Resource>(shared_from_this()), *ai)
-                                .boundingShellEntities<ShellEntities>();
-      for (ShellEntities::iterator shellIt = bshells.begin(); shellIt != bshells.end(); ++shellIt)
-      {
-        CellEntity cell = shellIt->boundingCell();
-        if (cell.dimension() >= ofDimension)
-        {
-          result.insert(cell.entity());
-        }
-      }
-    }
-  }
+  m_topologyIndex->traverse([&](TopologyIndex::Walker& walker) {
+    std::vector<TopologyIndex::Slot> bordants;
+    walker.bordants(walker.slot(ofEntity), ofDimension, bordants);
+    result.clear();
+    walker.ids(bordants, result);
+  });
   return result;
 }
 
@@ -772,12 +864,15 @@ UUIDs Resource::bordantEntities(const UUID& ofEntity, int ofDimension) const
 UUIDs Resource::bordantEntities(const UUIDs& ofEntities, int ofDimension) const
 {
   UUIDs result;
-  std::insert_iterator<UUIDs> inserter(result, result.begin());
-  for (UUIDs::const_iterator it = ofEntities.begin(); it != ofEntities.end(); ++it)
-  {
-    UUIDs brd = this->bordantEntities(*it, ofDimension);
-    std::copy(brd.begin(), brd.end(), inserter);
-  }
+  m_topologyIndex->traverse([&](TopologyIndex::Walker& walker) {
+    std::vector<TopologyIndex::Slot> bordants;
+    for (const auto& uid : ofEntities)
+    {
+      walker.bordants(walker.slot(uid), ofDimension, bordants);
+    }
+    result.clear();
+    walker.ids(bordants, result);
+  });
   return result;
 }
 
@@ -788,58 +883,12 @@ UUIDs Resource::bordantEntities(const UUIDs& ofEntities, int ofDimension) const
 UUIDs Resource::boundaryEntities(const UUID& ofEntity, int ofDimension) const
 {
   UUIDs result;
-  UUIDWithConstEntityPtr it = m_topology->find(ofEntity);
-  if (it == m_topology->end())
-  {
-    return result;
-  }
-  if (ofDimension >= 0 && it->second->dimension() <= ofDimension)
-  {
-    // can't ask for "lower" dimensional boundaries that are higher than the dimension of this cell.
-    return result;
-  }
-  UUIDWithEntityPtr other;
-  for (UUIDArray::const_iterator ai = it->second->relations().begin();
-       ai != it->second->relations().end();
-       ++ai)
-  {
-    other = m_topology->find(*ai);
-    if (other == m_topology->end())
-    { // TODO: silently skip bad relations or complain?
-      continue;
-    }
-    if (
-      (ofDimension >= 0 && other->second->dimension() == ofDimension) ||
-      (ofDimension == -2 && other->second->dimension() <= it->second->dimension() &&
-       !other->second->isModel()))
-    {
-      result.insert(*ai);
-    }
-    else if (
-      (it->second->entityFlags() & CELL_ENTITY) && (other->second->entityFlags() & USE_ENTITY))
-    { // ... or it is a use: follow the use downwards.
-      ShellEntities shells = UseEntity(smtk::const_pointer_cast<Resource>(shared_from_this()), *ai)
-                               .shellEntities<ShellEntities>();
-      for (ShellEntities::iterator shellIt = shells.begin(); shellIt != shells.end(); ++shellIt)
-      {
-        CellEntities cells = shellIt->cellsOfUses<CellEntities>();
-        for (CellEntities::iterator cellIt = cells.begin(); cellIt != cells.end(); ++cellIt)
-        {
-          if (cellIt->dimension() <= ofDimension)
-          {
-            result.insert(cellIt->entity());
-          }
-        }
-        // Add any inner shells owned by this outer shell. Note the iterator math:
-        // since shellIt can be invalidated as we add new entries to the vector,
-        // we recompute shellIt after insertion.
-        std::size_t itposn = shellIt - shells.begin();
-        ShellEntities innerShells = shellIt->containedShellEntities<ShellEntities>();
-        shells.insert(shells.end(), innerShells.begin(), innerShells.end());
-        shellIt = shells.begin() + itposn;
-      }
-    }
-  }
+  m_topologyIndex->traverse([&](TopologyIndex::Walker& walker) {
+    std::vector<TopologyIndex::Slot> boundaries;
+    walker.boundaries(walker.slot(ofEntity), ofDimension, boundaries);
+    result.clear();
+    walker.ids(boundaries, result);
+  });
   return result;
 }
 
@@ -850,12 +899,15 @@ UUIDs Resource::boundaryEntities(const UUID& ofEntity, int ofDimension) const
 UUIDs Resource::boundaryEntities(const UUIDs& ofEntities, int ofDimension) const
 {
   UUIDs result;
-  std::insert_iterator<UUIDs> inserter(result, result.begin());
-  for (UUIDs::const_iterator it = ofEntities.begin(); it != ofEntities.end(); ++it)
-  {
-    UUIDs bdy = this->boundaryEntities(*it, ofDimension);
-    std::copy(bdy.begin(), bdy.end(), inserter);
-  }
+  m_topologyIndex->traverse([&](TopologyIndex::Walker& walker) {
+    std::vector<TopologyIndex::Slot> boundaries;
+    for (const auto& uid : ofEntities)
+    {
+      walker.boundaries(walker.slot(uid), ofDimension, boundaries);
+    }
+    result.clear();
+    walker.ids(boundaries, result);
+  });
   return result;
 }
 
@@ -877,32 +929,37 @@ UUIDs Resource::boundaryEntities(const UUIDs& ofEntities, int ofDimension) const
 UUIDs Resource::lowerDimensionalBoundaries(const UUID& ofEntity, int lowerDimension)
 {
   UUIDs result;
-  UUIDWithEntityPtr it = m_topology->find(ofEntity);
-  if (it == m_topology->end())
-  {
-    return result;
-  }
-  if (it->second->dimension() <= lowerDimension)
-  {
-    // do nothing
-  }
-  else
-  {
+  m_topologyIndex->traverse([&](TopologyIndex::Walker& walker) {
+    result.clear();
+    TopologyIndex::Slot slot = walker.slot(ofEntity);
+    if (!walker.isValid(slot) || walker.dimension(slot) <= lowerDimension)
+    {
+      return;
+    }
     // FIXME: This only works for the "usual" case where
     //        a cell's relations are dimension (d+1) or
     //        (d-1). We should also collect any out-of-place
     //        relations that match lowerDimension as we go.
-    int currentDim = it->second->dimension() - 1;
+    int currentDim = walker.dimension(slot) - 1;
     int delta = currentDim - lowerDimension;
-    result = this->boundaryEntities(ofEntity, currentDim--);
+    std::vector<TopologyIndex::Slot> boundaries;
+    std::vector<TopologyIndex::Slot> next;
+    walker.boundaries(slot, currentDim--, boundaries);
+    TopologyIndex::Walker::unique(boundaries);
     for (int i = delta; i > 0; --i, --currentDim)
     {
-      UUIDs tmp = this->boundaryEntities(result, currentDim);
+      next.clear();
+      for (const auto& boundary : boundaries)
+      {
+        walker.boundaries(boundary, currentDim, next);
+      }
       if (lowerDimension >= 0)
-        result.clear();
-      result.insert(tmp.begin(), tmp.end());
+        boundaries.clear();
+      boundaries.insert(boundaries.end(), next.begin(), next.end());
+      TopologyIndex::Walker::unique(boundaries);
     }
-  }
+    walker.ids(boundaries, result);
+  });
   return result;
 }
 
@@ -924,28 +981,35 @@ UUIDs Resource::lowerDimensionalBoundaries(const UUID& ofEntity, int lowerDimens
 UUIDs Resource::higherDimensionalBordants(const UUID& ofEntity, int higherDimension)
 {
   UUIDs result;
-  UUIDWithEntityPtr it = m_topology->find(ofEntity);
-  if (it == m_topology->end())
-  {
-    return result;
-  }
-  if (higherDimension >= 0 && it->second->dimension() >= higherDimension)
-  {
-    // do nothing
-  }
-  else
-  {
-    int currentDim = it->second->dimension() + 1;
+  m_topologyIndex->traverse([&](TopologyIndex::Walker& walker) {
+    result.clear();
+    TopologyIndex::Slot slot = walker.slot(ofEntity);
+    if (
+      !walker.isValid(slot) ||
+      (higherDimension >= 0 && walker.dimension(slot) >= higherDimension))
+    {
+      return;
+    }
+    int currentDim = walker.dimension(slot) + 1;
     int delta = higherDimension < 0 ? 4 : higherDimension - currentDim;
-    result = this->bordantEntities(ofEntity, currentDim++);
+    std::vector<TopologyIndex::Slot> bordants;
+    std::vector<TopologyIndex::Slot> next;
+    walker.bordants(slot, currentDim++, bordants);
+    TopologyIndex::Walker::unique(bordants);
     for (int i = delta; i > 0; --i, ++currentDim)
     {
-      UUIDs tmp = this->bordantEntities(result, currentDim);
+      next.clear();
+      for (const auto& bordant : bordants)
+      {
+        walker.bordants(bordant, currentDim, next);
+      }
       if (higherDimension >= 0)
-        result.clear();
-      result.insert(tmp.begin(), tmp.end());
+        bordants.clear();
+      bordants.insert(bordants.end(), next.begin(), next.end());
+      TopologyIndex::Walker::unique(bordants);
     }
-  }
+    walker.ids(bordants, result);
+  });
   return result;
 }
 
@@ -962,24 +1026,19 @@ UUIDs Resource::adjacentEntities(const UUID& ofEntity, int ofDimension)
 /// Return all entities of the requested dimension that are present in the solid.
 UUIDs Resource::entitiesMatchingFlags(BitFlags mask, bool exactMatch)
 {
-  UUIDs result;
-  for (UUIDWithEntityPtr it = m_topology->begin(); it != m_topology->end(); ++it)
-  {
-    BitFlags unmasked = it->second->entityFlags();
-    BitFlags masked = unmasked & mask;
-    // NB: exactMatch still allows some mismatches; specifically, we want to
-    //     disregard dimension bits set on models and groups when asking for
-    //     exact matches for MODEL_ENTITY and GROUP_ENTITY. Hence the final
-    //     condition that (unmasked & ENTITY_MASK) == (mask & ENTITY_MASK)
-    //     rather than just unmasked == mask.
-    if (
-      (masked && (mask == ANY_ENTITY)) || (!exactMatch && masked) ||
-      (exactMatch && masked == mask && ((unmasked & ENTITY_MASK) == (mask & ENTITY_MASK))))
-    {
-      result.insert(it->first);
-    }
-  }
-  return result;
+  EntityTypeIndex::Range matches = m_entityTypes.find(mask, exactMatch);
+  return UUIDs(matches.begin(), matches.end());
+}
+
+/**\brief Return the UUIDs of entities whose type matches \a mask, in no particular order.
+  *
+  * Unlike entitiesMatchingFlags(), this does not copy the UUIDs; the range
+  * refers to the resource's index of entities by type and is only valid until
+  * entities are next added to, removed from, or modified in the resource.
+  */
+EntityTypeIndex::Range Resource::entitiesMatchingFlagsRange(BitFlags mask, bool exactMatch) const
+{
+  return m_entityTypes.find(mask, exactMatch);
 }
 
 /// Return all entities of the requested dimension that are present in the solid.
@@ -1059,6 +1118,16 @@ void Resource::visit(smtk::resource::Component::Visitor& visitor) const
   std::for_each(m_topology->begin(), m_topology->end(), convertedVisitor);
 }
 
+bool Resource::gatherComponents(std::vector<smtk::resource::Component*>& components) const
+{
+  components.reserve(components.size() + m_topology->size());
+  for (const auto& entry : *m_topology)
+  {
+    components.push_back(entry.second.get());
+  }
+  return true;
+}
+
 /// Given an entity \a c, ensure that all of its references contain a reference to it.
 void Resource::insertEntityReferences(const UUIDWithEntityPtr& c)
 {
@@ -1112,6 +1181,7 @@ void Resource::elideEntityReferences(const UUIDWithEntityPtr& c)
         if (*rit == c->first)
         { // TODO: Notify *bit of imminent elision?
           *rit = UUID::null();
+          this->topologyModified();
         }
       }
     }
@@ -1167,7 +1237,7 @@ void Resource::setFloatProperty(
   typedef resource::Properties::Indexed<std::vector<double>> FloatProperty;
   if (!entity.isNull())
   {
-    this->properties().data().get<FloatProperty>()[propName][entity] = { propValue };
+    this->properties().data().get<FloatProperty>().value(propName, entity) = { propValue };
   }
 }
 
@@ -1179,7 +1249,7 @@ void Resource::setFloatProperty(
   typedef resource::Properties::Indexed<std::vector<double>> FloatProperty;
   if (!entity.isNull())
   {
-    this->properties().data().get<FloatProperty>()[propName][entity] = propValue;
+    this->properties().data().get<FloatProperty>().value(propName, entity) = propValue;
   }
 }
 
@@ -1201,7 +1271,7 @@ smtk::model::FloatList& Resource::floatProperty(const UUID& entity, const std::s
   typedef resource::Properties::Indexed<std::vector<double>> FloatProperty;
   if (!entity.isNull() && this->hasFloatProperty(entity, propName))
   {
-    return this->properties().data().at<FloatProperty>(propName).at(entity);
+    return this->properties().data().get<FloatProperty>().at(propName, entity);
   }
   static FloatList dummy;
   return dummy;
@@ -1224,13 +1294,7 @@ bool Resource::removeFloatProperty(const UUID& entity, const std::string& propNa
   typedef resource::Properties::Indexed<std::vector<double>> FloatProperty;
   if (!entity.isNull())
   {
-    auto& map = this->properties().data().at<FloatProperty>(propName);
-    auto it = map.find(entity);
-    if (it != map.end())
-    {
-      map.erase(it);
-      return true;
-    }
+    return this->properties().data().get<FloatProperty>().erase(propName, entity);
   }
   return false;
 }
@@ -1243,7 +1307,7 @@ void Resource::setStringProperty(
   typedef resource::Properties::Indexed<std::vector<std::string>> StringProperty;
   if (!entity.isNull())
   {
-    this->properties().data().get<StringProperty>()[propName][entity] = { propValue };
+    this->properties().data().get<StringProperty>().value(propName, entity) = { propValue };
   }
 }
 
@@ -1255,7 +1319,7 @@ void Resource::setStringProperty(
   typedef resource::Properties::Indexed<std::vector<std::string>> StringProperty;
   if (!entity.isNull())
   {
-    this->properties().data().get<StringProperty>()[propName][entity] = propValue;
+    this->properties().data().get<StringProperty>().value(propName, entity) = propValue;
   }
 }
 
@@ -1277,7 +1341,7 @@ smtk::model::StringList& Resource::stringProperty(const UUID& entity, const std:
   typedef resource::Properties::Indexed<std::vector<std::string>> StringProperty;
   if (!entity.isNull() && this->hasStringProperty(entity, propName))
   {
-    return this->properties().data().at<StringProperty>(propName).at(entity);
+    return this->properties().data().get<StringProperty>().at(propName, entity);
   }
   static StringList dummy;
   return dummy;
@@ -1300,13 +1364,7 @@ bool Resource::removeStringProperty(const UUID& entity, const std::string& propN
   typedef resource::Properties::Indexed<std::vector<std::string>> StringProperty;
   if (!entity.isNull())
   {
-    auto& map = this->properties().data().at<StringProperty>(propName);
-    auto it = map.find(entity);
-    if (it != map.end())
-    {
-      map.erase(it);
-      return true;
-    }
+    return this->properties().data().get<StringProperty>().erase(propName, entity);
   }
   return false;
 }
@@ -1321,8 +1379,8 @@ void Resource::setIntegerProperty(
   {
     // this->properties().data().get<IntProperty>()[propName]
     //   .emplace(std::make_pair(entity, propValue));
-    this->properties().data().get<IntProperty>()[propName].emplace(
-      std::make_pair(smtk::common::UUID(entity), std::vector<long>(1, propValue)));
+    this->properties().data().get<IntProperty>().insert(
+      propName, entity, std::vector<long>(1, propValue));
     // this->properties().data().get<IntProperty>()[propName][entity] = { propValue };
   }
 }
@@ -1335,7 +1393,7 @@ void Resource::setIntegerProperty(
   typedef resource::Properties::Indexed<std::vector<long>> IntProperty;
   if (!entity.isNull())
   {
-    this->properties().data().get<IntProperty>()[propName][entity] = propValue;
+    this->properties().data().get<IntProperty>().value(propName, entity) = propValue;
   }
 }
 
@@ -1357,7 +1415,7 @@ smtk::model::IntegerList& Resource::integerProperty(const UUID& entity, const st
   typedef resource::Properties::Indexed<std::vector<long>> IntProperty;
   if (!entity.isNull() && this->hasIntegerProperty(entity, propName))
   {
-    return this->properties().data().at<IntProperty>(propName).at(entity);
+    return this->properties().data().get<IntProperty>().at(propName, entity);
   }
   static IntegerList dummy;
   return dummy;
@@ -1379,13 +1437,7 @@ bool Resource::removeIntegerProperty(const UUID& entity, const std::string& prop
   typedef resource::Properties::Indexed<std::vector<long>> IntProperty;
   if (!entity.isNull())
   {
-    auto& map = this->properties().data().at<IntProperty>(propName);
-    auto it = map.find(entity);
-    if (it != map.end())
-    {
-      map.erase(it);
-      return true;
-    }
+    return this->properties().data().get<IntProperty>().erase(propName, entity);
   }
   return false;
 }
@@ -1394,16 +1446,30 @@ bool Resource::removeIntegerProperty(const UUID& entity, const std::string& prop
 /// Attempt to find a model owning the given entity.
 UUID Resource::modelOwningEntity(const UUID& ent) const
 {
+  UUID result;
+  if (m_owners->find(OwnerCache::MODEL, ent, result))
+  {
+    return result;
+  }
+  std::uint64_t generation = this->topologyGeneration();
   std::set<UUID> visited;
-  UUID result = this->modelOwningEntityRecursive(ent, visited);
+  result = this->modelOwningEntityRecursive(ent, visited);
+  m_owners->insert(OwnerCache::MODEL, ent, result, generation);
   return result;
 }
 
 /// Attempt to find a session owning the given entity.
 UUID Resource::sessionOwningEntity(const UUID& ent) const
 {
+  UUID result;
+  if (m_owners->find(OwnerCache::SESSION, ent, result))
+  {
+    return result;
+  }
+  std::uint64_t generation = this->topologyGeneration();
   std::set<UUID> visited;
-  UUID result = this->sessionOwningEntityRecursive(ent, visited);
+  result = this->sessionOwningEntityRecursive(ent, visited);
+  m_owners->insert(OwnerCache::SESSION, ent, result, generation);
   return result;
 }
 
@@ -1563,7 +1629,8 @@ void Resource::assignDefaultNamesWithOwner(
   UUIDArray::const_iterator relIt;
   BitFlags iflg = irec->second->entityFlags();
   BitFlags idim = iflg & ANY_DIMENSION;
-  for (relIt = irec->second->relations().begin(); relIt != irec->second->relations().end(); ++relIt)
+  const UUIDArray& irels(readOnly(irec->second).relations());
+  for (relIt = irels.begin(); relIt != irels.end(); ++relIt)
   {
     UUIDWithEntityPtr child = m_topology->find(*relIt);
     if (child == m_topology->end())
@@ -1710,6 +1777,10 @@ bool Resource::unregisterSession(SessionPtr session, bool expungeSession)
     // Remove the session's entity record, properties, and such, but not
     // records, properties, etc. for entities the session owns.
     m_topology->erase(sessId);
+    m_topologyIndex->erase(sessId);
+    m_entityTypes.erase(sessId);
+    ++m_entityGeneration;
+    this->topologyModified();
     this->properties().data().eraseIdForType<FloatProperty>(sessId);
     this->properties().data().eraseIdForType<StringProperty>(sessId);
     this->properties().data().eraseIdForType<IntProperty>(sessId);
@@ -2113,6 +2184,10 @@ int Resource::unarrangeEntity(const UUID& entityId, ArrangementKind k, int index
   // and if the caller has requested it: remove the entity itself.
   if (removeIfLast && eit->second->arrangementMap().empty())
   {
+    m_topologyIndex->erase(eit->first);
+    m_entityTypes.erase(eit->first);
+    ++m_entityGeneration;
+    this->topologyModified();
     m_topology->erase(eit);
     ++result;
   }
@@ -2171,7 +2246,7 @@ const Arrangements* Resource::hasArrangementsOfKindForEntity(
   {
     return nullptr;
   }
-  return eit->second->hasArrangementsOfKind(kind);
+  return readOnly(eit->second).hasArrangementsOfKind(kind);
 }
 
 /**\brief Return an array of arrangements of the given \a kind for the given \a entity.
@@ -2205,7 +2280,7 @@ const Arrangement* Resource::findArrangement(const UUID& entityId, ArrangementKi
     return nullptr;
   }
 
-  return eit->second->findArrangement(kind, index);
+  return readOnly(eit->second).findArrangement(kind, index);
 }
 
 /**\brief Retrieve arrangement information for an entity.
@@ -2361,7 +2436,7 @@ int Resource::findCellHasUseWithSense(const UUID& cellId, const UUID& use, int s
       Orientation itOrient;
       if (
         it->IndexSenseAndOrientationFromCellHasUse(itIdx, itSense, itOrient) && itIdx >= 0 &&
-        erec->relations()[itIdx] == use && itSense == sense)
+        readOnly(erec).relations()[itIdx] == use && itSense == sense)
       {
         return i;
       }
@@ -2412,7 +2487,7 @@ UUID Resource::cellHasUseOfSenseAndOrientation(const UUID& cell, int sense, Orie
       ait->IndexSenseAndOrientationFromCellHasUse(itIdx, itSense, itOrient);
       if (itSense == sense && itOrient == orient)
       {
-        return this->findEntity(cell)->relations()[itIdx];
+        return readOnly(this->findEntity(cell)).relations()[itIdx];
       }
     }
   }
@@ -2501,6 +2576,7 @@ UUID Resource::findCreateOrReplaceCellUseOfSenseAndOrientation(
     else
       relIdx = entity->findOrAppendRelation(use);
   }
+  this->topologyModified();
 
   if (arrIdx >= 0)
   { // We found an existing use and need to replace it.
@@ -2548,7 +2624,7 @@ UUIDs Resource::useOrShellIncludesShells(const UUID& cellUseOrShell) const
   EntityPtr ent = this->findEntity(cellUseOrShell);
   if (ent && (ent->entityFlags() & (USE_ENTITY | SHELL_ENTITY)))
   {
-    const UUIDArray& rels(ent->relations());
+    const UUIDArray& rels(readOnly(ent).relations());
     const smtk::model::Arrangements* arr;
     if ((arr = this->hasArrangementsOfKindForEntity(cellUseOrShell, INCLUDES)) && !arr->empty())
     {
@@ -2736,6 +2812,7 @@ bool Resource::findOrAddUseToShell(const UUID& shell, const UUID& use)
       {
         useEnt->relations()[shellIdx] = shell;
       }
+      this->topologyModified();
       return true;
     }
     // FIXME: Should we throw() when dimension is wrong?
@@ -3786,8 +3863,8 @@ UUID Resource::modelOwningEntityRecursive(const UUID& ent, std::set<UUID>& visit
 
         // Assume the first relationship that is a group or model is our owner.
         // Keep going up parent groups until we hit the top.
-        for (UUIDArray::const_iterator sit = it->second->relations().begin();
-             sit != it->second->relations().end();
+        for (UUIDArray::const_iterator sit = readOnly(it->second).relations().begin();
+             sit != readOnly(it->second).relations().end();
              ++sit)
         {
           UUIDWithConstEntityPtr subentity = this->topology().find(*sit);
@@ -3799,7 +3876,7 @@ UUID Resource::modelOwningEntityRecursive(const UUID& ent, std::set<UUID>& visit
             { // Switch to finding relations of the group (assume it is our parent)
               uid = subentity->first;
               it = m_topology->find(uid);
-              sit = it->second->relations().begin();
+              sit = readOnly(it->second).relations().begin();
             }
           }
         }
@@ -3807,8 +3884,8 @@ UUID Resource::modelOwningEntityRecursive(const UUID& ent, std::set<UUID>& visit
       break;
       case INSTANCE_ENTITY:
         // Look for any relationship. We assume the first one is our prototype.
-        for (UUIDArray::const_iterator sit = it->second->relations().begin();
-             sit != it->second->relations().end();
+        for (UUIDArray::const_iterator sit = readOnly(it->second).relations().begin();
+             sit != readOnly(it->second).relations().end();
              ++sit)
         {
           UUIDWithConstEntityPtr subentity = this->topology().find(*sit);
@@ -3827,8 +3904,8 @@ UUID Resource::modelOwningEntityRecursive(const UUID& ent, std::set<UUID>& visit
         break;
       case SHELL_ENTITY:
         // Loop for a relationship to a use.
-        for (UUIDArray::const_iterator sit = it->second->relations().begin();
-             sit != it->second->relations().end();
+        for (UUIDArray::const_iterator sit = readOnly(it->second).relations().begin();
+             sit != readOnly(it->second).relations().end();
              ++sit)
         {
           UUIDWithConstEntityPtr subentity = this->topology().find(*sit);
@@ -3843,8 +3920,8 @@ UUID Resource::modelOwningEntityRecursive(const UUID& ent, std::set<UUID>& visit
       // Now fall through and look for the use's relationship to a cell.
       case USE_ENTITY:
         // Look for a relationship to a cell
-        for (UUIDArray::const_iterator sit = it->second->relations().begin();
-             sit != it->second->relations().end();
+        for (UUIDArray::const_iterator sit = readOnly(it->second).relations().begin();
+             sit != readOnly(it->second).relations().end();
              ++sit)
         {
           UUIDWithConstEntityPtr subentity = this->topology().find(*sit);
@@ -3887,8 +3964,8 @@ UUID Resource::modelOwningEntityRecursive(const UUID& ent, std::set<UUID>& visit
         EntityPtr bordEnt = this->findEntity(*uit);
         if (!bordEnt)
           continue;
-        for (UUIDArray::const_iterator rit = bordEnt->relations().begin();
-             rit != bordEnt->relations().end();
+        for (UUIDArray::const_iterator rit = readOnly(bordEnt).relations().begin();
+             rit != readOnly(bordEnt).relations().end();
              ++rit)
         {
           EntityPtr relEnt = this->findEntity(*rit);
@@ -3948,8 +4025,8 @@ UUID Resource::sessionOwningEntityRecursive(const UUID& ent, std::set<UUID>& vis
     // Assume the first relationship that is a session or model is our owner.
     // Keep going up parents until we hit the top.
     UUIDWithConstEntityPtr it = m_topology->find(uid);
-    for (UUIDArray::const_iterator sit = it->second->relations().begin();
-         sit != it->second->relations().end();
+    for (UUIDArray::const_iterator sit = readOnly(it->second).relations().begin();
+         sit != readOnly(it->second).relations().end();
          ++sit)
     {
       UUIDWithConstEntityPtr subentity = this->topology().find(*sit);
@@ -3961,7 +4038,7 @@ UUID Resource::sessionOwningEntityRecursive(const UUID& ent, std::set<UUID>& vis
         { // Switch to finding relations of the model (assume it is our parent)
           uid = subentity->first;
           it = m_topology->find(uid);
-          sit = it->second->relations().begin();
+          sit = readOnly(it->second).relations().begin();
         }
       }
     }
@@ -20,6 +20,7 @@
 #include "smtk/model/AttributeAssignments.h"
 #include "smtk/model/AuxiliaryGeometry.h"
 #include "smtk/model/Entity.h"
+#include "smtk/model/EntityTypeIndex.h"
 #include "smtk/model/Events.h"
 #include "smtk/model/FloatData.h"
 #include "smtk/model/IntegerData.h"
@@ -27,6 +28,7 @@
 #include "smtk/model/SessionRef.h"
 #include "smtk/model/StringData.h"
 #include "smtk/model/Tessellation.h"
+#include "smtk/model/TopologyIndex.h"
 
 #include "smtk/geometry/Resource.h"
 
@@ -39,7 +41,9 @@
 #include <map>
 
 #include <algorithm>
+#include <cstdint>
 #include <map>
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -130,6 +134,25 @@ public:
   UUIDsToEntities& topology();
   const UUIDsToEntities& topology() const;
 
+  /// Return a counter incremented whenever an entity record is removed from
+  /// (or replaced in) the resource. Entity records resolved while the counter
+  /// is unchanged remain owned by the resource.
+  std::uint64_t entityGeneration() const { return m_entityGeneration; }
+
+  /// Return a counter incremented whenever entities are inserted or erased,
+  /// or their types, relations, or arrangements are modified through Entity's
+  /// methods (rather than through the references its accessors return).
+  std::uint64_t topologyGeneration() const;
+  /// Note that an entity's relations or arrangements were modified in place.
+  /// This discards the owners memoized by modelOwningEntity() and
+  /// sessionOwningEntity().
+  void topologyModified();
+
+  /// Read the relations and arrangements of every entity whose topology was
+  /// deferred by a lazy reader. This releases the entities' references to the
+  /// file they were read from, which must be done before it is overwritten.
+  void materializeTopology();
+
   UUIDsToTessellations& tessellations();
   const UUIDsToTessellations& tessellations() const;
 
@@ -191,6 +214,7 @@ public:
   smtk::common::UUIDs adjacentEntities(const smtk::common::UUID& ofEntity, int ofDimension);
 
   smtk::common::UUIDs entitiesMatchingFlags(BitFlags mask, bool exactMatch = true);
+  EntityTypeIndex::Range entitiesMatchingFlagsRange(BitFlags mask, bool exactMatch = true) const;
   smtk::common::UUIDs entitiesOfDimension(int dim);
 
   smtk::common::UUID unusedUUID();
@@ -555,6 +579,9 @@ public:
 
 protected:
   friend class smtk::attribute::Resource;
+  friend class Entity;
+
+  bool gatherComponents(std::vector<smtk::resource::Component*>& components) const override;
 
   void assignDefaultNamesWithOwner(
     const UUIDWithEntityPtr& irec,
@@ -575,6 +602,15 @@ protected:
 
   // Below are all the different things that can be mapped to a UUID:
   smtk::shared_ptr<UUIDsToEntities> m_topology;
+  // A dense index of m_topology used to accelerate traversals.
+  std::unique_ptr<TopologyIndex> m_topologyIndex;
+  // The entities of m_topology, bucketed by type.
+  EntityTypeIndex m_entityTypes;
+  // Incremented whenever a record is removed from m_topology.
+  std::uint64_t m_entityGeneration{ 1 };
+  // Owners memoized by modelOwningEntity() and sessionOwningEntity().
+  class OwnerCache;
+  std::unique_ptr<OwnerCache> m_owners;
   smtk::shared_ptr<UUIDsToTessellations> m_tessellations;
   smtk::shared_ptr<UUIDsToTessellations> m_analysisMesh;
   smtk::shared_ptr<UUIDsToAttributeAssignments> m_attributeAssignments;
@@ -595,21 +631,7 @@ protected:
 template<typename Collection, typename Type>
 Collection Resource::findEntitiesByTypeAndPropertyAs(const std::string& pname, const Type& pval)
 {
-  Collection collection;
-  auto& uuidsToValues =
-    this->properties().data().at<std::unordered_map<smtk::common::UUID, std::vector<Type>>>(pname);
-  for (auto it = uuidsToValues.begin(); it != uuidsToValues.end(); ++it)
-  {
-    if (it->second.size() == 1 && it->second.at(0) == pval)
-    {
-      typename Collection::value_type entry(shared_from_this(), it->first);
-      if (entry.isValid())
-      {
-        collection.insert(collection.end(), entry);
-      }
-    }
-  }
-  return collection;
+  return this->findEntitiesByTypeAndPropertyAs<Collection, Type>(pname, std::vector<Type>{ pval });
 }
 
 template<typename Collection, typename Type>
@@ -618,18 +640,38 @@ Collection Resource::findEntitiesByTypeAndPropertyAs(
   const std::vector<Type>& pval)
 {
   Collection collection;
-  auto& uuidsToValues =
-    this->properties().data().at<std::unordered_map<smtk::common::UUID, std::vector<Type>>>(pname);
-  for (auto it = uuidsToValues.begin(); it != uuidsToValues.end(); ++it)
-  {
-    if (it->second == pval)
+  const auto& properties = this->properties().data();
+  const auto& uuidsToValues =
+    properties.at<std::unordered_map<smtk::common::UUID, std::vector<Type>>>(pname);
+  auto insert = [&](const smtk::common::UUID& uid, const std::vector<Type>& value) {
+    if (value == pval)
     {
-      typename Collection::value_type entry(shared_from_this(), it->first);
+      typename Collection::value_type entry(shared_from_this(), uid);
       if (entry.isValid())
       {
         collection.insert(collection.end(), entry);
       }
     }
+  };
+
+  // When the property is indexed, only test the entities the index admits.
+  smtk::common::UUIDs candidates;
+  if (this->properties().findCandidates<std::vector<Type>>(pname, pval, candidates))
+  {
+    for (const auto& candidate : candidates)
+    {
+      auto it = uuidsToValues.find(candidate);
+      if (it != uuidsToValues.end())
+      {
+        insert(it->first, it->second);
+      }
+    }
+    return collection;
+  }
+
+  for (auto it = uuidsToValues.begin(); it != uuidsToValues.end(); ++it)
+  {
+    insert(it->first, it->second);
   }
   return collection;
 }
@@ -637,9 +679,12 @@ Collection Resource::findEntitiesByTypeAndPropertyAs(
 template<typename Collection>
 Collection Resource::entitiesMatchingFlagsAs(BitFlags mask, bool exactMatch)
 {
-  smtk::common::UUIDs matches = this->entitiesMatchingFlags(mask, exactMatch);
+  // Report matches in the order entitiesMatchingFlags() does.
+  EntityTypeIndex::Range range = m_entityTypes.find(mask, exactMatch);
+  std::vector<smtk::common::UUID> matches(range.begin(), range.end());
+  std::sort(matches.begin(), matches.end());
   Collection collection;
-  for (smtk::common::UUIDs::iterator it = matches.begin(); it != matches.end(); ++it)
+  for (auto it = matches.begin(); it != matches.end(); ++it)
   {
     typename Collection::value_type entry(shared_from_this(), *it);
     if (entry.isValid())
@@ -13,6 +13,7 @@
 #include "smtk/attribute/IntItem.h"
 #include "smtk/common/CompilerInformation.h"
 #include "smtk/common/UUID.h"
+#include "smtk/common/json/jsonBinary.h"
 #include "smtk/model/Resource.h"
 
 #include "smtk/model/json/jsonResource.h"
@@ -39,21 +40,26 @@ bool SessionIOJSON::saveModelRecords(const json& j, const std::string& url)
     smtkErrorMacro(smtk::io::Logger::instance(), "A filename must be specified.");
     return false;
   }
-  std::ofstream file(url);
+  std::ofstream file(url, std::ios::out | std::ios::binary);
   if (!file.good())
   {
     smtkErrorMacro(smtk::io::Logger::instance(), "Unable to open \"" << url << "\" for writing.");
     return false;
   }
-  file << j.dump(2);
+  smtk::common::BinaryJSON::dump(j, file, smtk::common::BinaryJSON::isBinaryLocation(url));
   file.close();
+  if (file.fail())
+  {
+    smtkErrorMacro(smtk::io::Logger::instance(), "Unable to write \"" << url << "\".");
+    return false;
+  }
   return true;
 }
 
 json SessionIOJSON::loadJSON(const std::string& filename)
 {
   json result;
-  std::ifstream file(filename);
+  std::ifstream file(filename, std::ios::in | std::ios::binary);
   if (!file.good())
   {
     smtkErrorMacro(
@@ -62,7 +68,7 @@ json SessionIOJSON::loadJSON(const std::string& filename)
   }
   try
   {
-    result = json::parse(file);
+    result = smtk::common::BinaryJSON::parse(file);
   }
   catch (...)
   {
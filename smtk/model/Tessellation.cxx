@@ -9,6 +9,8 @@
 //=========================================================================
 #include "smtk/model/Tessellation.h"
 
+#include "smtk/model/TessellationBuffers.h"
+
 #include <cfloat>
 #include <iostream>
 
@@ -22,6 +24,7 @@ Tessellation::Tessellation() = default;
 /// Add a 3-D point coordinate to the tessellation, but not a vertex record.
 int Tessellation::addCoords(const double* a)
 {
+  this->invalidateBuffers();
   std::vector<double>::size_type ipt = m_coords.size();
   for (int i = 0; i < 3; ++i)
   {
@@ -33,6 +36,7 @@ int Tessellation::addCoords(const double* a)
 /// Add a 3-D point coordinate to the tessellation, but not a vertex record.
 Tessellation& Tessellation::addCoords(double x, double y, double z)
 {
+  this->invalidateBuffers();
   m_coords.push_back(x);
   m_coords.push_back(y);
   m_coords.push_back(z);
@@ -71,6 +75,7 @@ Tessellation::addQuad(const double* a, const double* b, const double* c, const d
 /// Add a vertex record using a pre-existing point coordinate (referenced by ID).
 Tessellation& Tessellation::addPoint(int ai)
 {
+  this->invalidateBuffers();
   m_conn.push_back(TESS_VERTEX);
   m_conn.push_back(ai);
   return *this;
@@ -79,6 +84,7 @@ Tessellation& Tessellation::addPoint(int ai)
 /// Add a line-segment record using 2 pre-existing point coordinates (referenced by ID).
 Tessellation& Tessellation::addLine(int ai, int bi)
 {
+  this->invalidateBuffers();
   m_conn.push_back(TESS_POLYLINE);
   m_conn.push_back(2);
   m_conn.push_back(ai);
@@ -89,6 +95,7 @@ Tessellation& Tessellation::addLine(int ai, int bi)
 /// Add a triangle record using 3 pre-existing point coordinates (referenced by ID).
 Tessellation& Tessellation::addTriangle(int ai, int bi, int ci)
 {
+  this->invalidateBuffers();
   m_conn.push_back(TESS_TRIANGLE);
   m_conn.push_back(ai);
   m_conn.push_back(bi);
@@ -99,6 +106,7 @@ Tessellation& Tessellation::addTriangle(int ai, int bi, int ci)
 /// Add a quadrilateral record using 4 pre-existing point coordinates (referenced by ID).
 Tessellation& Tessellation::addQuad(int ai, int bi, int ci, int di)
 {
+  this->invalidateBuffers();
   m_conn.push_back(TESS_QUAD);
   m_conn.push_back(ai);
   m_conn.push_back(bi);
@@ -121,6 +129,7 @@ void Tessellation::setPoint(std::size_t id, const double* points)
 /// Erase all point coordinates and tessellation primitive records.
 Tessellation& Tessellation::reset()
 {
+  this->invalidateBuffers();
   m_conn.clear();
   m_coords.clear();
   return *this;
@@ -374,6 +383,7 @@ bool Tessellation::insertCell(size_type offset, size_type conn_length, const int
     return false;
   }
 
+  this->invalidateBuffers();
   std::vector<int>::iterator cur_insert = m_conn.begin() + offset;
   m_conn.insert(cur_insert, cellConn, cellConn + conn_length);
   return true;
@@ -477,5 +487,34 @@ bool Tessellation::getBoundingBox(double bbox[6]) const
   return true;
 }
 
+/**\brief Return the coordinates and primitives of the tessellation in separate buffers.
+  *
+  * The buffers are built on first use and shared by subsequent calls (and
+  * by copies of the tessellation) until the tessellation is modified, so
+  * renderers may hold them without copying. When \a singlePrecision is true,
+  * coordinates are converted to floats.
+  *
+  * Calling the non-const coords() or conn() methods discards the buffers,
+  * so references obtained from them should not be held across calls to
+  * this method.
+  */
+std::shared_ptr<const TessellationBuffers> Tessellation::buffers(bool singlePrecision) const
+{
+  std::shared_ptr<const TessellationBuffers>& cached(m_buffers[singlePrecision ? 1 : 0]);
+  std::shared_ptr<const TessellationBuffers> result = std::atomic_load(&cached);
+  if (!result)
+  {
+    result = std::make_shared<const TessellationBuffers>(*this, singlePrecision);
+    std::atomic_store(&cached, result);
+  }
+  return result;
+}
+
+void Tessellation::invalidateBuffers()
+{
+  m_buffers[0].reset();
+  m_buffers[1].reset();
+}
+
 } // namespace model
 } // namespace smtk
@@ -13,6 +13,7 @@
 #include "smtk/common/UUID.h"
 
 #include <map>
+#include <memory>
 #include <vector>
 
 namespace smtk
@@ -20,6 +21,8 @@ namespace smtk
 namespace model
 {
 
+class TessellationBuffers;
+
 /**\brief Cell type information bit-vector constants.
   *
   * This enum holds specific bit-vector combinations used
@@ -87,6 +90,9 @@ enum TessellationCellType
   * and uv-coordinate IDs), there is no storage for additional
   * properties (i.e., no normals, colors, or uv-coordinates).
   * That may change in the future.
+  *
+  * For rendering, buffers() provides a compact copy of the coordinates
+  * and connectivity with a separate index buffer per type of primitive.
   */
 class SMTKCORE_EXPORT Tessellation
 {
@@ -96,12 +102,20 @@ public:
   Tessellation();
 
   /// Direct access to the underlying point-coordinate storage
-  std::vector<double>& coords() { return m_coords; }
+  std::vector<double>& coords()
+  {
+    this->invalidateBuffers();
+    return m_coords;
+  }
   /// Direct access to the underlying point-coordinate storage
   std::vector<double> const& coords() const { return m_coords; }
 
   /// Direct access to the underlying connectivity storage
-  std::vector<int>& conn() { return m_conn; }
+  std::vector<int>& conn()
+  {
+    this->invalidateBuffers();
+    return m_conn;
+  }
   /// Direct access to the underlying connectivity storage
   std::vector<int> const& conn() const { return m_conn; }
 
@@ -154,9 +168,16 @@ public:
   static void invalidBoundingBox(double bbox[6]);
   bool getBoundingBox(double bbox[6]) const;
 
+  std::shared_ptr<const TessellationBuffers> buffers(bool singlePrecision = false) const;
+
 protected:
+  // Discard the buffers built from the coordinates and connectivity.
+  void invalidateBuffers();
+
   std::vector<double> m_coords;
   std::vector<int> m_conn;
+  // Buffers built on demand in double (0) and single (1) precision.
+  mutable std::shared_ptr<const TessellationBuffers> m_buffers[2];
 };
 
 typedef std::map<smtk::common::UUID, Tessellation> UUIDsToTessellations;
@@ -0,0 +1,107 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/model/TessellationBuffers.h"
+
+#include "smtk/model/Tessellation.h"
+
+namespace smtk
+{
+namespace model
+{
+
+/// Copy the coordinates and primitives of \a tess into separate buffers.
+TessellationBuffers::TessellationBuffers(const Tessellation& tess, bool singlePrecision)
+  : m_singlePrecision(singlePrecision)
+{
+  const std::vector<double>& coords(tess.coords());
+  if (singlePrecision)
+  {
+    m_floatCoords.assign(coords.begin(), coords.end());
+  }
+  else
+  {
+    m_coords = coords;
+  }
+
+  const std::vector<int>& conn(tess.conn());
+  for (Tessellation::size_type off = tess.begin(); off != tess.end();
+       off = tess.nextCellOffset(off))
+  {
+    Tessellation::size_type cellType;
+    Tessellation::size_type numVerts = tess.numberOfCellVertices(off, &cellType);
+    Primitive primitive;
+    switch (Tessellation::cellShapeFromType(cellType))
+    {
+      case TESS_VERTEX:
+      case TESS_POLYVERTEX:
+        primitive = VERTICES;
+        break;
+      case TESS_POLYLINE:
+        primitive = LINES;
+        break;
+      case TESS_TRIANGLE:
+      case TESS_QUAD:
+      case TESS_POLYGON:
+        primitive = POLYGONS;
+        break;
+      case TESS_TRIANGLE_STRIP:
+        primitive = STRIPS;
+        break;
+      default:
+        continue;
+    }
+    // Vertex IDs follow the cell type (and the vertex count, when it varies).
+    const int* ids = &conn[off + ((cellType & TESS_VARYING_VERT_CELL) ? 2 : 1)];
+
+    Buffer& buffer(m_primitives[primitive]);
+    if (buffer.m_offsets.empty())
+    {
+      buffer.m_offsets.push_back(0);
+    }
+    buffer.m_connectivity.insert(buffer.m_connectivity.end(), ids, ids + numVerts);
+    buffer.m_offsets.push_back(static_cast<std::int32_t>(buffer.m_connectivity.size()));
+
+    if (primitive == POLYGONS)
+    {
+      // Polygons are assumed convex (as VTK does), so a fan suffices.
+      for (Tessellation::size_type ii = 2; ii < numVerts; ++ii)
+      {
+        m_triangles.push_back(ids[0]);
+        m_triangles.push_back(ids[ii - 1]);
+        m_triangles.push_back(ids[ii]);
+      }
+    }
+    else if (primitive == STRIPS)
+    {
+      // Swap the first two vertices of every other triangle to preserve orientation.
+      for (Tessellation::size_type ii = 2; ii < numVerts; ++ii)
+      {
+        bool odd = (ii % 2) != 0;
+        m_triangles.push_back(ids[odd ? ii - 1 : ii - 2]);
+        m_triangles.push_back(ids[odd ? ii - 2 : ii - 1]);
+        m_triangles.push_back(ids[ii]);
+      }
+    }
+  }
+}
+
+std::size_t TessellationBuffers::numberOfPoints() const
+{
+  return (m_singlePrecision ? m_floatCoords.size() : m_coords.size()) / 3;
+}
+
+std::size_t TessellationBuffers::numberOfCells(Primitive primitive) const
+{
+  const std::vector<std::int32_t>& offsets(m_primitives[primitive].m_offsets);
+  return offsets.empty() ? 0 : offsets.size() - 1;
+}
+
+} // namespace model
+} // namespace smtk
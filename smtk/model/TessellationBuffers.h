@@ -0,0 +1,134 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_model_TessellationBuffers_h
+#define smtk_model_TessellationBuffers_h
+
+#include "smtk/CoreExports.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace smtk
+{
+namespace model
+{
+
+class Tessellation;
+
+/**\brief A compact copy of a Tessellation arranged for rendering.
+  *
+  * Where a Tessellation interleaves cell types, vertex counts, and
+  * property IDs in a single connectivity array, this class holds a
+  * separate index buffer for each kind of primitive along with the
+  * point coordinates (optionally converted to single precision).
+  * Each buffer is contiguous, so it may be handed to a graphics API or
+  * wrapped by a VTK data array without further copies.
+  *
+  * Connectivity and offsets follow the layout of VTK's cell arrays: the
+  * vertex IDs of each primitive's cells are concatenated and the offsets
+  * hold the start of each cell followed by the total number of IDs.
+  * Polygons and triangle strips are also decomposed into a single buffer
+  * of triangles with 3 vertex IDs apiece.
+  *
+  * Instances are immutable; Tessellation::buffers() returns a shared
+  * instance that is rebuilt after the tessellation is modified.
+  */
+class SMTKCORE_EXPORT TessellationBuffers
+{
+public:
+  /// A contiguous, non-owning view of a buffer.
+  template<typename T>
+  class Span
+  {
+  public:
+    Span() = default;
+    Span(T* data, std::size_t size)
+      : m_data(data)
+      , m_size(size)
+    {
+    }
+
+    T* data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    T* begin() const { return m_data; }
+    T* end() const { return m_data + m_size; }
+    T& operator[](std::size_t ii) const { return m_data[ii]; }
+
+  private:
+    T* m_data{ nullptr };
+    std::size_t m_size{ 0 };
+  };
+
+  /// The kinds of primitives held in separate buffers.
+  enum Primitive
+  {
+    VERTICES, //!< Vertices and polyvertices.
+    LINES,    //!< Polylines.
+    POLYGONS, //!< Triangles, quadrilaterals, and polygons.
+    STRIPS,   //!< Triangle strips.
+    NUMBER_OF_PRIMITIVES
+  };
+
+  TessellationBuffers(const Tessellation& tess, bool singlePrecision);
+
+  /// Return true if coordinates are held in single precision.
+  bool isSinglePrecision() const { return m_singlePrecision; }
+  /// Return the number of points (each with 3 coordinates).
+  std::size_t numberOfPoints() const;
+
+  /// Return the point coordinates (empty when isSinglePrecision()).
+  Span<const double> coords() const { return span(m_coords); }
+  /// Return the point coordinates (empty unless isSinglePrecision()).
+  Span<const float> floatCoords() const { return span(m_floatCoords); }
+
+  /// Return the vertex IDs of every cell of the given \a primitive.
+  Span<const std::int32_t> connectivity(Primitive primitive) const
+  {
+    return span(m_primitives[primitive].m_connectivity);
+  }
+  /// Return the offset of each cell of the given \a primitive into its connectivity
+  /// (plus a final entry), or nothing when there are no cells.
+  Span<const std::int32_t> offsets(Primitive primitive) const
+  {
+    return span(m_primitives[primitive].m_offsets);
+  }
+  /// Return the number of cells of the given \a primitive.
+  std::size_t numberOfCells(Primitive primitive) const;
+
+  /// Return the vertex IDs of polygons and strips decomposed into triangles.
+  Span<const std::int32_t> triangles() const { return span(m_triangles); }
+
+private:
+  struct Buffer
+  {
+    std::vector<std::int32_t> m_connectivity;
+    std::vector<std::int32_t> m_offsets;
+  };
+
+  template<typename T>
+  static Span<const T> span(const std::vector<T>& values)
+  {
+    return Span<const T>(values.data(), values.size());
+  }
+
+  bool m_singlePrecision;
+  std::vector<double> m_coords;
+  std::vector<float> m_floatCoords;
+  Buffer m_primitives[NUMBER_OF_PRIMITIVES];
+  std::vector<std::int32_t> m_triangles;
+};
+
+} // namespace model
+} // namespace smtk
+
+#endif // smtk_model_TessellationBuffers_h
@@ -0,0 +1,469 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/model/TopologyIndex.h"
+
+#include "smtk/model/Arrangement.h"
+
+#include <algorithm>
+
+namespace smtk
+{
+namespace model
+{
+
+namespace
+{
+// Rows are discarded (rather than compacted in place) once refreshed and
+// erased rows leave more unused entries than this in the relation arrays
+// and those unused entries outnumber the ones in use.
+constexpr std::size_t minimumGarbage = 4096;
+
+std::size_t rowSize(const std::uint32_t* relations, const std::uint32_t* related)
+{
+  return (relations[1] - relations[0]) + (related[KINDS_OF_ARRANGEMENTS] - related[0]);
+}
+} // namespace
+
+constexpr TopologyIndex::Slot TopologyIndex::invalidSlot;
+
+TopologyIndex::TopologyIndex(const Entities& topology)
+  : m_topology(topology)
+{
+}
+
+void TopologyIndex::traverse(const std::function<void(Walker&)>& traversal) const
+{
+  {
+    smtk::resource::ScopedLockGuard guard(m_lock, smtk::resource::LockType::Read);
+    if (!this->mustRebuild())
+    {
+      Walker walker(*this, false);
+      traversal(walker);
+      if (!walker.isStale())
+      {
+        return;
+      }
+    }
+  }
+
+  // Some rows must be refreshed; do so with exclusive access to the index.
+  smtk::resource::ScopedLockGuard guard(m_lock, smtk::resource::LockType::Write);
+  auto* self = const_cast<TopologyIndex*>(this);
+  if (this->mustRebuild())
+  {
+    self->rebuild();
+  }
+  Walker walker(*this, true);
+  traversal(walker);
+}
+
+void TopologyIndex::insert(const EntityPtr& entity)
+{
+  if (!entity)
+  {
+    return;
+  }
+  smtk::resource::ScopedLockGuard guard(m_lock, smtk::resource::LockType::Write);
+  if (m_invalid)
+  {
+    return;
+  }
+  auto it = m_slots.find(entity->id());
+  if (it != m_slots.end())
+  {
+    m_entities[it->second] = entity;
+    m_current[it->second] = 0;
+  }
+  else if (m_unresolved)
+  {
+    // Rows that refer to the entity (or to an entity previously held under its
+    // UUID) cannot be found, so start over.
+    m_invalid = true;
+  }
+  // Otherwise, the entity is assigned a slot when it is first traversed.
+}
+
+void TopologyIndex::erase(const smtk::common::UUID& uid)
+{
+  smtk::resource::ScopedLockGuard guard(m_lock, smtk::resource::LockType::Write);
+  if (m_invalid)
+  {
+    return;
+  }
+  auto it = m_slots.find(uid);
+  if (it == m_slots.end())
+  {
+    return;
+  }
+  Slot slot = it->second;
+  m_garbage += rowSize(m_rows[slot].m_relations, m_rows[slot].m_related.data());
+  m_rows[slot] = Row();
+  m_entities[slot].reset();
+  m_current[slot] = 0;
+  m_slots.erase(it);
+  --m_live;
+  // Other rows may still refer to the erased slot.
+  m_unresolved = true;
+}
+
+void TopologyIndex::invalidate()
+{
+  smtk::resource::ScopedLockGuard guard(m_lock, smtk::resource::LockType::Write);
+  m_invalid = true;
+}
+
+std::size_t TopologyIndex::size() const
+{
+  smtk::resource::ScopedLockGuard guard(m_lock, smtk::resource::LockType::Read);
+  return m_invalid ? 0 : m_live;
+}
+
+bool TopologyIndex::mustRebuild() const
+{
+  return m_invalid ||
+    (m_garbage > minimumGarbage && 2 * m_garbage > m_relations.size() + m_related.size());
+}
+
+void TopologyIndex::rebuild()
+{
+  m_slots.clear();
+  m_ids.clear();
+  m_entities.clear();
+  m_flags.clear();
+  m_dimensions.clear();
+  m_versions.clear();
+  m_current.clear();
+  m_rows.clear();
+  m_relations.clear();
+  m_related.clear();
+  m_live = 0;
+  m_garbage = 0;
+  m_invalid = false;
+  m_unresolved = false;
+
+  // Slots are assigned (and rows recorded) as entities are traversed.
+  m_slots.reserve(m_topology.size());
+}
+
+TopologyIndex::Slot TopologyIndex::assign(const EntityPtr& entity)
+{
+  Slot slot = static_cast<Slot>(m_ids.size());
+  m_slots[entity->id()] = slot;
+  m_ids.push_back(entity->id());
+  m_entities.push_back(entity);
+  m_flags.push_back(INVALID);
+  m_dimensions.push_back(-1);
+  m_versions.push_back(0);
+  m_current.push_back(0);
+  m_rows.push_back(Row());
+  ++m_live;
+  return slot;
+}
+
+void TopologyIndex::refresh(Slot slot)
+{
+  // Assigning slots to relations below may reallocate m_entities.
+  EntityPtr entity = m_entities[slot];
+  const Entity& record(*entity);
+  // Record the version before reading the entity so that any modification
+  // made while the row is recorded is noticed on the next traversal.
+  m_versions[slot] = record.topologyVersion();
+  m_flags[slot] = record.entityFlags();
+  m_dimensions[slot] = record.dimension();
+
+  Row row;
+  m_garbage += rowSize(m_rows[slot].m_relations, m_rows[slot].m_related.data());
+
+  // Record the entity's relations as slots.
+  const smtk::common::UUIDArray& relations(record.relations());
+  row.m_relations[0] = static_cast<std::uint32_t>(m_relations.size());
+  for (const auto& uid : relations)
+  {
+    Slot related = invalidSlot;
+    auto it = m_slots.find(uid);
+    if (it != m_slots.end())
+    {
+      related = it->second;
+    }
+    else if (!uid.isNull())
+    {
+      auto eit = m_topology.find(uid);
+      if (eit != m_topology.end() && eit->second)
+      {
+        related = this->assign(eit->second);
+      }
+      else
+      {
+        m_unresolved = true;
+      }
+    }
+    m_relations.push_back(related);
+  }
+  row.m_relations[1] = static_cast<std::uint32_t>(m_relations.size());
+
+  // Flatten the relations named by each kind of arrangement, following the
+  // conventions of EntityRefArrangementOps::appendAllRelations().
+  const int numberOfRelations = static_cast<int>(row.m_relations[1] - row.m_relations[0]);
+  auto appendRelated = [&](int relIdx) {
+    if (relIdx >= 0 && relIdx < numberOfRelations)
+    {
+      m_related.push_back(m_relations[row.m_relations[0] + relIdx]);
+    }
+  };
+  const KindsToArrangements& arrangements(record.arrangementMap());
+  auto kit = arrangements.begin();
+  for (int kind = 0; kind < KINDS_OF_ARRANGEMENTS; ++kind)
+  {
+    row.m_related[kind] = static_cast<std::uint32_t>(m_related.size());
+    for (; kit != arrangements.end() && kit->first < kind; ++kit)
+    {
+    }
+    if (kit == arrangements.end() || kit->first != kind)
+    {
+      continue;
+    }
+    for (const auto& arrangement : kit->second)
+    {
+      int relIdx;
+      int sense;
+      Orientation orientation;
+      if (kind == HAS_USE && isCellEntity(m_flags[slot]))
+      {
+        if (arrangement.IndexSenseAndOrientationFromCellHasUse(relIdx, sense, orientation))
+        {
+          appendRelated(relIdx);
+        }
+      }
+      else if (kind == HAS_USE && isShellEntity(m_flags[slot]))
+      {
+        int relEnd;
+        if (arrangement.IndexRangeFromShellHasUse(relIdx, relEnd))
+        {
+          for (; relIdx < relEnd; ++relIdx)
+          {
+            appendRelated(relIdx);
+          }
+        }
+      }
+      else if (kind == HAS_CELL && isUseEntity(m_flags[slot]))
+      {
+        if (arrangement.IndexAndSenseFromUseHasCell(relIdx, sense))
+        {
+          appendRelated(relIdx);
+        }
+      }
+      else
+      {
+        for (int detail : arrangement.details())
+        {
+          appendRelated(detail);
+        }
+      }
+    }
+  }
+  row.m_related[KINDS_OF_ARRANGEMENTS] = static_cast<std::uint32_t>(m_related.size());
+
+  m_rows[slot] = row;
+  m_current[slot] = 1;
+}
+
+TopologyIndex::Slot TopologyIndex::Walker::slot(const smtk::common::UUID& uid)
+{
+  auto it = m_index.m_slots.find(uid);
+  if (it != m_index.m_slots.end())
+  {
+    return it->second;
+  }
+  auto eit = m_index.m_topology.find(uid);
+  if (eit == m_index.m_topology.end() || !eit->second)
+  {
+    return invalidSlot;
+  }
+  if (!m_exclusive)
+  {
+    m_stale = true;
+    return invalidSlot;
+  }
+  return m_index.assign(eit->second);
+}
+
+BitFlags TopologyIndex::Walker::flags(Slot slot)
+{
+  return this->isValid(slot) && this->prepare(slot) ? m_index.m_flags[slot] : INVALID;
+}
+
+int TopologyIndex::Walker::dimension(Slot slot)
+{
+  return this->isValid(slot) && this->prepare(slot) ? m_index.m_dimensions[slot] : -1;
+}
+
+TopologyIndex::Slot TopologyIndex::Walker::firstRelated(Slot slot, ArrangementKind kind)
+{
+  if (!this->isValid(slot) || kind >= KINDS_OF_ARRANGEMENTS || !this->prepare(slot))
+  {
+    return invalidSlot;
+  }
+  const Row& row = m_index.m_rows[slot];
+  for (std::uint32_t ii = row.m_related[kind]; ii < row.m_related[kind + 1]; ++ii)
+  {
+    if (this->isValid(m_index.m_related[ii]))
+    {
+      return m_index.m_related[ii];
+    }
+  }
+  return invalidSlot;
+}
+
+void TopologyIndex::Walker::bordants(Slot slot, int ofDimension, std::vector<Slot>& result)
+{
+  int dimension = this->dimension(slot);
+  if (!this->isValid(slot) || (ofDimension >= 0 && dimension >= ofDimension))
+  {
+    // can't ask for "higher" dimensional boundaries that are lower than the dimension of this cell.
+    return;
+  }
+  BitFlags cellFlags = this->flags(slot);
+  this->visitRelations(slot, [&](Slot other) {
+    int otherDimension = this->dimension(other);
+    if (
+      (ofDimension >= 0 && otherDimension == ofDimension) ||
+      (ofDimension == -2 && otherDimension >= dimension))
+    { // The dimension is higher, so dumbly push it into the result:
+      result.push_back(other);
+    }
+    else if ((cellFlags & CELL_ENTITY) && (this->flags(other) & USE_ENTITY))
+    { // ... or it is a use: follow the use upwards.
+      this->visitRelated(other, HAS_SHELL, [&](Slot shell) {
+        if (!isShellEntity(this->flags(shell)))
+        {
+          return;
+        }
+        Slot cell = this->boundingCell(shell);
+        if (this->isValid(cell) && this->dimension(cell) >= ofDimension)
+        {
+          result.push_back(cell);
+        }
+      });
+    }
+  });
+}
+
+void TopologyIndex::Walker::boundaries(Slot slot, int ofDimension, std::vector<Slot>& result)
+{
+  int dimension = this->dimension(slot);
+  if (!this->isValid(slot) || (ofDimension >= 0 && dimension <= ofDimension))
+  {
+    // can't ask for "lower" dimensional boundaries that are higher than the dimension of this cell.
+    return;
+  }
+  BitFlags cellFlags = this->flags(slot);
+  std::vector<Slot> shells;
+  this->visitRelations(slot, [&](Slot other) {
+    int otherDimension = this->dimension(other);
+    if (
+      (ofDimension >= 0 && otherDimension == ofDimension) ||
+      (ofDimension == -2 && otherDimension <= dimension && !isModel(this->flags(other))))
+    {
+      result.push_back(other);
+    }
+    else if ((cellFlags & CELL_ENTITY) && (this->flags(other) & USE_ENTITY))
+    { // ... or it is a use: follow the use downwards.
+      shells.clear();
+      auto addShell = [&](Slot shell) {
+        if (isShellEntity(this->flags(shell)))
+        {
+          shells.push_back(shell);
+        }
+      };
+      this->visitRelated(other, INCLUDES, addShell);
+      // Inner shells owned by each shell are appended as the shells are visited.
+      for (std::size_t ii = 0; ii < shells.size(); ++ii)
+      {
+        this->visitRelated(shells[ii], HAS_USE, [&](Slot use) {
+          if (!isUseEntity(this->flags(use)))
+          {
+            return;
+          }
+          Slot cell = this->firstRelated(use, HAS_CELL);
+          if (
+            this->isValid(cell) && isCellEntity(this->flags(cell)) &&
+            this->dimension(cell) <= ofDimension)
+          {
+            result.push_back(cell);
+          }
+        });
+        this->visitRelated(shells[ii], INCLUDES, addShell);
+      }
+    }
+  });
+}
+
+void TopologyIndex::Walker::unique(std::vector<Slot>& slots)
+{
+  std::sort(slots.begin(), slots.end());
+  slots.erase(std::unique(slots.begin(), slots.end()), slots.end());
+}
+
+void TopologyIndex::Walker::ids(const std::vector<Slot>& slots, smtk::common::UUIDs& uids) const
+{
+  for (Slot slot : slots)
+  {
+    if (this->isValid(slot))
+    {
+      uids.insert(m_index.m_ids[slot]);
+    }
+  }
+}
+
+bool TopologyIndex::Walker::prepare(Slot slot)
+{
+  if (m_index.isCurrent(slot))
+  {
+    return true;
+  }
+  if (!m_exclusive)
+  {
+    m_stale = true;
+    return false;
+  }
+  m_index.refresh(slot);
+  return true;
+}
+
+TopologyIndex::Slot TopologyIndex::Walker::boundingCell(Slot shell)
+{
+  // Find the use whose interior the top-level shell containing \a shell bounds.
+  Slot result = this->firstRelated(shell, EMBEDDED_IN);
+  while (this->isValid(result) && isShellEntity(this->flags(result)))
+  {
+    result = this->firstRelated(result, EMBEDDED_IN);
+  }
+  // Volumes hold their top-level shells directly rather than through a use.
+  if (this->isValid(result) && isCellEntity(this->flags(result)))
+  {
+    Slot use = invalidSlot;
+    this->visitRelated(result, HAS_USE, [&](Slot candidate) {
+      if (use == invalidSlot && isUseEntity(this->flags(candidate)))
+      {
+        use = candidate;
+      }
+    });
+    result = use;
+  }
+  if (!this->isValid(result) || !isUseEntity(this->flags(result)))
+  {
+    return invalidSlot;
+  }
+  Slot cell = this->firstRelated(result, HAS_CELL);
+  return isCellEntity(this->flags(cell)) ? cell : invalidSlot;
+}
+
+} // namespace model
+} // namespace smtk
@@ -0,0 +1,251 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_model_TopologyIndex_h
+#define smtk_model_TopologyIndex_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+
+#include "smtk/model/ArrangementKind.h"
+#include "smtk/model/Entity.h"
+#include "smtk/model/EntityTypeBits.h"
+
+#include "smtk/resource/Lock.h"
+
+#include "smtk/common/UUID.h"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace smtk
+{
+namespace model
+{
+
+/**\brief A dense, slot-based index of a model resource's topology.
+  *
+  * Entities remain the primary storage of a model's topology: each holds
+  * an array of related UUIDs and arrangements that index into that array.
+  * Traversing the topology that way resolves every UUID through the
+  * resource's map of entities. A TopologyIndex assigns each entity a dense
+  * integer slot and stores, per slot, the entity's type and the slots of
+  * its relations in contiguous (CSR-style) arrays. The relations named by
+  * each kind of arrangement are flattened into a second array addressed
+  * through a per-slot offset table. Traversals then follow integer slots
+  * through contiguous memory, and UUIDs are only consulted at the ends.
+  *
+  * The index is a cache. Each Entity counts modifications to its relations,
+  * arrangements and type (including any access through the non-const
+  * accessors that return references to them); rows whose entity has been
+  * modified since they were recorded are refreshed the next time they are
+  * traversed. Entities added to the resource are assigned slots when they
+  * are first encountered, and the resource reports entities it erases.
+  *
+  * Traversals run through a Walker handed to traverse(). Concurrent
+  * traversals share the index; one that encounters a stale row is rerun
+  * with exclusive access so that it may refresh rows as it goes.
+  */
+class SMTKCORE_EXPORT TopologyIndex
+{
+public:
+  using Slot = std::uint32_t;
+  using Entities = std::map<smtk::common::UUID, EntityPtr>;
+
+  static constexpr Slot invalidSlot = std::numeric_limits<Slot>::max();
+
+  class Walker;
+
+  /// Index the entities held by \a topology, which must outlive the index.
+  TopologyIndex(const Entities& topology);
+  TopologyIndex(const TopologyIndex&) = delete;
+  TopologyIndex& operator=(const TopologyIndex&) = delete;
+
+  /// Invoke \a traversal with a Walker over the index. The traversal may be
+  /// invoked a second time (with exclusive access to the index) if the first
+  /// attempt encountered rows that must be refreshed, so it should reset any
+  /// state it accumulates each time it is invoked.
+  void traverse(const std::function<void(Walker&)>& traversal) const;
+
+  /// Note that \a entity has been added to the resource (or has replaced the
+  /// entity previously held under its UUID).
+  void insert(const EntityPtr& entity);
+  /// Note that the entity with the given UUID has been removed from the resource.
+  void erase(const smtk::common::UUID& uid);
+  /// Discard the index; it is rebuilt when next traversed. This must be called
+  /// when the resource's map of entities is modified directly.
+  void invalidate();
+
+  /// Return the number of entities in the resource that have been assigned slots.
+  std::size_t size() const;
+
+private:
+  friend class Walker;
+
+  struct Row
+  {
+    // [begin, end) of the entity's relations in m_relations.
+    std::uint32_t m_relations[2] = { 0, 0 };
+    // Offsets into m_related of the relations named by each kind of
+    // arrangement; those of kind k are [m_related[k], m_related[k + 1]).
+    std::array<std::uint32_t, KINDS_OF_ARRANGEMENTS + 1> m_related{ {} };
+  };
+
+  // Methods below require the caller to hold the appropriate lock.
+  bool mustRebuild() const;
+  void rebuild();
+  Slot assign(const EntityPtr& entity);
+  void refresh(Slot slot);
+  bool isCurrent(Slot slot) const
+  {
+    return m_current[slot] && m_entities[slot] &&
+      m_versions[slot] == m_entities[slot]->topologyVersion();
+  }
+
+  const Entities& m_topology;
+  mutable smtk::resource::Lock m_lock;
+  // True if all slots must be discarded before the next traversal.
+  bool m_invalid{ true };
+  // True if some row may refer to an entity that has no slot (either because it
+  // has been erased or because it had not been added when the row was recorded).
+  bool m_unresolved{ false };
+
+  // Per-slot storage.
+  std::unordered_map<smtk::common::UUID, Slot> m_slots;
+  std::vector<smtk::common::UUID> m_ids;
+  std::vector<EntityPtr> m_entities;
+  std::vector<BitFlags> m_flags;
+  std::vector<int> m_dimensions;
+  std::vector<std::uint32_t> m_versions;
+  std::vector<char> m_current;
+  std::vector<Row> m_rows;
+  std::size_t m_live{ 0 };
+
+  // Relations (as slots) of every row, followed by the relations named by
+  // each row's arrangements.
+  std::vector<Slot> m_relations;
+  std::vector<Slot> m_related;
+  // The number of entries in the arrays above orphaned by refreshed rows.
+  std::size_t m_garbage{ 0 };
+};
+
+/**\brief Traverse the topology held by a TopologyIndex.
+  *
+  * Walkers are only valid within the function passed to TopologyIndex::traverse().
+  */
+class SMTKCORE_EXPORT TopologyIndex::Walker
+{
+public:
+  /// Return the slot of the entity with the given UUID (or invalidSlot).
+  Slot slot(const smtk::common::UUID& uid);
+  /// Return true if \a slot refers to an entity in the resource.
+  bool isValid(Slot slot) const
+  {
+    return slot != invalidSlot && m_index.m_entities[slot] != nullptr;
+  }
+  /// Return the UUID of the entity in \a slot.
+  const smtk::common::UUID& id(Slot slot) const { return m_index.m_ids[slot]; }
+  /// Return the type of the entity in \a slot.
+  BitFlags flags(Slot slot);
+  /// Return the dimension of the entity in \a slot (as Entity::dimension() does).
+  int dimension(Slot slot);
+
+  /// Invoke \a visitor on the slot of each of the entity's relations (in
+  /// order). Relations to entities not in the resource are skipped.
+  template<typename Visitor>
+  void visitRelations(Slot slot, Visitor visitor);
+  /// Invoke \a visitor on the slot of each entity named by the entity's
+  /// arrangements of \a kind, in the order EntityRefArrangementOps reports them.
+  /// Entities not in the resource are skipped.
+  template<typename Visitor>
+  void visitRelated(Slot slot, ArrangementKind kind, Visitor visitor);
+  /// Return the first entity named by the entity's arrangements of \a kind.
+  Slot firstRelated(Slot slot, ArrangementKind kind);
+
+  /// Insert the immediate bordants (as Resource::bordantEntities() defines
+  /// them) of the entity in \a slot into \a result.
+  void bordants(Slot slot, int ofDimension, std::vector<Slot>& result);
+  /// Insert the immediate boundaries (as Resource::boundaryEntities() defines
+  /// them) of the entity in \a slot into \a result.
+  void boundaries(Slot slot, int ofDimension, std::vector<Slot>& result);
+
+  /// Sort \a slots and remove duplicates.
+  static void unique(std::vector<Slot>& slots);
+  /// Insert the UUIDs of \a slots into \a uids.
+  void ids(const std::vector<Slot>& slots, smtk::common::UUIDs& uids) const;
+
+  /// Return true if the walk visited rows that must be refreshed. The
+  /// results of such a walk are incomplete and are discarded.
+  bool isStale() const { return m_stale; }
+
+private:
+  friend class TopologyIndex;
+
+  Walker(const TopologyIndex& index, bool exclusive)
+    : m_index(const_cast<TopologyIndex&>(index))
+    , m_exclusive(exclusive)
+  {
+  }
+
+  // Return true if the row for \a slot may be read, refreshing it if the walk
+  // has exclusive access and marking the walk stale otherwise.
+  bool prepare(Slot slot);
+  // Return the cell bounded by a shell (as ShellEntity::boundingCell() does).
+  Slot boundingCell(Slot shell);
+
+  TopologyIndex& m_index;
+  bool m_exclusive;
+  bool m_stale{ false };
+};
+
+template<typename Visitor>
+void TopologyIndex::Walker::visitRelations(Slot slot, Visitor visitor)
+{
+  if (!this->isValid(slot) || !this->prepare(slot))
+  {
+    return;
+  }
+  // Rows refreshed while visiting are appended to the arrays, so iterate by
+  // offset rather than by pointer.
+  const Row& row = m_index.m_rows[slot];
+  for (std::uint32_t ii = row.m_relations[0], end = row.m_relations[1]; ii < end; ++ii)
+  {
+    if (this->isValid(m_index.m_relations[ii]))
+    {
+      visitor(m_index.m_relations[ii]);
+    }
+  }
+}
+
+template<typename Visitor>
+void TopologyIndex::Walker::visitRelated(Slot slot, ArrangementKind kind, Visitor visitor)
+{
+  if (!this->isValid(slot) || kind >= KINDS_OF_ARRANGEMENTS || !this->prepare(slot))
+  {
+    return;
+  }
+  const Row& row = m_index.m_rows[slot];
+  for (std::uint32_t ii = row.m_related[kind], end = row.m_related[kind + 1]; ii < end; ++ii)
+  {
+    if (this->isValid(m_index.m_related[ii]))
+    {
+      visitor(m_index.m_related[ii]);
+    }
+  }
+}
+
+} // namespace model
+} // namespace smtk
+
+#endif // smtk_model_TopologyIndex_h
@@ -9,6 +9,7 @@
 //=========================================================================
 #include "smtk/model/json/jsonResource.h"
 
+#include "smtk/common/json/jsonStreaming.h"
 #include "smtk/common/json/jsonUUID.h"
 #include "smtk/model/json/jsonArrangement.h"
 #include "smtk/model/json/jsonTessellation.h"
@@ -25,6 +26,9 @@
 
 #include "nlohmann/json.hpp"
 
+#include <unordered_map>
+#include <utility>
+
 // Define how model collections are serialized.
 namespace smtk
 {
@@ -97,6 +101,170 @@ void to_json(json& j, const ResourcePtr& mresource)
   j["models"] = jmodels;
 }
 
+namespace
+{
+void transcribeProperties(const UUID& eid, const json& jEntity, ResourcePtr& mresource);
+
+// Create the entity \a eid described by \a jEntity (its flags, relations,
+// arrangements and legacy properties) and add it to \a mresource.
+void transcribeEntity(const UUID& eid, const json& jEntity, ResourcePtr& mresource)
+{
+  BitFlags bitflags;
+  try
+  {
+    bitflags = jEntity.at("e");
+  }
+  catch (std::exception&)
+  {
+    std::cerr << "Failed to add entityFlags to entity " << eid.toString() << std::endl;
+    return;
+  }
+  EntityPtr entity = Entity::create(eid, bitflags, mresource);
+  mresource->addEntity(entity);
+
+  try
+  {
+    UUIDArray uuidArray = jEntity.at("r");
+    entity->relations() = uuidArray;
+    mresource->topologyModified();
+  }
+  catch (std::exception&)
+  {
+  }
+
+  // Add arrangementInfo
+  try
+  {
+    const json& arrangementMap = jEntity.at("a");
+    entity->clearArrangements();
+    for (auto arrIter = arrangementMap.begin(); arrIter != arrangementMap.end(); arrIter++)
+    {
+      ArrangementKind kind = ArrangementKindFromAbbreviation(std::string(arrIter.key()));
+      Arrangements arrangements = arrIter.value();
+      for (const auto& arrangement : arrangements)
+      {
+        entity->arrange(kind, arrangement);
+      }
+    }
+  }
+  catch (std::exception&)
+  {
+  }
+  transcribeProperties(eid, jEntity, mresource);
+}
+
+// Transcribe the legacy (per-entity) properties of entity \a eid.
+void transcribeProperties(const UUID& eid, const json& jEntity, ResourcePtr& mresource)
+{
+  // For now from_json would just replace the ${Type}Properties for current entity
+  try
+  {
+    const json& stringDataJ = jEntity.at("s");
+    // Nlohmann json does not support complicated map conversion, we need
+    // to do it manually
+    for (auto sdIt = stringDataJ.begin(); sdIt != stringDataJ.end(); sdIt++)
+    {
+      auto& stringProperties =
+        mresource->properties()
+          .data()
+          .get<std::unordered_map<smtk::common::UUID, std::vector<std::string>>>();
+      stringProperties[sdIt.key()][eid] = sdIt.value().get<StringList>();
+    }
+  }
+  catch (std::exception&)
+  {
+  }
+  try
+  {
+    const json& floatDataJ = jEntity.at("f");
+    // Nlohmann json does not support complicated map conversion, we need
+    // to do it manually
+    for (auto sdIt = floatDataJ.begin(); sdIt != floatDataJ.end(); sdIt++)
+    {
+      auto& floatProperties =
+        mresource->properties()
+          .data()
+          .get<std::unordered_map<smtk::common::UUID, std::vector<double>>>();
+      floatProperties[sdIt.key()][eid] = sdIt.value().get<FloatList>();
+    }
+  }
+  catch (std::exception&)
+  {
+  }
+  try
+  {
+    const json& intDataJ = jEntity.at("i");
+    // Nlohmann json does not support complicated map conversion, we need
+    // to do it manually
+    for (auto sdIt = intDataJ.begin(); sdIt != intDataJ.end(); sdIt++)
+    {
+      auto& intProperties = mresource->properties()
+                              .data()
+                              .get<std::unordered_map<smtk::common::UUID, std::vector<long>>>();
+      intProperties[sdIt.key()][eid] = sdIt.value().get<IntegerList>();
+    }
+  }
+  catch (std::exception&)
+  {
+  }
+}
+
+// Relations and arrangements of entities read from a mapped document.
+class MappedTopology : public Entity::DeferredTopology
+{
+public:
+  MappedTopology(const std::shared_ptr<smtk::common::MappedJSON>& document)
+    : m_document(document)
+  {
+  }
+
+  void defer(
+    const UUID& eid,
+    const smtk::common::MappedJSON::Value& relations,
+    const smtk::common::MappedJSON::Value& arrangements)
+  {
+    m_records[eid] = std::make_pair(relations, arrangements);
+  }
+
+  void materialize(const Entity& entity, UUIDArray& relations, KindsToArrangements& arrangements)
+    const override
+  {
+    auto record = m_records.find(entity.id());
+    if (record == m_records.end())
+    {
+      return;
+    }
+    if (record->second.first.isValid())
+    {
+      relations = record->second.first.decode().get<UUIDArray>();
+    }
+    if (record->second.second.isValid())
+    {
+      json arrangementMap = record->second.second.decode();
+      arrangements.clear();
+      for (auto arrIter = arrangementMap.begin(); arrIter != arrangementMap.end(); arrIter++)
+      {
+        ArrangementKind kind = ArrangementKindFromAbbreviation(std::string(arrIter.key()));
+        Arrangements kindArrangements = arrIter.value();
+        if (!kindArrangements.empty())
+        {
+          Arrangements& existing = arrangements[kind];
+          existing.insert(existing.end(), kindArrangements.begin(), kindArrangements.end());
+        }
+      }
+    }
+  }
+
+private:
+  // The relations and arrangements of an entity.
+  using Record = std::pair<smtk::common::MappedJSON::Value, smtk::common::MappedJSON::Value>;
+
+  // Entities hold their records (and thus this document) until materialized.
+  std::shared_ptr<smtk::common::MappedJSON> m_document;
+  std::unordered_map<UUID, Record> m_records;
+};
+} // namespace
+
 void from_json(const json& j, ResourcePtr& mresource)
 {
   if (!mresource)
@@ -108,124 +276,152 @@ void from_json(const json& j, ResourcePtr& mresource)
   auto temp = std::static_pointer_cast<smtk::resource::Resource>(mresource);
   smtk::resource::from_json(j, temp);
 
-  json jmodels;
-  try
-  {
-    jmodels = j.at("models");
-  }
-  catch (std::exception /*e*/)
+  auto jmodels = j.find("models");
+  if (jmodels == j.end())
   {
     std::cerr << "Models does not exist in resource json object" << std::endl;
     return;
   }
-  for (json::const_iterator jmodelIt = jmodels.begin(); jmodelIt != jmodels.end(); ++jmodelIt)
+  for (json::const_iterator jmodelIt = jmodels->begin(); jmodelIt != jmodels->end(); ++jmodelIt)
   { // Models
     UUID mid = UUID(jmodelIt.key());
-    json jModel = jmodelIt.value();
+    const json& jModel = jmodelIt.value();
     auto jModelInfo = jModel.find(jmodelIt.key());
     BitFlags modelBitFlags = jModelInfo->at("e");
     EntityPtr currentModelPtr = Entity::create(mid, modelBitFlags, mresource);
     mresource->addEntity(currentModelPtr);
-    Model currentModel = currentModelPtr->referenceAs<Model>();
     for (auto jentIt = jModel.begin(); jentIt != jModel.end(); jentIt++)
     { // Entities in the currentModel
-      // Create and fill in the entity first
-      UUID eid = UUID(jentIt.key());
-      json jEntity = jentIt.value();
-      BitFlags bitflags;
-      try
-      {
-        bitflags = jEntity.at("e");
-      }
-      catch (std::exception&)
-      {
-        std::cerr << "Failed to add entityFlags to entity " << eid.toString() << std::endl;
-        continue;
-      }
-      EntityPtr entity = Entity::create(eid, bitflags, mresource);
-      mresource->addEntity(entity);
-      EntityRef entRef = EntityRef(mresource, eid);
+      transcribeEntity(UUID(jentIt.key()), jentIt.value(), mresource);
+    }
+  }
+}
 
-      try
-      {
-        UUIDArray uuidArray = jEntity.at("r");
-        entity->relations() = uuidArray;
-      }
-      catch (std::exception&)
-      {
-      }
+bool from_json(
+  std::istream& stream,
+  ResourcePtr& mresource,
+  const std::function<bool(const json&)>& accept)
+{
+  if (!mresource)
+  {
+    return false;
+  }
 
-      // Add arrangementInfo
-      try
-      {
-        json arrangementMap = jEntity.at("a");
-        entity->clearArrangements();
-        for (auto arrIter = arrangementMap.begin(); arrIter != arrangementMap.end(); arrIter++)
+  // Each entity record is transcribed as soon as it has been parsed. The
+  // resource's properties, which follow, are merged with the entities'
+  // legacy properties.
+  smtk::common::StreamingJSON streaming;
+  streaming.addHandler(
+    { "models", "*", "*" },
+    [&mresource](const smtk::common::StreamingJSON::Path& path, json& jEntity) {
+      transcribeEntity(UUID(path.back()), jEntity, mresource);
+    });
+  json j = streaming.parse(stream);
+
+  if (accept && !accept(j))
+  {
+    return false;
+  }
+  if (j.find("models") == j.end())
+  {
+    std::cerr << "Models does not exist in resource json object" << std::endl;
+  }
+
+  auto temp = std::static_pointer_cast<smtk::resource::Resource>(mresource);
+  smtk::resource::from_json(j, temp);
+  return true;
+}
+
+bool from_json(
+  const std::shared_ptr<smtk::common::MappedJSON>& document,
+  ResourcePtr& mresource,
+  const std::function<bool(const json&)>& accept)
+{
+  using smtk::common::MappedJSON;
+  using smtk::common::Visit;
+  if (!mresource || !document)
+  {
+    return false;
+  }
+
+  // Decode everything but the entity records.
+  json j = json::object();
+  MappedJSON::Value jmodels;
+  document->root().visit([&j, &jmodels](const std::string& key, const MappedJSON::Value& value) {
+    if (key == "models")
+    {
+      jmodels = value;
+    }
+    else
+    {
+      j[key] = value.decode();
+    }
+    return Visit::Continue;
+  });
+  if (accept && !accept(j))
+  {
+    return false;
+  }
+  if (!jmodels.isValid())
+  {
+    std::cerr << "Models does not exist in resource json object" << std::endl;
+  }
+
+  auto temp = std::static_pointer_cast<smtk::resource::Resource>(mresource);
+  smtk::resource::from_json(j, temp);
+
+  // Create each entity (and its legacy properties) now, but defer decoding
+  // its relations and arrangements until they are accessed.
+  auto topology = std::make_shared<MappedTopology>(document);
+  jmodels.visit([&](const std::string&, const MappedJSON::Value& jModel) {
+    return jModel.visit([&](const std::string& key, const MappedJSON::Value& jEntity) {
+      UUID eid(key);
+      json jFlags;
+      json jProperties = json::object();
+      MappedJSON::Value relations;
+      MappedJSON::Value arrangements;
+      jEntity.visit([&](const std::string& member, const MappedJSON::Value& value) {
+        if (member == "e")
         {
-          ArrangementKind kind = ArrangementKindFromAbbreviation(std::string(arrIter.key()));
-          Arrangements arrangements = arrIter.value();
-          for (const auto& arrangement : arrangements)
-          {
-            entity->arrange(kind, arrangement);
-          }
+          jFlags = value.decode();
         }
-      }
-      catch (std::exception&)
-      {
-      }
-      // For now from_json would just replace the ${Type}Properties for current entity
-      try
-      {
-        json stringDataJ = jEntity.at("s");
-        // Nlohmann json does not support complicated map conversion, we need
-        // to do it manually
-        for (auto sdIt = stringDataJ.begin(); sdIt != stringDataJ.end(); sdIt++)
+        else if (member == "r")
         {
-          auto& stringProperties =
-            mresource->properties()
-              .data()
-              .get<std::unordered_map<smtk::common::UUID, std::vector<std::string>>>();
-          stringProperties[sdIt.key()][eid] = sdIt.value().get<StringList>();
+          relations = value;
         }
-      }
-      catch (std::exception&)
-      {
-      }
-      try
-      {
-        json floatDataJ = jEntity.at("f");
-        // Nlohmann json does not support complicated map conversion, we need
-        // to do it manually
-        for (auto sdIt = floatDataJ.begin(); sdIt != floatDataJ.end(); sdIt++)
+        else if (member == "a")
         {
-          auto& floatProperties =
-            mresource->properties()
-              .data()
-              .get<std::unordered_map<smtk::common::UUID, std::vector<double>>>();
-          floatProperties[sdIt.key()][eid] = sdIt.value().get<FloatList>();
+          arrangements = value;
         }
-      }
-      catch (std::exception&)
-      {
-      }
-      try
-      {
-        json intDataJ = jEntity.at("i");
-        // Nlohmann json does not support complicated map conversion, we need
-        // to do it manually
-        for (auto sdIt = intDataJ.begin(); sdIt != intDataJ.end(); sdIt++)
+        else if (member == "s" || member == "f" || member == "i")
         {
-          auto& intProperties = mresource->properties()
-                                  .data()
-                                  .get<std::unordered_map<smtk::common::UUID, std::vector<long>>>();
-          intProperties[sdIt.key()][eid] = sdIt.value().get<IntegerList>();
+          jProperties[member] = value.decode();
         }
+        return Visit::Continue;
+      });
+
+      BitFlags bitflags;
+      try
+      {
+        bitflags = jFlags;
       }
       catch (std::exception&)
       {
+        std::cerr << "Failed to add entityFlags to entity " << eid.toString() << std::endl;
+        return Visit::Continue;
       }
-    }
-  }
+      EntityPtr entity = Entity::create(eid, bitflags, mresource);
+      mresource->addEntity(entity);
+      transcribeProperties(eid, jProperties, mresource);
+      if (relations.isValid() || arrangements.isValid())
+      {
+        topology->defer(eid, relations, arrangements);
+        entity->deferTopology(topology);
+      }
+      return Visit::Continue;
+    });
+  });
+  return true;
 }
 } // namespace model
 } // namespace smtk
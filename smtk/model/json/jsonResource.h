@@ -12,6 +12,7 @@
 
 #include "smtk/CoreExports.h"
 
+#include "smtk/common/json/jsonBinary.h"
 #include "smtk/common/json/jsonUUID.h"
 #include "smtk/model/json/jsonArrangement.h"
 #include "smtk/model/json/jsonTessellation.h"
@@ -20,6 +21,10 @@
 
 #include "nlohmann/json.hpp"
 
+#include <functional>
+#include <iosfwd>
+#include <memory>
+
 // Define how model collections are serialized.
 namespace smtk
 {
@@ -30,6 +35,30 @@ using json = nlohmann::json;
 SMTKCORE_EXPORT void to_json(json& j, const ResourcePtr& mresource);
 
 SMTKCORE_EXPORT void from_json(const json& j, ResourcePtr& mresource);
+
+/// Parse a model resource from \a stream (in either the text or binary
+/// encoding) into \a mresource without materializing the whole document:
+/// each entity record is transcribed as soon as it has been parsed. Once the
+/// document has been parsed, \a accept (if provided) is called with the rest
+/// of the document (i.e., everything but the entity records) so that callers
+/// may validate it or deserialize data of their own; if it returns false,
+/// the resource-level data is not transcribed and false is returned.
+/// Resource-level properties are merged with those of the entities.
+/// Exceptions thrown by the parser propagate to the caller.
+SMTKCORE_EXPORT bool from_json(
+  std::istream& stream,
+  ResourcePtr& mresource,
+  const std::function<bool(const json&)>& accept = nullptr);
+
+/// Read a model resource lazily from a mapped binary \a document into
+/// \a mresource. Every entity is created (with its legacy properties), but
+/// decoding each entity's relations and arrangements is deferred until they
+/// are first accessed; until then, entities hold a reference to \a document.
+/// \a accept is used as above, but is called before any entity is created.
+SMTKCORE_EXPORT bool from_json(
+  const std::shared_ptr<smtk::common::MappedJSON>& document,
+  ResourcePtr& mresource,
+  const std::function<bool(const json&)>& accept = nullptr);
 } // namespace model
 } // namespace smtk
 
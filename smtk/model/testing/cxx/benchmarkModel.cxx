@@ -7,6 +7,8 @@
 //  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
 //  PURPOSE.  See the above copyright notice for more information.
 //=========================================================================
+#include "smtk/model/EntityRef.h"
+#include "smtk/model/Face.h"
 #include "smtk/model/Resource.h"
 #include "smtk/model/json/jsonResource.h"
 #include "smtk/model/testing/cxx/helpers.h"
@@ -78,6 +80,71 @@ int main(int argc, char* argv[])
   std::cout << numHits << " missed lookups " << deltaT << " seconds " << (numHits / deltaT)
             << " good lookups/sec.\n";
 
+  // ### Benchmark entityref queries ###
+  // Entityrefs cache the entity record they resolve to, so repeated queries
+  // only look up the record again after entities have been erased.
+  EntityRefArray refs;
+  for (const auto& entry : sm->topology())
+  {
+    refs.emplace_back(sm, entry.first);
+  }
+  int numPasses = 10;
+  BitFlags allFlags = 0;
+  t.mark();
+  for (int pass = 0; pass < numPasses; ++pass)
+  {
+    for (const auto& entry : sm->topology())
+    {
+      EntityPtr ent = sm->findEntity(entry.first);
+      allFlags |= ent->entityFlags();
+    }
+  }
+  deltaT = t.elapsed();
+  double numQueries = static_cast<double>(numPasses) * refs.size();
+  std::cout << numQueries << " lookups by UUID " << deltaT << " seconds "
+            << (numQueries / deltaT) << " lookups/sec\n";
+
+  t.mark();
+  for (int pass = 0; pass < numPasses; ++pass)
+  {
+    for (const auto& ref : refs)
+    {
+      allFlags |= ref.entityFlags();
+    }
+  }
+  deltaT = t.elapsed();
+  std::cout << numQueries << " cached entityref queries " << deltaT << " seconds "
+            << (numQueries / deltaT) << " queries/sec\n";
+
+  // Erasing an entity forces every entityref to look up its record again.
+  t.mark();
+  for (int pass = 0; pass < numPasses; ++pass)
+  {
+    sm->erase(sm->addFace());
+    for (const auto& ref : refs)
+    {
+      allFlags |= ref.entityFlags();
+    }
+  }
+  deltaT = t.elapsed();
+  std::cout << numQueries << " revalidated entityref queries " << deltaT << " seconds "
+            << (numQueries / deltaT) << " queries/sec\n";
+
+  t.mark();
+  std::size_t nameLength = 0;
+  for (int pass = 0; pass < numPasses; ++pass)
+  {
+    for (const auto& ref : refs)
+    {
+      nameLength += ref.name().size();
+    }
+  }
+  deltaT = t.elapsed();
+  std::cout << numQueries << " entityref names " << deltaT << " seconds "
+            << (numQueries / deltaT) << " names/sec\n";
+  (void)allFlags;
+  (void)nameLength;
+
   // ### Benchmark JSON export ###
   t.mark();
   nlohmann::json json = sm;
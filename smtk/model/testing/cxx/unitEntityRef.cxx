@@ -390,6 +390,42 @@ void testResourceComponentConversion()
   std::cout << "testResourceComponentConversion... done\n\n";
 }
 
+void testRecordCache()
+{
+  std::cout << "testRecordCache\n";
+  ResourcePtr sm = Resource::create();
+  UUIDArray uids = createTet(sm);
+  Face face(sm, uids[16]);
+  EntityRef copy(face);
+  test(face.entityRecord() == sm->findEntity(uids[16]), "Face record mismatch.");
+  test(copy.entityRecord() == face.entityRecord(), "Copied entityref record mismatch.");
+  face.setName("tri");
+  test(face.name() == "tri" && copy.name() == "tri", "Cached record has wrong name.");
+
+  // Replacing the record must not leave entityrefs holding the old one.
+  std::uint64_t generation = sm->entityGeneration();
+  EntityPtr replacement = Entity::create(CELL_ENTITY, 2);
+  replacement->setId(uids[16]);
+  sm->insertEntity(replacement);
+  test(sm->entityGeneration() != generation, "Replacing a record should bump the generation.");
+  test(face.entityRecord() == replacement, "Entityref did not notice the replaced record.");
+  test(copy.entityRecord() == replacement, "Copied entityref did not notice the replaced record.");
+
+  // Erasing the record invalidates entityrefs.
+  sm->erase(uids[16]);
+  test(!face.isValid() && !face.entityRecord(), "Erased face should be invalid.");
+
+  // Entityrefs retargeted to other entities or resources drop their records.
+  EntityRef vert(sm, uids[0]);
+  test(vert.entityFlags() == (CELL_ENTITY | DIMENSION_0), "Vertex flags mismatch.");
+  vert.setEntity(uids[7]);
+  test(vert.entityFlags() == (CELL_ENTITY | DIMENSION_1), "Retargeted entityref not updated.");
+  ResourcePtr other = Resource::create();
+  vert.setResource(other);
+  test(!vert.isValid(), "Entityref to another resource should be invalid.");
+  std::cout << "testRecordCache... done\n\n";
+}
+
 int main(int argc, char* argv[])
 {
   (void)argc;
@@ -778,6 +814,7 @@ int main(int argc, char* argv[])
     testVolumeEntityRef();
     testModelMethods();
     testResourceComponentConversion();
+    testRecordCache();
   }
   catch (const std::string& msg)
   {
@@ -0,0 +1,109 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/model/Entity.h"
+#include "smtk/model/EntityTypeIndex.h"
+#include "smtk/model/Face.h"
+#include "smtk/model/Model.h"
+#include "smtk/model/Resource.h"
+#include "smtk/model/Volume.h"
+
+#include "smtk/common/UUID.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+#include "smtk/model/testing/cxx/helpers.h"
+
+using namespace smtk::model;
+using smtk::common::UUID;
+using smtk::common::UUIDs;
+
+namespace
+{
+// Return the entities matching a query by testing every entity in the resource.
+UUIDs bruteForce(const ResourcePtr& resource, BitFlags mask, bool exactMatch)
+{
+  UUIDs result;
+  for (const auto& entry : resource->topology())
+  {
+    if (EntityTypeIndex::matches(entry.second->entityFlags(), mask, exactMatch))
+    {
+      result.insert(entry.first);
+    }
+  }
+  return result;
+}
+
+void testQueries(const ResourcePtr& resource)
+{
+  for (BitFlags mask : { VERTEX, EDGE, FACE, VOLUME, CELL_ENTITY, USE_ENTITY, SHELL_ENTITY,
+                         MODEL_ENTITY, GROUP_ENTITY, ANY_ENTITY, DIMENSION_2 })
+  {
+    for (bool exactMatch : { true, false })
+    {
+      UUIDs expected = bruteForce(resource, mask, exactMatch);
+      smtkTest(
+        resource->entitiesMatchingFlags(mask, exactMatch) == expected,
+        "Query for " << Entity::flagSummary(mask) << " (exact " << exactMatch << ") mismatched.");
+      auto range = resource->entitiesMatchingFlagsRange(mask, exactMatch);
+      smtkTest(
+        range.size() == expected.size() && UUIDs(range.begin(), range.end()) == expected,
+        "Range for " << Entity::flagSummary(mask) << " (exact " << exactMatch
+                     << ") mismatched.");
+    }
+  }
+}
+} // namespace
+
+int unitEntityTypeIndex(int /*unused*/, char* /*unused*/[])
+{
+  // Vertices are uids[0-6], edges uids[7-15], faces uids[16-20], and the volume uids[21].
+  ResourcePtr resource = Resource::create();
+  smtk::common::UUIDArray uids = smtk::model::testing::createTet(resource);
+  Model model = resource->addModel(3, 3, "tet");
+  model.addCell(Volume(resource, uids[21]));
+  testQueries(resource);
+
+  smtkTest(resource->entitiesMatchingFlagsRange(FACE).size() == 5, "Expected 5 faces.");
+  smtkTest(resource->entitiesMatchingFlagsRange(INSTANCE_ENTITY).empty(), "Expected no instances.");
+  Faces faces = resource->entitiesMatchingFlagsAs<Faces>(FACE);
+  smtkTest(faces.size() == 5, "Expected 5 faces.");
+  for (std::size_t ii = 1; ii < faces.size(); ++ii)
+  {
+    smtkTest(faces[ii - 1].entity() < faces[ii].entity(), "Faces not sorted by UUID.");
+  }
+  smtkTest(resource->findEntitiesOfType(EDGE).size() == 9, "Expected 9 edges.");
+
+  // Changes to an entity's flags are reflected.
+  EntityPtr face = resource->findEntity(uids[16]);
+  face->setEntityFlags(face->entityFlags() | COVER);
+  smtkTest(
+    resource->entitiesMatchingFlags(FACE | COVER) == UUIDs({ uids[16] }),
+    "Modified flags not indexed.");
+  face->setEntityFlags(face->entityFlags() | DIMENSION_3);
+  smtkTest(
+    resource->entitiesMatchingFlagsRange(VOLUME).size() == 2, "Modified dimension not indexed.");
+  testQueries(resource);
+
+  // Entities erased from the resource are removed.
+  resource->erase(uids[17]);
+  resource->erase(uids[7]);
+  smtkTest(resource->entitiesMatchingFlagsRange(FACE).size() == 4, "Erased face indexed.");
+  smtkTest(resource->entitiesMatchingFlagsRange(EDGE).size() == 8, "Erased edge indexed.");
+  testQueries(resource);
+
+  // Entities added are indexed.
+  resource->addFace();
+  resource->insertEntity(Entity::create(CELL_ENTITY, 2));
+  smtkTest(resource->entitiesMatchingFlagsRange(FACE).size() == 6, "Added faces not indexed.");
+  testQueries(resource);
+
+  resource->clear();
+  smtkTest(resource->entitiesMatchingFlagsRange(ANY_ENTITY).empty(), "Cleared resource indexed.");
+  return 0;
+}
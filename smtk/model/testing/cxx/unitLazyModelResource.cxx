@@ -0,0 +1,108 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/model/Entity.h"
+#include "smtk/model/Face.h"
+#include "smtk/model/Model.h"
+#include "smtk/model/Resource.h"
+#include "smtk/model/Volume.h"
+#include "smtk/model/json/jsonResource.h"
+
+#include "smtk/common/UUID.h"
+#include "smtk/common/json/jsonBinary.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+#include "smtk/model/testing/cxx/helpers.h"
+
+#include <cstdio>
+#include <fstream>
+
+using namespace smtk::model;
+using smtk::common::BinaryJSON;
+using smtk::common::MappedJSON;
+using smtk::common::UUID;
+
+namespace
+{
+std::string writeRoot = SMTK_SCRATCH_DIR;
+
+std::size_t deferredEntities(const ResourcePtr& resource)
+{
+  std::size_t deferred = 0;
+  for (const auto& entry : resource->topology())
+  {
+    deferred += entry.second->isTopologyDeferred() ? 1 : 0;
+  }
+  return deferred;
+}
+} // namespace
+
+int unitLazyModelResource(int /*unused*/, char* /*unused*/[])
+{
+  ResourcePtr source = Resource::create();
+  smtk::common::UUIDArray uids = smtk::model::testing::createTet(source);
+  Model model = source->addModel(3, 3, "tet");
+  model.addCell(Volume(source, uids[21]));
+
+  json j;
+  smtk::model::to_json(j, source);
+  std::size_t serialized = 0;
+  for (const auto& jModel : j["models"])
+  {
+    serialized += jModel.size();
+  }
+
+  std::string filename = writeRoot + "/" + UUID::random().toString() + ".smtkb";
+  {
+    std::ofstream file(filename, std::ios::out | std::ios::binary);
+    BinaryJSON::write(j, file);
+  }
+
+  ResourcePtr lazy = Resource::create();
+  {
+    auto document = MappedJSON::open(filename);
+    smtkTest(!!document, "Could not map \"" << filename << "\".");
+    smtkTest(smtk::model::from_json(document, lazy), "Could not read lazily.");
+  }
+  // Entities keep the mapping alive, so the file may not be removed on all
+  // platforms until they have been materialized.
+
+  // Every entity exists, but (except for those touched while the resource was
+  // populated) their topology has not been decoded.
+  smtkTest(lazy->id() == source->id(), "Resource id not read.");
+  smtkTest(
+    lazy->topology().size() == serialized,
+    "Expected " << serialized << " entities, got " << lazy->topology().size() << ".");
+  std::size_t deferred = deferredEntities(lazy);
+  smtkTest(deferred > serialized / 2, "Only " << deferred << " entities deferred.");
+
+  // Entity types are available without materializing topology.
+  EntityPtr tet = lazy->findEntity(uids[21]);
+  smtkTest(tet && tet->isVolume(), "Volume not found.");
+  smtkTest(tet->isTopologyDeferred(), "Volume topology not deferred.");
+  smtkTest(
+    lazy->entitiesMatchingFlags(FACE, true).size() == 5, "Faces not found without topology.");
+  smtkTest(deferredEntities(lazy) == deferred, "Type queries materialized topology.");
+
+  // Topology is materialized on demand.
+  smtkTest(
+    Volume(lazy, uids[21]).lowerDimensionalBoundaries(2).size() == 5,
+    "The volume should have had 5 surface boundaries.");
+  smtkTest(!tet->isTopologyDeferred(), "Volume topology not materialized.");
+  smtkTest(deferredEntities(lazy) < deferred, "Traversal did not materialize topology.");
+
+  // Once all topology is materialized, the resource matches its source.
+  json jLazy;
+  smtk::model::to_json(jLazy, lazy);
+  smtkTest(deferredEntities(lazy) == 0, "Serialization did not materialize topology.");
+  smtkTest(jLazy["models"] == j["models"], "Lazily-read model differs from its source.");
+
+  std::remove(filename.c_str());
+  return 0;
+}
@@ -172,6 +172,20 @@ int main(int argc, char* argv[])
   test(sm->sessionOwningEntity(uids[0]) == sref.entity());
   test(sm->sessionOwningEntity(model.entity()) == sref.entity());
 
+  // Owners are memoized until the topology changes.
+  std::uint64_t generation = sm->topologyGeneration();
+  test(sm->modelOwningEntity(uids[16]) == model.entity());
+  test(sm->modelOwningEntity(uids[16]) == model.entity());
+  test(sm->topologyGeneration() == generation, "Owner queries should not modify topology.");
+  Model other(sm, uids[modelStart + 1]);
+  model.removeCell(CellEntity(sm, uids[16]));
+  other.addCell(CellEntity(sm, uids[16]));
+  test(sm->topologyGeneration() != generation, "Moving a cell should modify topology.");
+  test(sm->modelOwningEntity(uids[16]) == other.entity(), "Stale owner of moved cell.");
+  other.removeCell(CellEntity(sm, uids[16]));
+  model.addCell(CellEntity(sm, uids[16]));
+  test(sm->modelOwningEntity(uids[16]) == model.entity(), "Stale owner of restored cell.");
+
   sm->assignDefaultNames();
   // Verify we don't overwrite existing names
   test(sm->stringProperty(uids[21], "name")[0] == "Tetrahedron");
@@ -10,11 +10,88 @@
 //
 //=============================================================================
 #include "smtk/model/Tessellation.h"
+#include "smtk/model/TessellationBuffers.h"
 
 #include "smtk/common/testing/cxx/helpers.h"
 
 using namespace smtk::model;
 
+namespace
+{
+
+bool spanEquals(const TessellationBuffers::Span<const int>& span, const std::vector<int>& expected)
+{
+  return std::vector<int>(span.begin(), span.end()) == expected;
+}
+
+void testBuffers(Tessellation& tess)
+{
+  // Only the const accessors leave the buffers intact.
+  const Tessellation& constTess(tess);
+  std::shared_ptr<const TessellationBuffers> buffers = constTess.buffers();
+  test(!buffers->isSinglePrecision(), "Expected double-precision buffers by default.");
+  test(buffers->numberOfPoints() == 7, "Expected 7 points in buffers.");
+  test(
+    std::vector<double>(buffers->coords().begin(), buffers->coords().end()) == constTess.coords(),
+    "Expected buffer coordinates to match.");
+  test(buffers->floatCoords().empty(), "Expected no single-precision coordinates.");
+
+  // Cells appear in each buffer in the order they appear in the tessellation.
+  test(buffers->numberOfCells(TessellationBuffers::VERTICES) == 2, "Expected 2 vertex cells.");
+  test(
+    spanEquals(buffers->connectivity(TessellationBuffers::VERTICES), { 0, 1, 2, 0 }),
+    "Bad vertex connectivity.");
+  test(
+    spanEquals(buffers->offsets(TessellationBuffers::VERTICES), { 0, 3, 4 }),
+    "Bad vertex offsets.");
+  test(
+    spanEquals(buffers->connectivity(TessellationBuffers::LINES), { 0, 1, 2, 4, 3 }),
+    "Bad line connectivity.");
+  test(spanEquals(buffers->offsets(TessellationBuffers::LINES), { 0, 5 }), "Bad line offsets.");
+  test(
+    spanEquals(
+      buffers->connectivity(TessellationBuffers::POLYGONS),
+      { 0, 1, 2, 4, 5, 3, 0, 1, 2, 3, 2, 4, 3 }),
+    "Bad polygon connectivity.");
+  test(
+    spanEquals(buffers->offsets(TessellationBuffers::POLYGONS), { 0, 6, 10, 13 }),
+    "Bad polygon offsets.");
+  test(
+    spanEquals(buffers->connectivity(TessellationBuffers::STRIPS), { 0, 1, 3, 2, 4 }),
+    "Bad strip connectivity.");
+  test(spanEquals(buffers->offsets(TessellationBuffers::STRIPS), { 0, 5 }), "Bad strip offsets.");
+
+  // Polygons are fanned and strips alternate orientation.
+  test(buffers->triangles().size() == 30, "Expected 10 triangles.");
+  std::vector<int> strip(buffers->triangles().end() - 9, buffers->triangles().end());
+  test(strip == std::vector<int>({ 0, 1, 3, 3, 1, 2, 3, 2, 4 }), "Bad strip triangles.");
+
+  std::shared_ptr<const TessellationBuffers> floatBuffers = constTess.buffers(true);
+  test(floatBuffers->isSinglePrecision(), "Expected single-precision buffers.");
+  test(floatBuffers->coords().empty(), "Expected no double-precision coordinates.");
+  test(
+    floatBuffers->floatCoords().size() == constTess.coords().size(),
+    "Bad float coordinate count.");
+  for (std::size_t ii = 0; ii < constTess.coords().size(); ++ii)
+  {
+    test(
+      floatBuffers->floatCoords()[ii] == static_cast<float>(constTess.coords()[ii]),
+      "Bad float coordinate.");
+  }
+
+  // Buffers are shared until the tessellation is modified.
+  test(constTess.buffers() == buffers, "Expected buffers to be shared.");
+  test(constTess.buffers(true) == floatBuffers, "Expected float buffers to be shared.");
+  tess.addPoint(6);
+  test(constTess.buffers() != buffers, "Expected buffers to be rebuilt.");
+  test(
+    spanEquals(constTess.buffers()->offsets(TessellationBuffers::VERTICES), { 0, 3, 4, 5 }),
+    "Expected added vertex in rebuilt buffers.");
+  test(buffers->numberOfCells(TessellationBuffers::VERTICES) == 2, "Expected buffers unchanged.");
+}
+
+} // namespace
+
 int main()
 {
   Tessellation tess;
@@ -173,5 +250,7 @@ int main()
     conn.clear();
   }
 
+  testBuffers(tess);
+
   return 0;
 }
@@ -0,0 +1,182 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/model/CellEntity.h"
+#include "smtk/model/Entity.h"
+#include "smtk/model/EntityRef.h"
+#include "smtk/model/Model.h"
+#include "smtk/model/Resource.h"
+#include "smtk/model/TopologyIndex.h"
+#include "smtk/model/UseEntity.h"
+
+#include "smtk/common/Executor.h"
+#include "smtk/common/UUID.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+#include "smtk/model/testing/cxx/helpers.h"
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+
+using namespace smtk::model;
+using smtk::common::UUID;
+using smtk::common::UUIDs;
+
+namespace
+{
+UUIDs idsOf(const smtk::common::UUIDArray& uids, std::initializer_list<int> indices)
+{
+  UUIDs result;
+  for (int index : indices)
+  {
+    result.insert(uids[index]);
+  }
+  return result;
+}
+} // namespace
+
+int unitTopologyIndex(int /*unused*/, char* /*unused*/[])
+{
+  // Vertices are uids[0-6], edges uids[7-15], faces uids[16-20], and the volume uids[21].
+  ResourcePtr resource = Resource::create();
+  smtk::common::UUIDArray uids = smtk::model::testing::createTet(resource);
+
+  smtkTest(
+    resource->bordantEntities(uids[7], 2) == idsOf(uids, { 16, 18 }),
+    "Edge should bound 2 faces.");
+  smtkTest(
+    resource->bordantEntities(UUIDs{ uids[7], uids[8] }, 2) == idsOf(uids, { 16, 18, 19 }),
+    "Edges should bound 3 faces.");
+  smtkTest(
+    resource->boundaryEntities(uids[21], 2) == idsOf(uids, { 16, 17, 18, 19, 20 }),
+    "Volume should be bounded by 5 faces.");
+  smtkTest(
+    resource->boundaryEntities(uids[18], 1) == idsOf(uids, { 7, 13, 14 }),
+    "Face should be bounded by 3 edges.");
+  smtkTest(
+    resource->lowerDimensionalBoundaries(uids[21], 0) == idsOf(uids, { 0, 1, 2, 3, 4, 5, 6 }),
+    "Volume should have 7 corners.");
+  smtkTest(
+    resource->lowerDimensionalBoundaries(uids[21], -1).size() == 21,
+    "Volume should have 21 boundaries of any dimension.");
+  smtkTest(
+    resource->higherDimensionalBordants(uids[6], 3) == idsOf(uids, { 21 }),
+    "Vertex should bound the volume.");
+  smtkTest(
+    resource->higherDimensionalBordants(uids[6], 2) == idsOf(uids, { 18, 19, 20 }),
+    "Vertex should bound 3 faces.");
+  smtkTest(resource->bordantEntities(UUID::random()).empty(), "Unknown entity has bordants.");
+
+  // Concurrent traversals share the index.
+  {
+    std::atomic<int> mismatches(0);
+    smtk::common::Executor executor(4);
+    executor.parallelFor(0, 64, 1, [&](std::size_t first, std::size_t last) {
+      for (std::size_t ii = first; ii < last; ++ii)
+      {
+        const auto& uid = uids[ii % 7];
+        if (resource->higherDimensionalBordants(uid, 3) != idsOf(uids, { 21 }))
+        {
+          ++mismatches;
+        }
+      }
+    });
+    smtkTest(mismatches == 0, "Concurrent traversals disagree.");
+  }
+
+  // Reads such as those made by descriptive phrases do not count as
+  // modifications, so they leave the index's rows current.
+  {
+    ResourcePtr phrased = Resource::create();
+    smtk::common::UUIDArray tet = smtk::model::testing::createTet(phrased);
+    Model model = phrased->addModel(3, 3, "tet");
+    model.addCell(CellEntity(phrased, tet[21]));
+    UUID use = phrased->findCreateOrReplaceCellUseOfSenseAndOrientation(tet[7], 0, POSITIVE);
+    smtkTest(
+      phrased->higherDimensionalBordants(tet[0], 2) == idsOf(tet, { 16, 18, 20 }),
+      "Vertex should bound 3 faces.");
+
+    std::map<UUID, std::uint32_t> versions;
+    for (const auto& entry : phrased->topology())
+    {
+      versions[entry.first] = entry.second->topologyVersion();
+    }
+    for (const auto& entry : phrased->topology())
+    {
+      const EntityRef ref(phrased, entry.first);
+      ref.owningModel();
+      ref.relations();
+      ref.embeddedEntities<EntityRefs>();
+      ref.containingGroups();
+      ref.numberOfArrangementsOfKind(HAS_USE);
+      ref.findArrangement(INCLUDES, 0);
+      ref.relationFromArrangement(HAS_USE, 0, 0);
+      ref.bordantEntities();
+      ref.boundaryEntities();
+      if (ref.isCellEntity())
+      {
+        CellEntity cell(ref);
+        cell.boundingCells();
+        cell.inclusions<EntityRefs>();
+        cell.uses<UseEntities>();
+      }
+      else if (ref.isUseEntity())
+      {
+        UseEntity(ref).cell();
+        UseEntity(ref).boundingShellEntity();
+      }
+    }
+    phrased->findCellHasUseWithSense(tet[7], use, 0);
+    phrased->useOrShellIncludesShells(use);
+    phrased->sessionOwningEntity(tet[21]);
+
+    bool current = true;
+    for (const auto& entry : phrased->topology())
+    {
+      current &= versions[entry.first] == entry.second->topologyVersion();
+    }
+    smtkTest(current, "Reading entities marked their topology modified.");
+    smtkTest(
+      CellEntity(phrased, tet[7]).uses<UseEntities>().size() == 1, "Edge should have 1 use.");
+    smtkTest(model.cells().size() == 1, "Model should include the volume.");
+  }
+
+  // Modifications made through an entity's accessors are noticed.
+  EntityPtr edge = resource->findEntity(uids[7]);
+  edge->relations().push_back(uids[17]);
+  smtkTest(
+    resource->bordantEntities(uids[7], 2) == idsOf(uids, { 16, 17, 18 }),
+    "Modified relations not noticed.");
+  edge->relations().pop_back();
+  smtkTest(
+    resource->bordantEntities(uids[7], 2) == idsOf(uids, { 16, 18 }),
+    "Restored relations not noticed.");
+
+  // Erased entities are not reported.
+  resource->erase(uids[18]);
+  smtkTest(
+    resource->bordantEntities(uids[7], 2) == idsOf(uids, { 16 }), "Erased face still reported.");
+  smtkTest(
+    resource->lowerDimensionalBoundaries(uids[21], 0) == idsOf(uids, { 0, 1, 2, 3, 4, 5, 6 }),
+    "Volume corners changed by erasing a face.");
+
+  // Inserted entities are.
+  UUID face = resource->insertEntity(Entity::create(CELL_ENTITY, 2)->pushRelation(uids[7]))->first;
+  smtkTest(
+    resource->bordantEntities(uids[7], 2) == UUIDs({ uids[16], face }),
+    "Inserted face not reported.");
+  smtkTest(
+    resource->lowerDimensionalBoundaries(face, 0) == idsOf(uids, { 0, 1 }),
+    "Inserted face should have 2 corners.");
+
+  resource->clear();
+  smtkTest(resource->bordantEntities(uids[7]).empty(), "Cleared resource has bordants.");
+  return 0;
+}
@@ -60,6 +60,7 @@ std::vector<Weights> computeWeights(
   }
 
   smtk::geometry::DistanceTo* distanceTo = nullptr;
+  std::vector<double> distances(samplePoints.size() / 3);
 
   for (const auto& attribute : attributes)
   {
@@ -88,14 +89,10 @@ std::vector<Weights> computeWeights(
         distanceTo = &(entity->resource()->queries().get<smtk::geometry::DistanceTo>());
       }
 
-      std::size_t counter = 0;
-      for (std::size_t j = 0; j < samplePoints.size(); j += 3)
+      distanceTo->distances(entity, samplePoints.data(), distances.size(), distances.data());
+      for (std::size_t j = 0; j < distances.size(); ++j)
       {
-        std::array<double, 3> input{
-          { samplePoints[j], samplePoints[j + 1], samplePoints[j + 2] }
-        };
-        double distance = (*distanceTo)(entity, input).first;
-        pointProfiles[counter++].push_back(std::make_pair(distance, attribute.get()));
+        pointProfiles[j].push_back(std::make_pair(distances[j], attribute.get()));
       }
     }
   }
@@ -0,0 +1,154 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/operation/AttributePool.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/Item.h"
+#include "smtk/attribute/ReferenceItem.h"
+
+namespace
+{
+// Return an attribute to the state it was in when it was created. Reference
+// items (including associations) drop their links to other resources, so a
+// pooled attribute does not keep those resources alive. (Its name and
+// properties are held by the specification and are renewed when the
+// attribute is taken from the pool.)
+void resetAttribute(const smtk::attribute::AttributePtr& attribute)
+{
+  if (auto associations = attribute->associations())
+  {
+    associations->reset();
+  }
+  for (std::size_t i = 0; i < attribute->numberOfItems(); ++i)
+  {
+    attribute->item(static_cast<int>(i))->reset();
+  }
+  attribute->unsetColor();
+  attribute->unsetLocalAdvanceLevel(0);
+  attribute->unsetLocalAdvanceLevel(1);
+  attribute->setAppliesToBoundaryNodes(false);
+  attribute->setAppliesToInteriorNodes(false);
+  attribute->setIncludeIndex(0);
+  attribute->clearAllUserData();
+}
+} // namespace
+
+namespace smtk
+{
+namespace operation
+{
+
+AttributePool::AttributePool(std::size_t capacity)
+  : m_capacity(capacity)
+{
+}
+
+smtk::attribute::AttributePtr AttributePool::acquireParameters()
+{
+  return this->acquire(m_parameters);
+}
+
+smtk::attribute::AttributePtr AttributePool::acquireResult()
+{
+  return this->acquire(m_results);
+}
+
+bool AttributePool::releaseParameters(const smtk::attribute::AttributePtr& parameters)
+{
+  return this->release(m_parameters, parameters);
+}
+
+bool AttributePool::releaseResult(const smtk::attribute::AttributePtr& result)
+{
+  return this->release(m_results, result);
+}
+
+void AttributePool::setCapacity(std::size_t capacity)
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  m_capacity = capacity;
+  // Attributes beyond the new capacity are simply dropped; they are released
+  // along with the specification that holds them.
+  if (m_parameters.size() > m_capacity)
+  {
+    m_parameters.resize(m_capacity);
+  }
+  if (m_results.size() > m_capacity)
+  {
+    m_results.resize(m_capacity);
+  }
+}
+
+std::size_t AttributePool::capacity() const
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return m_capacity;
+}
+
+std::size_t AttributePool::numberOfParameters() const
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return m_parameters.size();
+}
+
+std::size_t AttributePool::numberOfResults() const
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return m_results.size();
+}
+
+smtk::attribute::AttributePtr AttributePool::acquire(
+  std::vector<smtk::attribute::AttributePtr>& pool)
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  if (pool.empty())
+  {
+    return smtk::attribute::AttributePtr();
+  }
+  smtk::attribute::AttributePtr attribute = std::move(pool.back());
+  pool.pop_back();
+  return attribute;
+}
+
+bool AttributePool::release(
+  std::vector<smtk::attribute::AttributePtr>& pool,
+  const smtk::attribute::AttributePtr& attribute)
+{
+  if (!attribute)
+  {
+    return false;
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (pool.size() >= m_capacity)
+    {
+      return false;
+    }
+  }
+
+  // The attribute is reset outside of the pool's lock since doing so may
+  // acquire the specification's link mutex. The capacity check is repeated
+  // once it is reset; if another thread filled the pool meanwhile, the reset
+  // attribute is simply handed back to the caller for removal.
+  resetAttribute(attribute);
+
+  std::lock_guard<std::mutex> guard(m_mutex);
+  if (pool.size() >= m_capacity)
+  {
+    return false;
+  }
+  pool.push_back(attribute);
+  return true;
+}
+
+} // namespace operation
+} // namespace smtk
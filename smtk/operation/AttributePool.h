@@ -0,0 +1,80 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_operation_AttributePool_h
+#define smtk_operation_AttributePool_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+
+#include <mutex>
+#include <vector>
+
+namespace smtk
+{
+namespace operation
+{
+/// A pool of parameter and result attributes available for reuse by
+/// operations of a single type.
+///
+/// Creating an operation's parameters or result inserts a new attribute into
+/// the operation type's shared specification (and destroying the operation
+/// removes it again), both of which require a write lock on the
+/// specification. Managed operations instead return attributes that nobody
+/// else references to their type's pool when they are destroyed, and later
+/// instances of the operation take attributes from the pool before creating
+/// new ones. Pooled attributes remain in the specification; they are reset to
+/// their default values and hold no references to other resources. Operations
+/// give the attributes they take from the pool a new unique name.
+class SMTKCORE_EXPORT AttributePool
+{
+public:
+  AttributePool(std::size_t capacity = 16);
+  AttributePool(const AttributePool&) = delete;
+  AttributePool& operator=(const AttributePool&) = delete;
+
+  /// Take a pooled parameters attribute, or return nullptr if there are none.
+  smtk::attribute::AttributePtr acquireParameters();
+
+  /// Take a pooled result attribute, or return nullptr if there are none.
+  smtk::attribute::AttributePtr acquireResult();
+
+  /// Reset \a parameters and add it to the pool. Returns false if the pool is
+  /// full; the caller is then responsible for removing the attribute from its
+  /// specification.
+  bool releaseParameters(const smtk::attribute::AttributePtr& parameters);
+
+  /// Reset \a result and add it to the pool. Returns false if the pool is
+  /// full.
+  bool releaseResult(const smtk::attribute::AttributePtr& result);
+
+  /// Set/get the maximum number of attributes of each kind held by the pool.
+  void setCapacity(std::size_t capacity);
+  std::size_t capacity() const;
+
+  /// Return the number of pooled parameters and result attributes.
+  std::size_t numberOfParameters() const;
+  std::size_t numberOfResults() const;
+
+private:
+  smtk::attribute::AttributePtr acquire(std::vector<smtk::attribute::AttributePtr>& pool);
+  bool release(
+    std::vector<smtk::attribute::AttributePtr>& pool,
+    const smtk::attribute::AttributePtr& attribute);
+
+  mutable std::mutex m_mutex;
+  std::size_t m_capacity;
+  std::vector<smtk::attribute::AttributePtr> m_parameters;
+  std::vector<smtk::attribute::AttributePtr> m_results;
+};
+} // namespace operation
+} // namespace smtk
+
+#endif // smtk_operation_AttributePool_h
@@ -0,0 +1,606 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/operation/GraphLauncher.h"
+
+#include "smtk/operation/SpecificationOps.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/ReferenceItem.h"
+
+#include "smtk/io/Logger.h"
+
+#include "smtk/resource/Resource.h"
+
+#include <deque>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace
+{
+// Copy the values of a result item into a parameter item. The destination is
+// only enabled once its values have been transferred; otherwise its enabled
+// state is left as it was.
+bool transferItem(
+  const smtk::operation::Operation::Result& result,
+  const smtk::operation::Operation::Parameters& parameters,
+  const std::string& resultItemPath,
+  const std::string& parameterItemPath)
+{
+  smtk::attribute::ConstItemPtr source = result->itemAtPath(resultItemPath);
+  smtk::attribute::ItemPtr destination = parameterItemPath == "associations"
+    ? parameters->associations()
+    : parameters->itemAtPath(parameterItemPath);
+  if (!source || !destination)
+  {
+    smtkErrorMacro(
+      smtk::io::Logger::instance(),
+      "Cannot find " << (source ? "parameter" : "result") << " item \""
+                     << (source ? parameterItemPath : resultItemPath) << "\".");
+    return false;
+  }
+
+  // Result and parameter reference items rarely share a definition, so their
+  // values are appended one at a time (and validated against the
+  // destination's definition) rather than assigned wholesale.
+  bool enabled = destination->localEnabledState();
+  bool transferred = true;
+  auto sourceReferences = std::dynamic_pointer_cast<const smtk::attribute::ReferenceItem>(source);
+  auto destinationReferences =
+    std::dynamic_pointer_cast<smtk::attribute::ReferenceItem>(destination);
+  if (sourceReferences && destinationReferences)
+  {
+    for (std::size_t i = 0; transferred && i < sourceReferences->numberOfValues(); ++i)
+    {
+      transferred = !sourceReferences->isSet(i) ||
+        destinationReferences->appendValue(sourceReferences->value(i));
+    }
+  }
+  else
+  {
+    transferred = destination->assign(source);
+  }
+
+  if (!transferred)
+  {
+    destination->setIsEnabled(enabled);
+    smtkErrorMacro(
+      smtk::io::Logger::instance(),
+      "Cannot transfer result item \"" << resultItemPath << "\" into parameter item \""
+                                        << parameterItemPath << "\".");
+    return false;
+  }
+  destination->setIsEnabled(true);
+  return true;
+}
+} // namespace
+
+namespace smtk
+{
+namespace operation
+{
+
+struct GraphLauncher::Internal : public std::enable_shared_from_this<GraphLauncher::Internal>
+{
+  struct Input
+  {
+    Node m_upstream;
+    Transfer m_transfer;
+  };
+
+  struct NodeData
+  {
+    Operation::Ptr m_operation;
+    std::vector<Input> m_inputs;
+    std::vector<Node> m_downstream;
+
+    // Per-run state.
+    State m_state{ State::Pending };
+    std::size_t m_waiting{ 0 };
+    bool m_upstreamFailed{ false };
+    smtk::common::CancellationToken m_token;
+    std::promise<Operation::Result> m_promise;
+    std::shared_future<Operation::Result> m_result;
+    std::vector<std::pair<smtk::resource::ResourcePtr, smtk::resource::LockType>> m_locks;
+  };
+
+  typedef std::vector<std::pair<Node, State>> Events;
+
+  Internal(smtk::common::Executor* executor)
+    : m_executor(executor)
+  {
+  }
+
+  bool valid(Node node) const { return node < m_nodes.size(); }
+
+  // Return true if \a target can be reached from \a source.
+  bool reachable(Node source, Node target) const
+  {
+    std::vector<bool> visited(m_nodes.size(), false);
+    std::vector<Node> stack{ source };
+    while (!stack.empty())
+    {
+      Node node = stack.back();
+      stack.pop_back();
+      if (node == target)
+      {
+        return true;
+      }
+      if (!visited[node])
+      {
+        visited[node] = true;
+        const auto& downstream = m_nodes[node].m_downstream;
+        stack.insert(stack.end(), downstream.begin(), downstream.end());
+      }
+    }
+    return false;
+  }
+
+  bool connect(Node upstream, Node downstream, const Transfer& transfer)
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (
+      m_running || !this->valid(upstream) || !this->valid(downstream) ||
+      this->reachable(downstream, upstream))
+    {
+      return false;
+    }
+    m_nodes[upstream].m_downstream.push_back(downstream);
+    m_nodes[downstream].m_inputs.push_back(Input{ upstream, transfer });
+    return true;
+  }
+
+  // The methods below must be called with m_mutex held.
+
+  void cancel(NodeData& data)
+  {
+    data.m_token.cancel();
+    // Running operations stop cooperatively the next time they report
+    // progress.
+    if (data.m_state == State::Running)
+    {
+      data.m_operation->cancel();
+    }
+  }
+
+  // Return true if the locks requested by \a data are compatible with the
+  // locks held by running nodes.
+  bool available(const NodeData& data) const
+  {
+    for (const auto& lock : data.m_locks)
+    {
+      auto it = m_held.find(lock.first.get());
+      if (
+        it != m_held.end() &&
+        (it->second < 0 || lock.second == smtk::resource::LockType::Write))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void acquire(const NodeData& data)
+  {
+    for (const auto& lock : data.m_locks)
+    {
+      m_held[lock.first.get()] += (lock.second == smtk::resource::LockType::Write ? -1 : 1);
+    }
+  }
+
+  void release(const NodeData& data)
+  {
+    for (const auto& lock : data.m_locks)
+    {
+      auto it = m_held.find(lock.first.get());
+      it->second -= (lock.second == smtk::resource::LockType::Write ? -1 : 1);
+      if (it->second == 0)
+      {
+        m_held.erase(it);
+      }
+    }
+  }
+
+  // Record the outcome of \a node and make ready any downstream nodes whose
+  // upstream nodes have all finished. Downstream nodes that cannot run are
+  // finished immediately.
+  void complete(Node node, const Operation::Result& result, Events& events)
+  {
+    std::vector<std::pair<Node, Operation::Result>> finished{ { node, result } };
+    while (!finished.empty())
+    {
+      Node current = finished.back().first;
+      Operation::Result currentResult = finished.back().second;
+      finished.pop_back();
+
+      NodeData& data = m_nodes[current];
+      if (data.m_state == State::Running)
+      {
+        this->release(data);
+        auto outcome = currentResult
+          ? static_cast<Operation::Outcome>(currentResult->findInt("outcome")->value())
+          : Operation::Outcome::UNKNOWN;
+        if (outcome == Operation::Outcome::SUCCEEDED)
+        {
+          data.m_state = State::Succeeded;
+        }
+        else if (outcome == Operation::Outcome::CANCELED && data.m_token.isCanceled())
+        {
+          data.m_state = State::Canceled;
+        }
+        else
+        {
+          data.m_state = State::Failed;
+        }
+      }
+      data.m_locks.clear();
+      data.m_promise.set_value(currentResult);
+      events.emplace_back(current, data.m_state);
+      if (data.m_state != State::Succeeded)
+      {
+        m_succeeded = false;
+      }
+      --m_remaining;
+
+      for (Node downstream : data.m_downstream)
+      {
+        NodeData& next = m_nodes[downstream];
+        next.m_upstreamFailed |= data.m_state != State::Succeeded;
+        if (--next.m_waiting != 0)
+        {
+          continue;
+        }
+
+        if (next.m_upstreamFailed)
+        {
+          next.m_state = State::Skipped;
+          finished.emplace_back(
+            downstream, next.m_operation->createResult(Operation::Outcome::CANCELED));
+        }
+        else if (!this->prepare(downstream))
+        {
+          next.m_state = State::Failed;
+          finished.emplace_back(
+            downstream, next.m_operation->createResult(Operation::Outcome::UNABLE_TO_OPERATE));
+        }
+      }
+    }
+  }
+
+  // Transfer upstream results into a node whose upstream nodes have succeeded,
+  // determine its locks and queue it for execution.
+  bool prepare(Node node)
+  {
+    NodeData& data = m_nodes[node];
+    auto parameters = data.m_operation->parameters();
+    for (const auto& input : data.m_inputs)
+    {
+      const NodeData& upstream = m_nodes[input.m_upstream];
+      if (input.m_transfer && !input.m_transfer(upstream.m_result.get(), parameters))
+      {
+        smtkErrorMacro(
+          data.m_operation->log(),
+          "Could not transfer the result of \""
+            << upstream.m_operation->typeName() << "\" into the parameters of \""
+            << data.m_operation->typeName() << "\".");
+        return false;
+      }
+    }
+
+    for (const auto& resourceAndLockType : extractResourcesAndLockTypes(parameters))
+    {
+      auto resource = resourceAndLockType.first.lock();
+      if (resource && resourceAndLockType.second != smtk::resource::LockType::DoNotLock)
+      {
+        data.m_locks.emplace_back(resource, resourceAndLockType.second);
+      }
+    }
+    m_ready.push_back(node);
+    return true;
+  }
+
+  // Submit every ready node whose locks are available.
+  void schedule(Events& events)
+  {
+    for (auto it = m_ready.begin(); it != m_ready.end();)
+    {
+      NodeData& data = m_nodes[*it];
+      if (!this->available(data))
+      {
+        ++it;
+        continue;
+      }
+
+      this->acquire(data);
+      data.m_state = State::Running;
+      events.emplace_back(*it, State::Running);
+
+      Node node = *it;
+      std::shared_ptr<Internal> self = this->shared_from_this();
+      m_executor->submit(
+        [self, node]() {
+          // The node vector is not modified while the graph runs.
+          NodeData& data = self->m_nodes[node];
+          Operation::Result result;
+          if (data.m_token.isCanceled())
+          {
+            result = data.m_operation->createResult(Operation::Outcome::CANCELED);
+          }
+          else
+          {
+            try
+            {
+              result = data.m_operation->operate();
+            }
+            catch (std::exception& e)
+            {
+              smtkErrorMacro(
+                data.m_operation->log(),
+                "Operation \"" << data.m_operation->typeName() << "\" threw: " << e.what());
+              result = data.m_operation->createResult(Operation::Outcome::FAILED);
+            }
+          }
+          self->finish(node, result);
+        },
+        m_priority);
+
+      it = m_ready.erase(it);
+    }
+  }
+
+  // Called from worker threads once a node's operation has returned.
+  void finish(Node node, const Operation::Result& result)
+  {
+    Events events;
+    Observer observer;
+    bool done;
+    bool succeeded;
+    std::promise<bool> promise;
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      this->complete(node, result, events);
+      this->schedule(events);
+      observer = m_observer;
+      done = m_remaining == 0;
+      succeeded = m_succeeded;
+      if (done)
+      {
+        m_running = false;
+        std::swap(promise, m_done);
+      }
+    }
+    this->notify(observer, events);
+    if (done)
+    {
+      promise.set_value(succeeded);
+    }
+  }
+
+  static void notify(const Observer& observer, const Events& events)
+  {
+    if (observer)
+    {
+      for (const auto& event : events)
+      {
+        observer(event.first, event.second);
+      }
+    }
+  }
+
+  // The executor is owned by the graph launcher, which outlives any run, so
+  // tasks (which hold the internal state) never release the executor.
+  smtk::common::Executor* m_executor;
+  smtk::common::Executor::Priority m_priority{ smtk::common::Executor::Priority::Batch };
+  mutable std::mutex m_mutex;
+  std::vector<NodeData> m_nodes;
+  std::deque<Node> m_ready;
+  // The number of running readers of each resource, or -1 for a writer.
+  std::map<const smtk::resource::Resource*, int> m_held;
+  std::size_t m_remaining{ 0 };
+  bool m_running{ false };
+  bool m_succeeded{ true };
+  std::promise<bool> m_done;
+  std::shared_future<bool> m_finished;
+  Observer m_observer;
+};
+
+GraphLauncher::GraphLauncher()
+  : GraphLauncher(smtk::common::Executor::instance())
+{
+}
+
+GraphLauncher::GraphLauncher(const std::shared_ptr<smtk::common::Executor>& executor)
+  : m_executor(executor)
+  , m_internal(std::make_shared<Internal>(executor.get()))
+{
+}
+
+GraphLauncher::~GraphLauncher()
+{
+  std::shared_future<bool> finished;
+  {
+    std::lock_guard<std::mutex> guard(m_internal->m_mutex);
+    if (m_internal->m_running)
+    {
+      finished = m_internal->m_finished;
+    }
+  }
+  if (finished.valid())
+  {
+    m_executor->wait(finished);
+  }
+}
+
+GraphLauncher::Node GraphLauncher::add(const Operation::Ptr& operation)
+{
+  std::lock_guard<std::mutex> guard(m_internal->m_mutex);
+  if (!operation || m_internal->m_running)
+  {
+    return static_cast<Node>(-1);
+  }
+  m_internal->m_nodes.emplace_back();
+  m_internal->m_nodes.back().m_operation = operation;
+  return m_internal->m_nodes.size() - 1;
+}
+
+bool GraphLauncher::connect(Node upstream, Node downstream)
+{
+  return m_internal->connect(upstream, downstream, Transfer());
+}
+
+bool GraphLauncher::connect(
+  Node upstream,
+  Node downstream,
+  const std::string& resultItemPath,
+  const std::string& parameterItemPath)
+{
+  return m_internal->connect(
+    upstream,
+    downstream,
+    [resultItemPath, parameterItemPath](
+      const Operation::Result& result, const Operation::Parameters& parameters) {
+      return transferItem(result, parameters, resultItemPath, parameterItemPath);
+    });
+}
+
+bool GraphLauncher::connect(Node upstream, Node downstream, const Transfer& transfer)
+{
+  if (!transfer)
+  {
+    return false;
+  }
+  return m_internal->connect(upstream, downstream, transfer);
+}
+
+void GraphLauncher::setObserver(const Observer& observer)
+{
+  std::lock_guard<std::mutex> guard(m_internal->m_mutex);
+  m_internal->m_observer = observer;
+}
+
+std::shared_future<bool> GraphLauncher::launch(smtk::common::Executor::Priority priority)
+{
+  Internal::Events events;
+  Observer observer;
+  std::shared_future<bool> finished;
+  {
+    std::lock_guard<std::mutex> guard(m_internal->m_mutex);
+    if (m_internal->m_running)
+    {
+      return m_internal->m_finished;
+    }
+
+    m_internal->m_done = std::promise<bool>();
+    m_internal->m_finished = m_internal->m_done.get_future().share();
+    finished = m_internal->m_finished;
+    m_internal->m_priority = priority;
+    m_internal->m_succeeded = true;
+    m_internal->m_remaining = m_internal->m_nodes.size();
+    observer = m_internal->m_observer;
+
+    if (m_internal->m_nodes.empty())
+    {
+      m_internal->m_done.set_value(true);
+      return finished;
+    }
+
+    for (auto& data : m_internal->m_nodes)
+    {
+      data.m_state = State::Pending;
+      data.m_waiting = data.m_inputs.size();
+      data.m_upstreamFailed = false;
+      data.m_token = smtk::common::CancellationToken();
+      data.m_promise = std::promise<Operation::Result>();
+      data.m_result = data.m_promise.get_future().share();
+      data.m_locks.clear();
+    }
+    m_internal->m_running = true;
+
+    for (Node node = 0; node < m_internal->m_nodes.size(); ++node)
+    {
+      if (m_internal->m_nodes[node].m_inputs.empty())
+      {
+        m_internal->prepare(node);
+      }
+    }
+    m_internal->schedule(events);
+  }
+  Internal::notify(observer, events);
+  return finished;
+}
+
+void GraphLauncher::cancel(Node node)
+{
+  std::lock_guard<std::mutex> guard(m_internal->m_mutex);
+  if (m_internal->valid(node))
+  {
+    m_internal->cancel(m_internal->m_nodes[node]);
+  }
+}
+
+void GraphLauncher::cancel()
+{
+  std::lock_guard<std::mutex> guard(m_internal->m_mutex);
+  for (auto& data : m_internal->m_nodes)
+  {
+    m_internal->cancel(data);
+  }
+}
+
+std::size_t GraphLauncher::numberOfNodes() const
+{
+  std::lock_guard<std::mutex> guard(m_internal->m_mutex);
+  return m_internal->m_nodes.size();
+}
+
+Operation::Ptr GraphLauncher::operation(Node node) const
+{
+  std::lock_guard<std::mutex> guard(m_internal->m_mutex);
+  return m_internal->valid(node) ? m_internal->m_nodes[node].m_operation : Operation::Ptr();
+}
+
+GraphLauncher::State GraphLauncher::state(Node node) const
+{
+  std::lock_guard<std::mutex> guard(m_internal->m_mutex);
+  return m_internal->valid(node) ? m_internal->m_nodes[node].m_state : State::Pending;
+}
+
+std::shared_future<Operation::Result> GraphLauncher::result(Node node) const
+{
+  std::lock_guard<std::mutex> guard(m_internal->m_mutex);
+  return m_internal->valid(node) ? m_internal->m_nodes[node].m_result
+                                 : std::shared_future<Operation::Result>();
+}
+
+double GraphLauncher::progress() const
+{
+  std::lock_guard<std::mutex> guard(m_internal->m_mutex);
+  if (m_internal->m_nodes.empty())
+  {
+    return 1.;
+  }
+  double completed = 0.;
+  for (const auto& data : m_internal->m_nodes)
+  {
+    if (data.m_state == State::Running)
+    {
+      completed += data.m_operation->progress();
+    }
+    else if (data.m_state != State::Pending)
+    {
+      completed += 1.;
+    }
+  }
+  return completed / static_cast<double>(m_internal->m_nodes.size());
+}
+} // namespace operation
+} // namespace smtk
@@ -0,0 +1,143 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_operation_GraphLauncher_h
+#define smtk_operation_GraphLauncher_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/common/Executor.h"
+#include "smtk/operation/Operation.h"
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+
+namespace smtk
+{
+namespace operation
+{
+
+/// Launch a directed acyclic graph of operations.
+///
+/// Each node of the graph is a configured operation. An edge from an upstream
+/// node to a downstream node delays the downstream operation until the
+/// upstream operation has succeeded and may transfer items of the upstream
+/// result into the downstream operation's parameters (e.g., the "resource"
+/// created by an import into the associations of a merge).
+///
+/// Operations whose dependencies are satisfied run concurrently on an
+/// executor, provided their resource locks are compatible: a node that would
+/// write to a resource another running node reads or writes (or read a
+/// resource another running node writes) waits without occupying a worker.
+///
+/// When an operation does not succeed or is canceled, every node downstream
+/// of it is skipped and its result has a CANCELED outcome.
+class SMTKCORE_EXPORT GraphLauncher
+{
+public:
+  typedef std::size_t Node;
+
+  /// A functor that copies data from an upstream result into downstream
+  /// parameters. It returns false if the transfer could not be made.
+  typedef std::function<bool(const Operation::Result&, const Operation::Parameters&)> Transfer;
+
+  /// The stages a node passes through while the graph runs.
+  enum class State
+  {
+    Pending,   //!< The node is waiting upon its upstream nodes or its locks.
+    Running,   //!< The node's operation has been submitted for execution.
+    Succeeded, //!< The node's operation succeeded.
+    Failed,    //!< The node's operation (or a transfer into it) did not succeed.
+    Canceled,  //!< The node was canceled.
+    Skipped    //!< An upstream node did not succeed, so the node was not run.
+  };
+
+  /// Observers are called (from worker threads) each time a node changes state.
+  typedef std::function<void(Node, State)> Observer;
+
+  /// Construct a graph launcher that runs operations on the shared executor.
+  GraphLauncher();
+
+  /// Construct a graph launcher that runs operations on \a executor.
+  GraphLauncher(const std::shared_ptr<smtk::common::Executor>& executor);
+
+  GraphLauncher(const GraphLauncher&) = delete;
+  GraphLauncher& operator=(const GraphLauncher&) = delete;
+
+  /// Wait for a running graph to finish.
+  ~GraphLauncher();
+
+  /// Add a configured operation to the graph and return its node. Nodes may
+  /// not be added while the graph is running.
+  Node add(const Operation::Ptr& operation);
+
+  /// Run \a downstream only after \a upstream has succeeded. Returns false if
+  /// either node is invalid, the graph is running or the edge would create a
+  /// cycle.
+  bool connect(Node upstream, Node downstream);
+
+  /// Run \a downstream after \a upstream and copy the values of the upstream
+  /// result item at \a resultItemPath into the downstream parameter item at
+  /// \a parameterItemPath. The parameter path "associations" refers to the
+  /// downstream parameters' associations. Reference items (resources and
+  /// components) have the upstream values appended; other items are assigned.
+  bool connect(
+    Node upstream,
+    Node downstream,
+    const std::string& resultItemPath,
+    const std::string& parameterItemPath);
+
+  /// Run \a downstream after \a upstream and call \a transfer with the upstream
+  /// result and downstream parameters before \a downstream runs.
+  bool connect(Node upstream, Node downstream, const Transfer& transfer);
+
+  /// Set a functor that is called each time a node changes state.
+  void setObserver(const Observer& observer);
+
+  /// Run the graph. The returned future holds true once every node has
+  /// finished and all of them succeeded. If the graph is already running, the
+  /// future for the current run is returned.
+  std::shared_future<bool> launch(
+    smtk::common::Executor::Priority priority = smtk::common::Executor::Priority::Batch);
+
+  /// Cancel \a node (and, as a consequence, the nodes downstream of it). If its
+  /// operation is running, it is asked to stop (see Operation::cancel()).
+  void cancel(Node node);
+
+  /// Cancel every node.
+  void cancel();
+
+  /// Return the number of nodes in the graph.
+  std::size_t numberOfNodes() const;
+
+  /// Access the operation held by \a node.
+  Operation::Ptr operation(Node node) const;
+
+  /// Return the state of \a node in the current (or last) run.
+  State state(Node node) const;
+
+  /// Return a future for the result of \a node in the current (or last) run.
+  /// The future is invalid if the graph has not been launched.
+  std::shared_future<Operation::Result> result(Node node) const;
+
+  /// Return the fraction of the current run that has completed. Finished
+  /// nodes count fully and running nodes count according to the progress
+  /// their operations report.
+  double progress() const;
+
+private:
+  struct Internal;
+  std::shared_ptr<smtk::common::Executor> m_executor;
+  std::shared_ptr<Internal> m_internal;
+};
+} // namespace operation
+} // namespace smtk
+
+#endif // smtk_operation_GraphLauncher_h
@@ -9,7 +9,7 @@
 //=========================================================================
 #include "smtk/operation/Launcher.h"
 
-#include "smtk/common/ThreadPool.h"
+#include "smtk/common/Executor.h"
 
 #include "smtk/io/Logger.h"
 
@@ -21,45 +21,42 @@ namespace
 // Key corresponding to the default operation launch method
 smtk::operation::Launchers::LauncherMap::key_type default_key = "default";
 
-// The default launcher uses a thread pool and is copy-constructible (so it can
-// be placed in a map).
+// Key corresponding to the low-priority operation launch method
+smtk::operation::Launchers::LauncherMap::key_type batch_key = "batch";
+
+// The default launcher submits operations to a work-stealing executor and is
+// copy-constructible (so it can be placed in a map). Unless given an executor,
+// launchers use the shared executor, so launchers with different priorities
+// compete for the same workers.
 class DefaultLauncher
 {
 public:
-  DefaultLauncher()
-    : m_pool(new smtk::common::ThreadPool<smtk::operation::Operation::Result>)
-  {
-  }
-
-  DefaultLauncher(const DefaultLauncher& /*unused*/)
-    : m_pool(new smtk::common::ThreadPool<smtk::operation::Operation::Result>)
+  DefaultLauncher(
+    smtk::common::Executor::Priority priority = smtk::common::Executor::Priority::Interactive)
+    : m_executor(smtk::common::Executor::instance())
+    , m_priority(priority)
   {
   }
 
-  DefaultLauncher(DefaultLauncher&& other) noexcept
-    : m_pool()
+  DefaultLauncher(
+    const std::shared_ptr<smtk::common::Executor>& executor,
+    smtk::common::Executor::Priority priority)
+    : m_executor(executor)
+    , m_priority(priority)
   {
-    m_pool.swap(other.m_pool);
-  }
-
-  DefaultLauncher& operator=(DefaultLauncher&& other) noexcept
-  {
-    if (&other != this)
-    {
-      m_pool.swap(other.m_pool);
-    }
-    return *this;
   }
 
   std::shared_future<smtk::operation::Operation::Result> operator()(
     const smtk::operation::Operation::Ptr& operation)
   {
-    return m_pool->operator()(
-      [](const smtk::operation::Operation::Ptr& op) { return op->operate(); }, operation);
+    return m_executor->submit([operation]() { return operation->operate(); }, m_priority).share();
   }
 
+  const std::shared_ptr<smtk::common::Executor>& executor() const { return m_executor; }
+
 private:
-  std::unique_ptr<smtk::common::ThreadPool<smtk::operation::Operation::Result>> m_pool;
+  std::shared_ptr<smtk::common::Executor> m_executor;
+  smtk::common::Executor::Priority m_priority;
 };
 } // namespace
 
@@ -70,7 +67,10 @@ namespace operation
 
 Launchers::Launchers()
 {
-  m_launchers[default_key] = DefaultLauncher();
+  DefaultLauncher interactive;
+  m_launchers[batch_key] =
+    DefaultLauncher(interactive.executor(), smtk::common::Executor::Priority::Batch);
+  m_launchers[default_key] = std::move(interactive);
 }
 
 Launchers::Launchers(const LauncherMap::mapped_type& m_type)
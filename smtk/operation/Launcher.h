@@ -33,8 +33,10 @@ class SMTKCORE_EXPORT Launchers
 public:
   typedef std::unordered_map<std::string, Launcher> LauncherMap;
 
-  /// Construct a launcher that launches operations using an asynchronous thread
-  /// by default.
+  /// Construct a launcher that launches operations on a shared work-stealing
+  /// executor by default. Operations launched with the "batch" key run on the
+  /// same executor in a lower-priority lane, so they do not delay operations
+  /// launched with the default key.
   Launchers();
 
   /// Construct a launcher that launches operations using a user-defined method
@@ -32,6 +32,7 @@ Metadata::Metadata(
   , m_index(index)
   , m_specification(specification)
   , m_primaryAssociation(nullptr)
+  , m_attributePool(std::make_shared<AttributePool>())
 {
   // Extract all of the component definitions once, rather than invoking this
   // call every time Metadata::acceptsComponent() is called.
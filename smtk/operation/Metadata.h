@@ -14,10 +14,12 @@
 #include "smtk/CoreExports.h"
 #include "smtk/PublicPointerDefs.h"
 
+#include "smtk/operation/AttributePool.h"
 #include "smtk/operation/MetadataObserver.h"
 #include "smtk/operation/Operation.h"
 
 #include <functional>
+#include <memory>
 #include <set>
 #include <string>
 
@@ -70,6 +72,10 @@ public:
 
   std::set<std::string> groups() const;
 
+  /// Return the pool of recycled parameter and result attributes shared by
+  /// all managed operations of this type.
+  const std::shared_ptr<AttributePool>& attributePool() const { return m_attributePool; }
+
   std::function<std::shared_ptr<smtk::operation::Operation>(void)> create;
 
 private:
@@ -78,6 +84,7 @@ private:
   Operation::Specification m_specification;
   std::function<bool(const smtk::resource::ComponentPtr&)> m_acceptsComponent;
   Association m_primaryAssociation;
+  std::shared_ptr<AttributePool> m_attributePool;
 };
 } // namespace operation
 } // namespace smtk
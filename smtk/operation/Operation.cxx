@@ -8,6 +8,7 @@
 //  PURPOSE.  See the above copyright notice for more information.
 //=========================================================================
 #include "smtk/operation/Operation.h"
+#include "smtk/operation/AttributePool.h"
 #include "smtk/operation/Manager.h"
 #include "smtk/operation/Observer.h"
 #include "smtk/operation/SpecificationOps.h"
@@ -23,12 +24,14 @@
 #include "smtk/io/AttributeReader.h"
 #include "smtk/io/Logger.h"
 
+#include "smtk/resource/LockSet.h"
+
 #include "smtk/operation/Operation_xml.h"
 
 #include "nlohmann/json.hpp"
 
+#include <algorithm>
 #include <memory>
-#include <mutex>
 #include <sstream>
 
 namespace
@@ -38,6 +41,24 @@ namespace
 // used to create that name. Its value is irrelevant so we don't need to reset
 // it; its uniqueness is what we are after.
 std::atomic<std::size_t> g_uniqueCounter{ 0 };
+
+// Progress observers are called at most once per interval (except for the
+// final report) so that operations reporting progress in tight loops do not
+// flood user interfaces with events.
+constexpr std::chrono::milliseconds g_progressInterval(100);
+
+// Give an attribute taken from an operation type's pool a new unique name, so
+// it is not mistaken for the parameters or result of the operation that
+// released it, and drop any properties set on it.
+void renewAttribute(
+  const smtk::attribute::ResourcePtr& specification,
+  const smtk::attribute::AttributePtr& attribute,
+  const std::string& name)
+{
+  smtk::resource::ScopedLockGuard lock(specification->lock({}), smtk::resource::LockType::Write);
+  specification->rename(attribute, name);
+  specification->properties().data().eraseId(attribute->id());
+}
 } // namespace
 
 namespace smtk
@@ -57,27 +78,44 @@ Operation::~Operation()
   // If the specification exists...
   if (m_specification != nullptr)
   {
-    smtk::resource::ScopedLockGuard lock(
-      m_specification->lock({}), smtk::resource::LockType::Write);
-
-    // ...and if the parameters have been generated, remove the parameters from
-    // the specification.
+    // ...return the parameters and results generated by this operation to the
+    // pool if nothing else refers to them. Those that cannot be recycled are
+    // removed from the specification.
+    std::vector<smtk::attribute::AttributePtr> expired;
     if (m_parameters != nullptr)
     {
-      m_specification->removeAttribute(m_parameters);
+      bool recycled = m_attributePool && m_parameters.use_count() == m_parametersUseCount &&
+        m_attributePool->releaseParameters(m_parameters);
+      if (!recycled)
+      {
+        expired.push_back(m_parameters);
+      }
     }
 
-    // Similarly, remove all results from the specification that were generated
-    // by this operation.
     for (auto& result : m_results)
     {
-      auto res = result.lock();
+      auto res = result.first.lock();
       if (!res)
       {
         continue;
       }
 
-      m_specification->removeAttribute(res);
+      bool recycled = m_attributePool && res.use_count() == result.second &&
+        m_attributePool->releaseResult(res);
+      if (!recycled)
+      {
+        expired.push_back(res);
+      }
+    }
+
+    if (!expired.empty())
+    {
+      smtk::resource::ScopedLockGuard lock(
+        m_specification->lock({}), smtk::resource::LockType::Write);
+      for (auto& attribute : expired)
+      {
+        m_specification->removeAttribute(attribute);
+      }
     }
   }
 }
@@ -97,6 +135,7 @@ Operation::Specification Operation::specification()
       assert(metadata != manager->metadata().get<IndexTag>().end());
 
       m_specification = metadata->specification();
+      m_attributePool = metadata->attributePool();
     }
     else
     {
@@ -124,12 +163,10 @@ Operation::Result Operation::operate()
   // Gather all requested resources and their lock types.
   auto resourcesAndLockTypes = extractResourcesAndLockTypes(this->parameters());
 
-  // Mutex to prevent multiple Operations from locking resources at the same
-  // time (which could result in deadlock).
-  static std::mutex mutex;
-
-  // Lock the resources.
-  mutex.lock();
+  // Lock the resources. Locks are acquired in a consistent order with
+  // back-off, so operations on disjoint resources do not serialize and
+  // operations on overlapping resources cannot deadlock.
+  smtk::resource::LockSet resourceLocks;
   for (auto& resourceAndLockType : resourcesAndLockTypes)
   {
     auto resource = resourceAndLockType.first.lock();
@@ -157,13 +194,13 @@ Operation::Result Operation::operate()
               << "\"\n";
 #endif
 
-    resource->lock({}).lock(lockType);
+    resourceLocks.insert(resource, lockType);
   }
-  mutex.unlock();
+  resourceLocks.lock();
 
-  // Remember where the log was so we only serialize messages for this
-  // operation:
-  std::size_t logStart = this->log().numberOfRecords();
+  // Collect the messages this operation logs (on this thread) so that we only
+  // serialize those rather than copying the logger's entire history.
+  smtk::io::Logger::Capture logCapture(this->log());
 
   Result result;
 
@@ -176,6 +213,9 @@ Operation::Result Operation::operate()
   bool observePostOperation = manager != nullptr;
   Outcome outcome;
 
+  m_progressState.m_fraction = 0.;
+  m_progressState.m_lastReport = std::chrono::steady_clock::time_point();
+
   // First, we check that the operation is able to operate.
   if (!this->ableToOperate())
   {
@@ -184,6 +224,14 @@ Operation::Result Operation::operate()
     // If the operation cannot operate, there is no need to call any observers.
     observePostOperation = false;
   }
+  // If cancellation was requested before the operation started (e.g., while
+  // it was queued by a launcher), it is not run and observers are not called.
+  else if (this->isCanceled())
+  {
+    outcome = Outcome::CANCELED;
+    result = this->createResult(outcome);
+    observePostOperation = false;
+  }
   // Then, we check if any observers wish to cancel this operation.
   else if (manager && manager->observers()(*this, EventType::WILL_OPERATE, nullptr))
   {
@@ -205,6 +253,7 @@ Operation::Result Operation::operate()
     outcome = static_cast<Outcome>(result->findInt("outcome")->value());
     if (outcome == Outcome::SUCCEEDED)
     {
+      this->reportProgress(1.);
       this->postProcessResult(result);
     }
 
@@ -221,15 +270,12 @@ Operation::Result Operation::operate()
   this->generateSummary(result);
 
   // Now grab all log messages and serialize them into the result attribute.
+  std::vector<smtk::io::Logger::Record> records = logCapture.records();
+  if (!records.empty())
   {
-    std::size_t logEnd = this->log().numberOfRecords();
-    if (logEnd > logStart)
-    {
-      // Serialize relevant log records to a json-formatted string.
-      auto records = this->log().records();
-      nlohmann::json j = records;
-      result->findString("log")->appendValue(j.dump());
-    }
+    // Serialize relevant log records to a json-formatted string.
+    nlohmann::json j = records;
+    result->findString("log")->appendValue(j.dump());
   }
 
   // Execute post-operation observation
@@ -239,17 +285,39 @@ Operation::Result Operation::operate()
   }
 
   // Unlock the resources.
-  for (auto& resourceAndLockType : resourcesAndLockTypes)
-  {
-    auto resource = resourceAndLockType.first.lock();
-    auto& lockType = resourceAndLockType.second;
+  resourceLocks.unlock();
 
-    resource->lock({}).unlock(lockType);
-  }
+  // Clear any cancellation request so the operation may be run again.
+  m_progressState.m_canceled = false;
 
   return result;
 }
 
+Operation::Result Operation::operate(Key)
+{
+  m_progressState.m_fraction = 0.;
+  m_progressState.m_lastReport = std::chrono::steady_clock::time_point();
+  Result result = this->operateInternal();
+  m_progressState.m_canceled = false;
+  return result;
+}
+
+bool Operation::reportProgress(double fraction, const std::string& message)
+{
+  fraction = std::min(std::max(fraction, 0.), 1.);
+  m_progressState.m_fraction = fraction;
+  if (m_progressState.m_observer)
+  {
+    auto now = std::chrono::steady_clock::now();
+    if (fraction >= 1. || now - m_progressState.m_lastReport >= g_progressInterval)
+    {
+      m_progressState.m_lastReport = now;
+      m_progressState.m_observer(fraction, message);
+    }
+  }
+  return !m_progressState.m_canceled;
+}
+
 smtk::io::Logger& Operation::log() const
 {
   return smtk::io::Logger::instance();
@@ -262,13 +330,37 @@ Operation::Parameters Operation::parameters()
   if (!m_parameters)
   {
     auto specification = this->specification();
-    smtk::resource::ScopedLockGuard lock(specification->lock({}), smtk::resource::LockType::Write);
-    if (m_parameters != nullptr)
+
+    // Managed operations first try to reuse parameters released by a previous
+    // operation of the same type. The pool is itself thread-safe; as with the
+    // rest of this lazy initialization, callers must not first access a single
+    // operation's parameters from several threads at once.
+    if (m_attributePool)
+    {
+      m_parameters = m_attributePool->acquireParameters();
+      if (m_parameters)
+      {
+        renewAttribute(
+          specification, m_parameters, this->typeName() + std::to_string(g_uniqueCounter++));
+      }
+    }
+
+    if (!m_parameters)
     {
-      return m_parameters;
+      smtk::resource::ScopedLockGuard lock(
+        specification->lock({}), smtk::resource::LockType::Write);
+      if (m_parameters != nullptr)
+      {
+        return m_parameters;
+      }
+      m_parameters = createParameters(
+        specification, this->typeName(), this->typeName() + std::to_string(g_uniqueCounter++));
+    }
+
+    if (m_parameters)
+    {
+      m_parametersUseCount = m_parameters.use_count();
     }
-    m_parameters = createParameters(
-      specification, this->typeName(), this->typeName() + std::to_string(g_uniqueCounter++));
   }
 
   // If we still don't have our parameters, then there's not much we can do.
@@ -312,18 +404,28 @@ Operation::Result Operation::createResult(Outcome outcome)
 
   if (m_resultDefinition)
   {
-    // Create a new instance of the result.
+    // Reuse a result released by a previous operation of the same type or, if
+    // there is none, create a new instance of the result.
+    auto specification = this->specification();
+    std::string name = this->typeName() + "_result_" + std::to_string(g_uniqueCounter++);
+    if (m_attributePool)
+    {
+      result = m_attributePool->acquireResult();
+      if (result)
+      {
+        renewAttribute(specification, result, name);
+      }
+    }
+    if (!result)
     {
-      auto specification = this->specification();
       smtk::resource::ScopedLockGuard lock(
         specification->lock({}), smtk::resource::LockType::Write);
-      result = specification->createAttribute(
-        this->typeName() + "_result_" + std::to_string(g_uniqueCounter++), m_resultDefinition);
+      result = specification->createAttribute(name, m_resultDefinition);
     }
 
-    // Hold on to a copy of the generated result so we can remove it from our
-    // specification when the operation is destroyed.
-    m_results.push_back(result);
+    // Hold on to a copy of the generated result so we can recycle it or
+    // remove it from our specification when the operation is destroyed.
+    m_results.push_back(std::make_pair(result, result ? result.use_count() : 0));
   }
   else
   {
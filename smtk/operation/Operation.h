@@ -14,6 +14,9 @@
 #include "smtk/PublicPointerDefs.h"
 #include "smtk/SharedFromThis.h"
 
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <string>
 #include <typeindex>
 #include <utility>
@@ -31,6 +34,8 @@ class Logger;
 }
 namespace operation
 {
+class AttributePool;
+class Batch;
 class ImportPythonOperation;
 class Manager;
 
@@ -64,6 +69,10 @@ public:
 
   typedef std::shared_ptr<smtk::attribute::Definition> Definition;
 
+  // A functor that receives the fraction (in [0, 1]) of the operation that
+  // has completed and a message describing the current step (may be empty).
+  typedef std::function<void(double, const std::string&)> ProgressObserver;
+
   // These values are taken on by the "outcome" item of every Operation Result.
   enum class Outcome
   {
@@ -75,6 +84,7 @@ public:
   };
 
   friend Manager;
+  friend Batch;
   friend ImportPythonOperation;
 
   // Index is a compile-time intrinsic of the derived operation; as such, it
@@ -144,6 +154,31 @@ public:
   /// Operations that are managed have a non-null pointer to their manager.
   ManagerPtr manager() const { return m_manager.lock(); }
 
+  /// Request that the operation stop. This may be called from any thread. If
+  /// the operation has not yet started (e.g., it is queued by a launcher), it
+  /// returns a CANCELED result without running. If it is running, it stops the
+  /// next time it reports progress, provided it supports cancellation. The
+  /// request is cleared when operate() returns, so a request made after the
+  /// operation has finished applies to its next execution.
+  void cancel() { m_progressState.m_canceled = true; }
+
+  /// Return true if cancellation has been requested.
+  bool isCanceled() const { return m_progressState.m_canceled; }
+
+  /// Return the fraction of the operation that has completed during the
+  /// current (or last) execution.
+  double progress() const { return m_progressState.m_fraction; }
+
+  /// Set a functor to be called (on the thread executing the operation) as
+  /// the operation reports progress. Calls are throttled, so the observer is
+  /// not called for every report. Set the observer before launching the
+  /// operation.
+  void setProgressObserver(const ProgressObserver& observer)
+  {
+    m_progressState.m_observer = observer;
+  }
+  const ProgressObserver& progressObserver() const { return m_progressState.m_observer; }
+
 protected:
   Operation();
 
@@ -168,6 +203,12 @@ protected:
   // an attribute .sbt file.
   Specification createBaseSpecification() const;
 
+  // Report that \a fraction of the operation has completed. Long-running
+  // operations should call this periodically from operateInternal(). It
+  // returns false if the operation has been asked to cancel; the operation
+  // should then undo any partial changes and return a CANCELED result.
+  bool reportProgress(double fraction, const std::string& message = std::string());
+
   int m_debugLevel{ 0 };
   std::weak_ptr<Manager> m_manager;
 
@@ -185,7 +226,9 @@ protected:
   };
 
 public:
-  Result operate(Key) { return operateInternal(); }
+  // Like operate(), this resets the operation's progress and clears any
+  // cancellation request once the operation is done.
+  Result operate(Key);
 
 private:
   // Construct the operation's specification. This is typically done by reading
@@ -197,7 +240,30 @@ private:
   Specification m_specification;
   Parameters m_parameters;
   Definition m_resultDefinition;
-  std::vector<std::weak_ptr<smtk::attribute::Attribute>> m_results;
+
+  // Managed operations recycle their parameters and results through a pool
+  // shared by all operations of the same type. An attribute is only recycled
+  // if its use count has returned to the value it had when this operation
+  // obtained it (i.e., nothing outside of the specification refers to it), so
+  // that count is held alongside the parameters and each result.
+  std::shared_ptr<AttributePool> m_attributePool;
+  long m_parametersUseCount{ 0 };
+  std::vector<std::pair<std::weak_ptr<smtk::attribute::Attribute>, long>> m_results;
+
+  // Progress and cancellation state. It is not copied when an operation is
+  // assigned, so a copy does not inherit another operation's requests.
+  struct ProgressState
+  {
+    ProgressState() = default;
+    ProgressState(const ProgressState&) {}
+    ProgressState& operator=(const ProgressState&) { return *this; }
+
+    std::atomic<bool> m_canceled{ false };
+    std::atomic<double> m_fraction{ 0. };
+    std::chrono::steady_clock::time_point m_lastReport;
+    ProgressObserver m_observer;
+  };
+  ProgressState m_progressState;
 };
 } // namespace operation
 } // namespace smtk
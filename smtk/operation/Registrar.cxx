@@ -14,12 +14,15 @@
 #ifdef SMTK_PYTHON_ENABLED
 #include "smtk/operation/operators/ImportPythonOperation.h"
 #endif
+#include "smtk/operation/operators/Batch.h"
 #include "smtk/operation/operators/ImportResource.h"
 #include "smtk/operation/operators/ReadResource.h"
 #include "smtk/operation/operators/RemoveResource.h"
 #include "smtk/operation/operators/SetProperty.h"
 #include "smtk/operation/operators/WriteResource.h"
 
+#include "smtk/operation/groups/InternalGroup.h"
+
 #include "smtk/plugin/Manager.h"
 
 #include <tuple>
@@ -34,6 +37,7 @@ typedef std::tuple<
 #ifdef SMTK_PYTHON_ENABLED
   ImportPythonOperation,
 #endif
+  Batch,
   ImportResource,
   ReadResource,
   RemoveResource,
@@ -66,11 +70,17 @@ void Registrar::unregisterFrom(const smtk::common::Managers::Ptr& managers)
 void Registrar::registerTo(const smtk::operation::Manager::Ptr& operationManager)
 {
   operationManager->registerOperations<OperationList>();
+
+  smtk::operation::InternalGroup internalGroup(operationManager);
+  internalGroup.registerOperation<Batch>();
 }
 
 void Registrar::unregisterFrom(const smtk::operation::Manager::Ptr& operationManager)
 {
   operationManager->unregisterOperations<OperationList>();
+
+  smtk::operation::InternalGroup internalGroup(operationManager);
+  internalGroup.unregisterOperation<Batch>();
 }
 } // namespace operation
 } // namespace smtk
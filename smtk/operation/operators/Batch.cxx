@@ -0,0 +1,303 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/operation/operators/Batch.h"
+
+#include "smtk/operation/Batch_xml.h"
+#include "smtk/operation/SpecificationOps.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/ComponentItem.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/ResourceItem.h"
+#include "smtk/attribute/StringItem.h"
+
+#include "smtk/io/Logger.h"
+
+#include "smtk/resource/Component.h"
+
+#include "nlohmann/json.hpp"
+
+#include <map>
+#include <set>
+
+namespace
+{
+// Accumulate the components created, modified and expunged by a sequence of
+// operations into the net change made by the sequence, along with the
+// resources reported by each operation (e.g., those read or imported).
+class ChangeSet
+{
+public:
+  void insert(const smtk::operation::Operation::Result& result)
+  {
+    this->visit(result->findComponent("created"), &ChangeSet::created);
+    this->visit(result->findComponent("modified"), &ChangeSet::modified);
+    this->visit(result->findComponent("expunged"), &ChangeSet::expunged);
+
+    std::vector<smtk::attribute::ResourceItemPtr> resourceItems;
+    result->filterItems(
+      resourceItems, [](smtk::attribute::ResourceItemPtr /*unused*/) { return true; });
+    for (const auto& item : resourceItems)
+    {
+      for (std::size_t i = 0; i < item->numberOfValues(); ++i)
+      {
+        auto resource = item->isSet(i) ? item->value(i) : smtk::resource::ResourcePtr();
+        if (resource && m_resourceSet.insert(resource).second)
+        {
+          m_resources.push_back(resource);
+        }
+      }
+    }
+  }
+
+  void populate(const smtk::operation::Operation::Result& result) const
+  {
+    std::vector<smtk::resource::ComponentPtr> components[3];
+    for (const auto& component : m_order)
+    {
+      auto it = m_changes.find(component);
+      if (it != m_changes.end() && it->second != Change::None)
+      {
+        components[static_cast<int>(it->second)].push_back(component);
+      }
+    }
+    const char* names[3] = { "created", "modified", "expunged" };
+    for (int i = 0; i < 3; ++i)
+    {
+      if (!components[i].empty())
+      {
+        result->findComponent(names[i])->setValues(components[i].begin(), components[i].end());
+      }
+    }
+    if (!m_resources.empty())
+    {
+      result->findResource("resource")->setValues(m_resources.begin(), m_resources.end());
+    }
+  }
+
+private:
+  enum class Change
+  {
+    Created = 0,
+    Modified = 1,
+    Expunged = 2,
+    None
+  };
+
+  void visit(const smtk::attribute::ComponentItemPtr& item, void (ChangeSet::*record)(Change&))
+  {
+    if (!item)
+    {
+      return;
+    }
+    for (std::size_t i = 0; i < item->numberOfValues(); ++i)
+    {
+      auto component = item->value(i);
+      if (!component)
+      {
+        continue;
+      }
+      auto it = m_changes.find(component);
+      if (it == m_changes.end())
+      {
+        m_order.push_back(component);
+        it = m_changes.insert(std::make_pair(component, Change::None)).first;
+      }
+      (this->*record)(it->second);
+    }
+  }
+
+  void created(Change& change) { change = Change::Created; }
+
+  void modified(Change& change)
+  {
+    // A component created earlier in the batch is reported as created.
+    if (change == Change::None)
+    {
+      change = Change::Modified;
+    }
+  }
+
+  void expunged(Change& change)
+  {
+    // A component both created and expunged within the batch never existed
+    // as far as observers of the batch are concerned.
+    change = (change == Change::Created ? Change::None : Change::Expunged);
+  }
+
+  std::map<smtk::resource::ComponentPtr, Change> m_changes;
+  std::vector<smtk::resource::ComponentPtr> m_order;
+  std::set<smtk::resource::ResourcePtr> m_resourceSet;
+  std::vector<smtk::resource::ResourcePtr> m_resources;
+};
+} // namespace
+
+namespace smtk
+{
+namespace operation
+{
+
+Batch::Batch() = default;
+
+bool Batch::append(const Operation::Ptr& operation)
+{
+  if (!operation || operation.get() == this)
+  {
+    return false;
+  }
+
+  // Record the resources the operation would lock so that the batch, which
+  // runs its operations without locking, acquires them on their behalf.
+  auto readItem = this->parameters()->findResource("read resources");
+  auto writeItem = this->parameters()->findResource("write resources");
+  for (const auto& resourceAndLockType : extractResourcesAndLockTypes(operation->parameters()))
+  {
+    auto resource = resourceAndLockType.first.lock();
+    if (!resource)
+    {
+      continue;
+    }
+    if (resourceAndLockType.second == smtk::resource::LockType::Write)
+    {
+      if (!writeItem->contains(resource))
+      {
+        auto index = readItem->find(resource);
+        if (index >= 0)
+        {
+          readItem->removeValue(static_cast<std::size_t>(index));
+        }
+        writeItem->appendValue(resource);
+      }
+    }
+    else if (resourceAndLockType.second == smtk::resource::LockType::Read)
+    {
+      if (!writeItem->contains(resource) && !readItem->contains(resource))
+      {
+        readItem->appendValue(resource);
+      }
+    }
+  }
+
+  m_operations.push_back(operation);
+  return true;
+}
+
+void Batch::clear()
+{
+  m_operations.clear();
+  m_results.clear();
+  this->parameters()->findResource("read resources")->setNumberOfValues(0);
+  this->parameters()->findResource("write resources")->setNumberOfValues(0);
+}
+
+bool Batch::ableToOperate()
+{
+  // Operations later in the batch may depend upon the changes made by earlier
+  // ones, so each operation is only checked immediately before it runs.
+  return this->Superclass::ableToOperate() && !m_operations.empty();
+}
+
+Batch::Result Batch::operateInternal()
+{
+  m_results.clear();
+
+  ChangeSet changes;
+  Outcome outcome = Outcome::SUCCEEDED;
+  for (const auto& operation : m_operations)
+  {
+    // Stop between operations if the batch has been canceled.
+    if (!this->reportProgress(
+          static_cast<double>(m_results.size()) / static_cast<double>(m_operations.size())))
+    {
+      outcome = Outcome::CANCELED;
+      break;
+    }
+
+    // Collect what the operation logs so that its result carries its log
+    // records (as it would when run on its own).
+    smtk::io::Logger::Capture logCapture(operation->log());
+
+    Result result;
+    if (!operation->ableToOperate())
+    {
+      outcome = Outcome::UNABLE_TO_OPERATE;
+      result = operation->createResult(outcome);
+    }
+    else
+    {
+      // While the operation runs, its progress is reported as the batch's and
+      // a request to cancel the batch is forwarded to it.
+      ProgressObserver observer = operation->progressObserver();
+      double completed = static_cast<double>(m_results.size());
+      double total = static_cast<double>(m_operations.size());
+      operation->setProgressObserver([&](double fraction, const std::string& message) {
+        if (observer)
+        {
+          observer(fraction, message);
+        }
+        if (!this->reportProgress((completed + fraction) / total, message))
+        {
+          operation->cancel();
+        }
+      });
+
+      // The batch holds the locks for all of its operations, so they are run
+      // directly rather than through their public operate() method.
+      result = operation->operate(Key());
+      operation->setProgressObserver(observer);
+      outcome = static_cast<Outcome>(result->findInt("outcome")->value());
+      if (outcome == Outcome::SUCCEEDED)
+      {
+        operation->postProcessResult(result);
+      }
+      if (outcome == Outcome::SUCCEEDED || outcome == Outcome::FAILED)
+      {
+        operation->markModifiedResources(result);
+      }
+      changes.insert(result);
+    }
+
+    operation->generateSummary(result);
+    std::vector<smtk::io::Logger::Record> records = logCapture.records();
+    if (!records.empty())
+    {
+      nlohmann::json j = records;
+      result->findString("log")->appendValue(j.dump());
+      // Records sent to the batch's own logger are already captured by the
+      // batch; forward those sent elsewhere so the batch's log is complete.
+      if (&operation->log() != &this->log())
+      {
+        for (const auto& record : records)
+        {
+          this->log().addRecord(
+            record.severity, record.message, record.fileName, record.lineNumber);
+        }
+      }
+    }
+
+    m_results.push_back(result);
+    if (outcome != Outcome::SUCCEEDED)
+    {
+      break;
+    }
+  }
+
+  Result result = this->createResult(outcome);
+  changes.populate(result);
+  result->findInt("operations")->setValue(static_cast<int>(m_results.size()));
+  return result;
+}
+
+const char* Batch::xmlDescription() const
+{
+  return Batch_xml;
+}
+} // namespace operation
+} // namespace smtk
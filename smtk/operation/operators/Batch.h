@@ -0,0 +1,79 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_operation_Batch_h
+#define smtk_operation_Batch_h
+
+#include "smtk/operation/XMLOperation.h"
+
+#include <vector>
+
+namespace smtk
+{
+namespace operation
+{
+
+/// Run a sequence of configured operations as a single operation.
+///
+/// Operations appended to a batch are run in order when the batch is
+/// operated. The batch acquires the union of their resource locks once
+/// (rather than once per operation) and, if it is managed, observers are
+/// notified once for the entire batch rather than once per operation. The
+/// batch's result holds the union of the components created, modified and
+/// expunged by its operations: a component created and then expunged within
+/// the batch is reported in neither item, and a component that is both
+/// created and modified is only reported as created.
+///
+/// Because observers see the batch as a single operation, applications that
+/// record undo steps on DID_OPERATE record the batch as one step.
+///
+/// The batch stops at the first operation that is unable to operate or that
+/// does not succeed; the batch's outcome is then that operation's outcome.
+/// Changes made by operations that already ran are not rolled back; they are
+/// reported in the batch's result. Likewise, canceling a running batch cancels
+/// the operation it is running (which stops the next time it reports
+/// progress) and stops the batch before its next operation.
+class SMTKCORE_EXPORT Batch : public XMLOperation
+{
+public:
+  smtkTypeMacro(smtk::operation::Batch);
+  smtkSharedPtrCreateMacro(smtk::operation::Operation);
+  smtkSuperclassMacro(smtk::operation::XMLOperation);
+
+  /// Append a configured operation to the batch. Operations should not be
+  /// modified once appended, since the resources they lock are gathered here.
+  /// Returns false if \a operation is null or is this batch.
+  bool append(const Operation::Ptr& operation);
+
+  /// Remove all operations from the batch.
+  void clear();
+
+  /// Access the operations in the batch.
+  const std::vector<Operation::Ptr>& operations() const { return m_operations; }
+
+  /// Access the results of the operations that ran during the last operate().
+  const std::vector<Result>& results() const { return m_results; }
+
+  bool ableToOperate() override;
+
+protected:
+  Batch();
+
+  Result operateInternal() override;
+
+  const char* xmlDescription() const override;
+
+private:
+  std::vector<Operation::Ptr> m_operations;
+  std::vector<Result> m_results;
+};
+} // namespace operation
+} // namespace smtk
+
+#endif // smtk_operation_Batch_h
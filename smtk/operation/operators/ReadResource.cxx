@@ -16,6 +16,7 @@
 #include "smtk/attribute/ResourceItem.h"
 
 #include "smtk/common/Archive.h"
+#include "smtk/common/json/jsonBinary.h"
 
 #include "smtk/io/Logger.h"
 
@@ -89,7 +90,7 @@ ReadResource::Result ReadResource::operateInternal()
       }
       else
       {
-        file.open(filename, std::ios::in);
+        file.open(filename, std::ios::in | std::ios::binary);
       }
 
       {
@@ -104,7 +105,7 @@ ReadResource::Result ReadResource::operateInternal()
 
         try
         {
-          j = json::parse(file);
+          j = smtk::common::BinaryJSON::parse(file);
           type = j.at("type").get<std::string>();
           fileTypeKnown = true;
         }
@@ -163,8 +163,9 @@ public:
   void generateSummary(Result& res) override
     { PYBIND11_OVERLOAD(void, Operation, generateSummary, res); }
 
-  // We incorporate the base class's method with a different access modifier
+  // We incorporate the base class's methods with a different access modifier
   using Operation::createBaseSpecification;
+  using Operation::reportProgress;
 
 private:
   Specification createSpecification() override
@@ -0,0 +1,39 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef pybind_smtk_operation_operators_Batch_h
+#define pybind_smtk_operation_operators_Batch_h
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "smtk/operation/operators/Batch.h"
+
+#include "smtk/operation/XMLOperation.h"
+
+namespace py = pybind11;
+
+inline PySharedPtrClass< smtk::operation::Batch, smtk::operation::XMLOperation > pybind11_init_smtk_operation_Batch(py::module &m)
+{
+  PySharedPtrClass< smtk::operation::Batch, smtk::operation::XMLOperation > instance(m, "Batch");
+  instance
+    .def_static("create", (std::shared_ptr<smtk::operation::Batch> (*)()) &smtk::operation::Batch::create)
+    .def_static("create", (std::shared_ptr<smtk::operation::Batch> (*)(::std::shared_ptr<smtk::operation::Batch> &)) &smtk::operation::Batch::create, py::arg("ref"))
+    .def("append", &smtk::operation::Batch::append, py::arg("operation"))
+    .def("clear", &smtk::operation::Batch::clear)
+    .def("operations", &smtk::operation::Batch::operations)
+    .def("results", &smtk::operation::Batch::results)
+    .def("shared_from_this", (std::shared_ptr<const smtk::operation::Batch> (smtk::operation::Batch::*)() const) &smtk::operation::Batch::shared_from_this)
+    .def("shared_from_this", (std::shared_ptr<smtk::operation::Batch> (smtk::operation::Batch::*)()) &smtk::operation::Batch::shared_from_this)
+    ;
+  return instance;
+}
+
+#endif
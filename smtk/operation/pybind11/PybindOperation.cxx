@@ -29,6 +29,7 @@ using PySharedPtrClass = py::class_<T, std::shared_ptr<T>, Args...>;
 #include "PybindResourceManagerOperation.h"
 #include "PybindXMLOperation.h"
 
+#include "PybindBatch.h"
 #include "PybindReadResource.h"
 #include "PybindRemoveResource.h"
 #include "PybindSetProperty.h"
@@ -54,6 +55,7 @@ PYBIND11_MODULE(_smtkPybindOperation, operation)
   pybind11_init_smtk_operation_EventType(operation);
   PySharedPtrClass< smtk::operation::XMLOperation, smtk::operation::Operation > smtk_operation_XMLOperation = pybind11_init_smtk_operation_XMLOperation(operation);
 
+  PySharedPtrClass< smtk::operation::Batch, smtk::operation::XMLOperation > smtk_operation_Batch = pybind11_init_smtk_operation_Batch(operation);
   PySharedPtrClass< smtk::operation::ReadResource, smtk::operation::XMLOperation > smtk_operation_ReadResource = pybind11_init_smtk_operation_ReadResource(operation);
   PySharedPtrClass< smtk::operation::RemoveResource, smtk::operation::XMLOperation > smtk_operation_RemoveResource = pybind11_init_smtk_operation_RemoveResource(operation);
   PySharedPtrClass< smtk::operation::SetProperty, smtk::operation::XMLOperation > smtk_operation_SetProperty = pybind11_init_smtk_operation_SetProperty(operation);
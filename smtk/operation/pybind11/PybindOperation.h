@@ -12,6 +12,7 @@
 #define pybind_smtk_operation_Operation_h
 
 #include <pybind11/pybind11.h>
+#include <pybind11/functional.h>
 
 #include "smtk/operation/pybind11/PyOperation.h"
 
@@ -40,6 +41,11 @@ inline PySharedPtrClass< smtk::operation::Operation, smtk::operation::PyOperatio
     .def("_parameters", (smtk::operation::Operation::Parameters (smtk::operation::Operation::*)()) &smtk::operation::Operation::parameters)
     .def("createResult", &smtk::operation::Operation::createResult, py::arg("arg0"))
     .def("manager", &smtk::operation::Operation::manager)
+    .def("cancel", &smtk::operation::Operation::cancel)
+    .def("isCanceled", &smtk::operation::Operation::isCanceled)
+    .def("progress", &smtk::operation::Operation::progress)
+    .def("setProgressObserver", &smtk::operation::Operation::setProgressObserver, py::arg("observer"))
+    .def("reportProgress", &smtk::operation::PyOperation::reportProgress, py::arg("fraction"), py::arg("message") = std::string())
     ;
   py::enum_<smtk::operation::Operation::Outcome>(instance, "Outcome")
     .value("UNABLE_TO_OPERATE", smtk::operation::Operation::Outcome::UNABLE_TO_OPERATE)
@@ -0,0 +1,294 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_operation_ComponentCache_h
+#define smtk_operation_ComponentCache_h
+
+#include "smtk/CoreExports.h"
+
+#include "smtk/common/Executor.h"
+#include "smtk/common/UUID.h"
+
+#include "smtk/operation/queries/SynchronizedCache.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/ComponentItem.h"
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace smtk
+{
+namespace operation
+{
+
+/**\brief A query cache of values computed per component.
+  *
+  * ComponentCache memoizes a value (e.g., a point locator or the bounds of a
+  * component's geometry) for each component id. Entries for components that
+  * an operation reports as modified or expunged are discarded when the
+  * operation completes. The least recently used entries are evicted once the
+  * total cost of the cached values exceeds the cache's budget; by default,
+  * each value costs 1 and the budget is unlimited.
+  *
+  * Values are held by shared pointer, so a value returned by the cache
+  * remains valid after it is evicted or invalidated. All methods may be
+  * called concurrently.
+  *
+  * Query caches are constructed by (and keyed on the type passed to)
+  * smtk::resource::query::Queries::cache(), so each cached query should
+  * derive its own cache type from ComponentCache.
+  */
+template<typename ValueType>
+class ComponentCache : public SynchronizedCache
+{
+public:
+  typedef std::function<std::size_t(const ValueType&)> CostFunction;
+
+  /// Counters describing the use of a cache.
+  struct Statistics
+  {
+    std::size_t hits{ 0 };          //!< Lookups that found a value.
+    std::size_t misses{ 0 };        //!< Lookups that found no value.
+    std::size_t evictions{ 0 };     //!< Values discarded to remain within budget.
+    std::size_t invalidations{ 0 }; //!< Values discarded because a component changed.
+  };
+
+  ComponentCache() = default;
+  ComponentCache(const ComponentCache&) = delete;
+  ComponentCache& operator=(const ComponentCache&) = delete;
+  ~ComponentCache() override = default;
+
+  /// Return the value cached for \a id (or null if there is none), marking it
+  /// as most recently used.
+  std::shared_ptr<ValueType> find(const smtk::common::UUID& id)
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto it = m_entries.find(id);
+    if (it == m_entries.end())
+    {
+      ++m_statistics.misses;
+      return std::shared_ptr<ValueType>();
+    }
+    ++m_statistics.hits;
+    m_order.splice(m_order.begin(), m_order, it->second.m_position);
+    return it->second.m_value;
+  }
+
+  /// Cache \a value for \a id, replacing any previous value.
+  void insert(const smtk::common::UUID& id, const std::shared_ptr<ValueType>& value)
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    this->insertLocked(id, value);
+  }
+
+  /// Return the value cached for \a id, calling \a compute() to construct it
+  /// if there is none. \a compute may return a ValueType or a shared pointer
+  /// to one. It is called without holding the cache's lock; if \a id is
+  /// invalidated while it runs, its result is returned but not cached.
+  template<typename Compute>
+  std::shared_ptr<ValueType> get(const smtk::common::UUID& id, const Compute& compute)
+  {
+    std::size_t generation;
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      auto it = m_entries.find(id);
+      if (it != m_entries.end())
+      {
+        ++m_statistics.hits;
+        m_order.splice(m_order.begin(), m_order, it->second.m_position);
+        return it->second.m_value;
+      }
+      ++m_statistics.misses;
+      generation = m_generation;
+    }
+
+    std::shared_ptr<ValueType> value = ComponentCache::share(compute());
+
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (generation == m_generation && value)
+    {
+      this->insertLocked(id, value);
+    }
+    return value;
+  }
+
+  /// Compute the value for \a id on \a executor (as get() would) so that it
+  /// is cached before it is needed. The cache (and thus its resource) must
+  /// outlive the returned future.
+  template<typename Compute>
+  std::future<void> precompute(
+    smtk::common::Executor& executor,
+    const smtk::common::UUID& id,
+    Compute compute)
+  {
+    return executor.submit(
+      [this, id, compute]() { this->get(id, compute); }, smtk::common::Executor::Priority::Batch);
+  }
+
+  /// Discard the value cached for \a id. Returns true if there was one.
+  bool erase(const smtk::common::UUID& id)
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    ++m_generation;
+    return this->eraseLocked(id);
+  }
+
+  /// Discard all cached values.
+  void clear()
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    ++m_generation;
+    m_entries.clear();
+    m_order.clear();
+    m_cost = 0;
+  }
+
+  /// Discard the values of components modified or expunged by an operation.
+  void synchronize(const Operation&, const Operation::Result& result) override
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    ++m_generation;
+    for (const auto& item : { result->findComponent("expunged"), result->findComponent("modified") })
+    {
+      for (std::size_t i = 0; item && i < item->numberOfValues(); ++i)
+      {
+        auto component = item->value(i);
+        if (component && this->eraseLocked(component->id()))
+        {
+          ++m_statistics.invalidations;
+        }
+      }
+    }
+  }
+
+  /// Set the maximum total cost of the cached values, evicting the least
+  /// recently used values as needed.
+  void setBudget(std::size_t budget)
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_budget = budget;
+    this->evict();
+  }
+  std::size_t budget() const
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_budget;
+  }
+
+  /// Set the function used to measure the cost (e.g., the memory footprint)
+  /// of each value. It applies to values cached subsequently.
+  void setCostFunction(const CostFunction& cost)
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_costFunction = cost;
+  }
+
+  /// Return the number of cached values.
+  std::size_t size() const
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_entries.size();
+  }
+
+  /// Return the total cost of the cached values.
+  std::size_t cost() const
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_cost;
+  }
+
+  Statistics statistics() const
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_statistics;
+  }
+
+  void resetStatistics()
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_statistics = Statistics();
+  }
+
+private:
+  struct Entry
+  {
+    std::shared_ptr<ValueType> m_value;
+    std::size_t m_cost;
+    typename std::list<smtk::common::UUID>::iterator m_position;
+  };
+
+  static std::shared_ptr<ValueType> share(std::shared_ptr<ValueType>&& value) { return value; }
+
+  template<typename Value>
+  static typename std::enable_if<
+    std::is_convertible<Value, ValueType>::value,
+    std::shared_ptr<ValueType>>::type
+  share(Value&& value)
+  {
+    return std::make_shared<ValueType>(std::forward<Value>(value));
+  }
+
+  void insertLocked(const smtk::common::UUID& id, const std::shared_ptr<ValueType>& value)
+  {
+    this->eraseLocked(id);
+    std::size_t cost = m_costFunction ? m_costFunction(*value) : 1;
+    m_order.push_front(id);
+    m_entries[id] = Entry{ value, cost, m_order.begin() };
+    m_cost += cost;
+    this->evict();
+  }
+
+  bool eraseLocked(const smtk::common::UUID& id)
+  {
+    auto it = m_entries.find(id);
+    if (it == m_entries.end())
+    {
+      return false;
+    }
+    m_cost -= it->second.m_cost;
+    m_order.erase(it->second.m_position);
+    m_entries.erase(it);
+    return true;
+  }
+
+  void evict()
+  {
+    while (m_cost > m_budget && !m_order.empty())
+    {
+      this->eraseLocked(m_order.back());
+      ++m_statistics.evictions;
+    }
+  }
+
+  std::unordered_map<smtk::common::UUID, Entry> m_entries;
+  // Cached ids, from most to least recently used.
+  std::list<smtk::common::UUID> m_order;
+  CostFunction m_costFunction;
+  std::size_t m_cost{ 0 };
+  std::size_t m_budget{ std::numeric_limits<std::size_t>::max() };
+  // Incremented whenever values are discarded so that values computed
+  // concurrently are not cached after their component has changed.
+  std::size_t m_generation{ 0 };
+  Statistics m_statistics;
+  mutable std::mutex m_mutex;
+};
+} // namespace operation
+} // namespace smtk
+
+#endif
@@ -0,0 +1,198 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/Resource.h"
+
+#include "smtk/operation/AttributePool.h"
+#include "smtk/operation/Manager.h"
+#include "smtk/operation/Metadata.h"
+#include "smtk/operation/Operation.h"
+#include "smtk/operation/XMLOperation.h"
+
+#include <set>
+#include <string>
+
+namespace
+{
+class MyOperation : public smtk::operation::XMLOperation
+{
+public:
+  smtkTypeMacro(MyOperation);
+  smtkCreateMacro(MyOperation);
+  smtkSharedFromThisMacro(smtk::operation::Operation);
+
+  MyOperation() = default;
+  ~MyOperation() override = default;
+
+  Result operateInternal() override;
+
+  const char* xmlDescription() const override;
+};
+
+MyOperation::Result MyOperation::operateInternal()
+{
+  auto result = this->createResult(Outcome::SUCCEEDED);
+  result->findInt("value")->setValue(this->parameters()->findInt("value")->value());
+  return result;
+}
+
+const char myOperationXML[] =
+  "<?xml version=\"1.0\" encoding=\"utf-8\" ?>"
+  "<SMTK_AttributeSystem Version=\"2\">"
+  "  <Definitions>"
+  "    <AttDef Type=\"operation\" Label=\"operation\" Abstract=\"True\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"debug level\" Optional=\"True\">"
+  "          <DefaultValue>0</DefaultValue>"
+  "        </Int>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"result\" Abstract=\"True\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"outcome\" Label=\"outcome\" Optional=\"False\" NumberOfRequiredValues=\"1\">"
+  "        </Int>"
+  "        <String Name=\"log\" Optional=\"True\" NumberOfRequiredValues=\"0\" Extensible=\"True\">"
+  "        </String>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"MyOperation\" Label=\"My Operation\" BaseType=\"operation\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"value\" Optional=\"False\">"
+  "          <DefaultValue>0</DefaultValue>"
+  "        </Int>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"result(MyOperation)\" BaseType=\"result\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"value\" Optional=\"False\">"
+  "          <DefaultValue>0</DefaultValue>"
+  "        </Int>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "  </Definitions>"
+  "</SMTK_AttributeSystem>";
+
+const char* MyOperation::xmlDescription() const
+{
+  return myOperationXML;
+}
+} // namespace
+
+int TestAttributePool(int /*unused*/, char** const /*unused*/)
+{
+  auto operationManager = smtk::operation::Manager::create();
+  operationManager->registerOperation<MyOperation>("MyOperation");
+
+  auto metadata =
+    operationManager->metadata().get<smtk::operation::NameTag>().find("MyOperation");
+  smtkTest(
+    metadata != operationManager->metadata().get<smtk::operation::NameTag>().end(),
+    "Could not find operation metadata.");
+  auto pool = metadata->attributePool();
+  auto specification = metadata->specification();
+  auto countAttributes = [&specification]() {
+    std::vector<smtk::attribute::AttributePtr> attributes;
+    specification->attributes(attributes);
+    return attributes.size();
+  };
+  std::size_t numberOfAttributes = 0;
+
+  std::weak_ptr<smtk::attribute::Attribute> firstParameters;
+  std::weak_ptr<smtk::attribute::Attribute> firstResult;
+  std::set<std::string> names;
+  for (int i = 1; i <= 100; ++i)
+  {
+    auto operation = operationManager->create<MyOperation>();
+    auto parameters = operation->parameters();
+    if (i == 1)
+    {
+      firstParameters = parameters;
+    }
+    else
+    {
+      // Every subsequent operation should reuse the first operation's
+      // attributes, reset to their default values.
+      smtkTest(parameters == firstParameters.lock(), "Parameters were not recycled.");
+      smtkTest(parameters->findInt("value")->value() == 0, "Recycled parameters were not reset.");
+      smtkTest(!parameters->isColorSet(), "Recycled parameters kept their color.");
+      smtkTest(
+        !parameters->properties().contains<int>("marker"),
+        "Recycled parameters kept their properties.");
+    }
+    smtkTest(names.insert(parameters->name()).second, "Recycled parameters kept their name.");
+    smtkTest(
+      specification->findAttribute(parameters->name()) == parameters,
+      "Parameters are not found by name.");
+    parameters->findInt("value")->setValue(i);
+    parameters->setColor(1., 0., 0., 1.);
+    parameters->properties().insert<int>("marker", i);
+
+    auto result = operation->operate();
+    smtkTest(result->findInt("value")->value() == i, "Unexpected result value.");
+    if (i == 1)
+    {
+      firstResult = result;
+      numberOfAttributes = countAttributes();
+    }
+    else
+    {
+      smtkTest(result == firstResult.lock(), "Result was not recycled.");
+    }
+    smtkTest(names.insert(result->name()).second, "Recycled result kept its name.");
+  }
+
+  smtkTest(pool->numberOfParameters() == 1, "Expected one pooled parameters attribute.");
+  smtkTest(pool->numberOfResults() == 1, "Expected one pooled result attribute.");
+  smtkTest(
+    countAttributes() == numberOfAttributes,
+    "Recycling operations should not change the number of attributes in the specification.");
+
+  // A result that is still referenced when its operation is destroyed must not
+  // be recycled.
+  smtk::operation::Operation::Result heldResult;
+  {
+    auto operation = operationManager->create<MyOperation>();
+    operation->parameters()->findInt("value")->setValue(42);
+    heldResult = operation->operate();
+  }
+  smtkTest(pool->numberOfResults() == 0, "A referenced result should not be pooled.");
+  smtkTest(heldResult->findInt("value")->value() == 42, "A referenced result was modified.");
+  {
+    auto operation = operationManager->create<MyOperation>();
+    auto result = operation->operate();
+    smtkTest(result != heldResult, "A referenced result was reused.");
+    smtkTest(result->findInt("value")->value() == 0, "Unexpected result value.");
+  }
+
+  // Parameters and results are recycled independently of one another, even
+  // when an operation creates several results.
+  {
+    auto operation = operationManager->create<MyOperation>();
+    operation->operate();
+    operation->operate();
+  }
+  smtkTest(pool->numberOfParameters() == 1, "Parameters were not pooled.");
+  smtkTest(pool->numberOfResults() == 2, "Both results should be pooled.");
+
+  // Operations beyond the pool's capacity remove their attributes.
+  pool->setCapacity(0);
+  smtkTest(pool->numberOfParameters() == 0, "Reducing capacity should empty the pool.");
+  {
+    auto operation = operationManager->create<MyOperation>();
+    operation->operate();
+  }
+  smtkTest(pool->numberOfParameters() == 0, "A full pool should not accept parameters.");
+
+  return 0;
+}
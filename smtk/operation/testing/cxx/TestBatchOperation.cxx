@@ -0,0 +1,351 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/common/UUID.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/ComponentItem.h"
+#include "smtk/attribute/FileItem.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/ReferenceItem.h"
+#include "smtk/attribute/Registrar.h"
+#include "smtk/attribute/Resource.h"
+#include "smtk/attribute/ResourceItem.h"
+#include "smtk/attribute/StringItem.h"
+
+#include "smtk/operation/Manager.h"
+#include "smtk/operation/Observer.h"
+#include "smtk/operation/Registrar.h"
+#include "smtk/operation/XMLOperation.h"
+#include "smtk/operation/operators/Batch.h"
+#include "smtk/operation/operators/ReadResource.h"
+#include "smtk/operation/operators/WriteResource.h"
+
+#include "smtk/plugin/Registry.h"
+
+#include "smtk/resource/Component.h"
+#include "smtk/resource/DerivedFrom.h"
+#include "smtk/resource/Manager.h"
+#include "smtk/resource/Resource.h"
+
+#include <vector>
+
+namespace
+{
+class MyResource : public smtk::resource::DerivedFrom<MyResource, smtk::resource::Resource>
+{
+public:
+  smtkTypeMacro(MyResource);
+  smtkCreateMacro(MyResource);
+  smtkSharedFromThisMacro(smtk::resource::PersistentObject);
+
+  smtk::resource::ComponentPtr find(const smtk::common::UUID& /*compId*/) const override
+  {
+    return smtk::resource::ComponentPtr();
+  }
+
+  std::function<bool(const smtk::resource::Component&)> queryOperation(
+    const std::string& /*unused*/) const override
+  {
+    return [](const smtk::resource::Component& /*unused*/) { return true; };
+  }
+
+  void visit(smtk::resource::Component::Visitor& /*v*/) const override {}
+
+protected:
+  MyResource() = default;
+};
+
+class MyComponent : public smtk::resource::Component
+{
+public:
+  smtkTypeMacro(MyComponent);
+  smtkCreateMacro(MyComponent);
+  smtkSharedFromThisMacro(smtk::resource::Component);
+
+  const smtk::common::UUID& id() const override { return m_id; }
+  bool setId(const smtk::common::UUID& anId) override
+  {
+    m_id = anId;
+    return true;
+  }
+
+  const smtk::resource::ResourcePtr resource() const override { return m_resource; }
+  void setResource(const smtk::resource::ResourcePtr& r) { m_resource = r; }
+
+private:
+  smtk::resource::ResourcePtr m_resource;
+  smtk::common::UUID m_id{ smtk::common::UUID::random() };
+};
+
+// Components created by EditOperation, addressed by index.
+std::vector<smtk::resource::ComponentPtr> g_components;
+
+// The batch that EditOperation cancels in mode 3.
+smtk::operation::Operation* g_batch = nullptr;
+
+// Create, modify or expunge a component of the associated resource.
+class EditOperation : public smtk::operation::XMLOperation
+{
+public:
+  smtkTypeMacro(EditOperation);
+  smtkCreateMacro(EditOperation);
+  smtkSharedFromThisMacro(smtk::operation::Operation);
+
+  EditOperation() = default;
+  ~EditOperation() override = default;
+
+  Result operateInternal() override;
+
+  const char* xmlDescription() const override;
+};
+
+EditOperation::Result EditOperation::operateInternal()
+{
+  auto resource = this->parameters()->associations()->valueAs<smtk::resource::Resource>();
+  int mode = this->parameters()->findInt("mode")->value();
+  int index = this->parameters()->findInt("index")->value();
+
+  // Operations in a batch are run under the batch's locks.
+  if (resource->locked() != smtk::resource::LockType::Write || mode < 0 || mode > 3)
+  {
+    return this->createResult(Outcome::FAILED);
+  }
+
+  // Cancel the running batch, which should cancel this operation.
+  if (mode == 3)
+  {
+    g_batch->cancel();
+    return this->createResult(this->reportProgress(0.5) ? Outcome::SUCCEEDED : Outcome::CANCELED);
+  }
+
+  auto result = this->createResult(Outcome::SUCCEEDED);
+  if (mode == 0)
+  {
+    auto component = MyComponent::create();
+    component->setResource(resource);
+    g_components.push_back(component);
+    result->findComponent("created")->appendValue(component);
+  }
+  else
+  {
+    result->findComponent(mode == 1 ? "modified" : "expunged")->appendValue(g_components[index]);
+  }
+  return result;
+}
+
+const char editOperationXML[] =
+  "<?xml version=\"1.0\" encoding=\"utf-8\" ?>"
+  "<SMTK_AttributeResource Version=\"3\">"
+  "  <Definitions>"
+  "    <AttDef Type=\"operation\" Label=\"operation\" Abstract=\"True\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"debug level\" Optional=\"True\">"
+  "          <DefaultValue>0</DefaultValue>"
+  "        </Int>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"result\" Abstract=\"True\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"outcome\" Label=\"outcome\" Optional=\"False\" NumberOfRequiredValues=\"1\">"
+  "        </Int>"
+  "        <String Name=\"log\" Optional=\"True\" NumberOfRequiredValues=\"0\" Extensible=\"True\">"
+  "        </String>"
+  "        <Component Name=\"created\" NumberOfRequiredValues=\"0\" Extensible=\"1\"/>"
+  "        <Component Name=\"modified\" NumberOfRequiredValues=\"0\" Extensible=\"1\"/>"
+  "        <Component Name=\"expunged\" NumberOfRequiredValues=\"0\" Extensible=\"1\"/>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"edit\" BaseType=\"operation\">"
+  "      <AssociationsDef LockType=\"Write\" NumberOfRequiredValues=\"1\" OnlyResources=\"true\">"
+  "        <Accepts><Resource Name=\"smtk::resource::Resource\"/></Accepts>"
+  "      </AssociationsDef>"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"mode\"><DefaultValue>0</DefaultValue></Int>"
+  "        <Int Name=\"index\"><DefaultValue>0</DefaultValue></Int>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"result(edit)\" BaseType=\"result\"/>"
+  "  </Definitions>"
+  "</SMTK_AttributeResource>";
+
+const char* EditOperation::xmlDescription() const
+{
+  return editOperationXML;
+}
+
+smtk::operation::Operation::Ptr edit(
+  const smtk::operation::Manager::Ptr& manager,
+  const smtk::resource::ResourcePtr& resource,
+  int mode,
+  int index = 0)
+{
+  auto operation = manager->create<EditOperation>();
+  operation->parameters()->associate(resource);
+  operation->parameters()->findInt("mode")->setValue(mode);
+  operation->parameters()->findInt("index")->setValue(index);
+  return operation;
+}
+
+// Resources read by a batch are reported in its result, so the operation
+// manager adds them to its resource manager.
+void testBatchedRead()
+{
+  auto resourceManager = smtk::resource::Manager::create();
+  auto operationManager = smtk::operation::Manager::create();
+  operationManager->registerResourceManager(resourceManager);
+  auto attributeRegistry = smtk::plugin::
+    Registry<smtk::attribute::Registrar, smtk::resource::Manager, smtk::operation::Manager>(
+      resourceManager, operationManager);
+  auto operationRegistry = smtk::plugin::
+    Registry<smtk::operation::Registrar, smtk::resource::Manager, smtk::operation::Manager>(
+      resourceManager, operationManager);
+
+  // Write an attribute resource that is not held by the resource manager.
+  auto original = smtk::attribute::Resource::create();
+  original->createDefinition("Def");
+  original->setLocation(std::string(SMTK_SCRATCH_DIR) + "/TestBatchOperation.smtk");
+  auto write = operationManager->create<smtk::operation::WriteResource>();
+  write->parameters()->associate(original);
+  smtkTest(
+    write->operate()->findInt("outcome")->value() ==
+      static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED),
+    "Could not write the attribute resource.");
+
+  auto read = operationManager->create<smtk::operation::ReadResource>();
+  read->parameters()->findFile("filename")->setValue(original->location());
+  auto batch = operationManager->create<smtk::operation::Batch>();
+  batch->append(read);
+  auto result = batch->operate();
+  smtkTest(
+    result->findInt("outcome")->value() ==
+      static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED),
+    "The batched read should succeed.");
+
+  auto resourceItem = result->findResource("resource");
+  smtkTest(resourceItem->numberOfValues() == 1, "Expected the batch to report 1 resource.");
+  auto resource = resourceItem->value();
+  smtkTest(
+    resource && resource != original && resource->id() == original->id(),
+    "Expected the batch to report the resource that was read.");
+  smtkTest(
+    resourceManager->get(original->id()) == resource,
+    "Expected the resource manager to hold the resource read by the batch.");
+
+  // The read's summary is logged and attached to its result.
+  smtkTest(
+    batch->results()[0]->findString("log")->numberOfValues() > 0,
+    "Expected the batched read's log to be attached to its result.");
+  smtkTest(
+    result->findString("log")->numberOfValues() > 0,
+    "Expected the batched read's log to be included in the batch's log.");
+}
+} // namespace
+
+int TestBatchOperation(int /*unused*/, char** const /*unused*/)
+{
+  auto operationManager = smtk::operation::Manager::create();
+  operationManager->registerOperation<EditOperation>("EditOperation");
+  operationManager->registerOperation<smtk::operation::Batch>("smtk::operation::Batch");
+
+  int willOperate = 0;
+  int didOperate = 0;
+  operationManager->observers()
+    .insert(
+      [&willOperate, &didOperate](
+        const smtk::operation::Operation& /*unused*/,
+        smtk::operation::EventType event,
+        smtk::operation::Operation::Result /*unused*/) {
+        ++(event == smtk::operation::EventType::WILL_OPERATE ? willOperate : didOperate);
+        return 0;
+      })
+    .release();
+
+  auto resource = MyResource::create();
+
+  // Create two components outside of a batch.
+  edit(operationManager, resource, 0)->operate();
+  edit(operationManager, resource, 0)->operate();
+  smtkTest(willOperate == 2 && didOperate == 2, "Expected one notification pair per operation.");
+
+  // Create components 2, 3 and 4, modify components 0 and 2, and expunge
+  // components 1 and 3.
+  auto batch = operationManager->create<smtk::operation::Batch>();
+  smtkTest(!batch->ableToOperate(), "An empty batch should not be able to operate.");
+  batch->append(edit(operationManager, resource, 0));
+  batch->append(edit(operationManager, resource, 0));
+  batch->append(edit(operationManager, resource, 0));
+  batch->append(edit(operationManager, resource, 1, 0));
+  batch->append(edit(operationManager, resource, 1, 2));
+  batch->append(edit(operationManager, resource, 2, 1));
+  batch->append(edit(operationManager, resource, 2, 3));
+  smtkTest(batch->ableToOperate(), "The batch should be able to operate.");
+
+  auto result = batch->operate();
+  smtkTest(
+    result->findInt("outcome")->value() ==
+      static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED),
+    "The batch should succeed.");
+  smtkTest(willOperate == 3 && didOperate == 3, "Expected one notification pair for the batch.");
+  smtkTest(result->findInt("operations")->value() == 7, "Expected 7 operations to run.");
+  smtkTest(batch->results().size() == 7, "Expected 7 operation results.");
+
+  // Component 3 was created and expunged by the batch, so it is not reported;
+  // component 2 was created and modified, so it is only reported as created.
+  auto created = result->findComponent("created");
+  auto modified = result->findComponent("modified");
+  auto expunged = result->findComponent("expunged");
+  smtkTest(created->numberOfValues() == 2, "Expected 2 created components.");
+  smtkTest(
+    created->value(0) == g_components[2] && created->value(1) == g_components[4],
+    "Unexpected created components.");
+  smtkTest(
+    modified->numberOfValues() == 1 && modified->value(0) == g_components[0],
+    "Unexpected modified components.");
+  smtkTest(
+    expunged->numberOfValues() == 1 && expunged->value(0) == g_components[1],
+    "Unexpected expunged components.");
+
+  // A batch stops at the first operation that does not succeed.
+  auto failing = operationManager->create<smtk::operation::Batch>();
+  failing->append(edit(operationManager, resource, 0));
+  failing->append(edit(operationManager, resource, -1));
+  failing->append(edit(operationManager, resource, 0));
+  result = failing->operate();
+  smtkTest(
+    result->findInt("outcome")->value() ==
+      static_cast<int>(smtk::operation::Operation::Outcome::FAILED),
+    "The batch should fail.");
+  smtkTest(failing->results().size() == 2, "The batch should stop at the failed operation.");
+  smtkTest(
+    result->findComponent("created")->numberOfValues() == 1, "Expected 1 created component.");
+
+  // Canceling a batch cancels the operation it is running.
+  auto canceled = operationManager->create<smtk::operation::Batch>();
+  auto canceling = edit(operationManager, resource, 3);
+  canceled->append(canceling);
+  canceled->append(edit(operationManager, resource, 0));
+  g_batch = canceled.get();
+  result = canceled->operate();
+  smtkTest(
+    result->findInt("outcome")->value() ==
+      static_cast<int>(smtk::operation::Operation::Outcome::CANCELED),
+    "The batch should be canceled.");
+  smtkTest(canceled->results().size() == 1, "The batch should stop at the canceled operation.");
+  smtkTest(
+    !canceling->isCanceled() && !canceled->isCanceled(),
+    "Cancellation requests should be cleared once operations finish.");
+
+  testBatchedRead();
+
+  return 0;
+}
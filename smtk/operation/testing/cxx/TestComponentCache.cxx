@@ -0,0 +1,239 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/common/Executor.h"
+#include "smtk/common/UUID.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/ComponentItem.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/ReferenceItem.h"
+
+#include "smtk/operation/Manager.h"
+#include "smtk/operation/XMLOperation.h"
+#include "smtk/operation/queries/ComponentCache.h"
+
+#include "smtk/resource/Component.h"
+#include "smtk/resource/DerivedFrom.h"
+#include "smtk/resource/Resource.h"
+
+#include <atomic>
+#include <limits>
+#include <vector>
+
+namespace
+{
+class MyResource : public smtk::resource::DerivedFrom<MyResource, smtk::resource::Resource>
+{
+public:
+  smtkTypeMacro(MyResource);
+  smtkCreateMacro(MyResource);
+  smtkSharedFromThisMacro(smtk::resource::PersistentObject);
+
+  smtk::resource::ComponentPtr find(const smtk::common::UUID& /*compId*/) const override
+  {
+    return smtk::resource::ComponentPtr();
+  }
+
+  std::function<bool(const smtk::resource::Component&)> queryOperation(
+    const std::string& /*unused*/) const override
+  {
+    return [](const smtk::resource::Component& /*unused*/) { return true; };
+  }
+
+  void visit(smtk::resource::Component::Visitor& /*v*/) const override {}
+
+protected:
+  MyResource() = default;
+};
+
+class MyComponent : public smtk::resource::Component
+{
+public:
+  smtkTypeMacro(MyComponent);
+  smtkCreateMacro(MyComponent);
+  smtkSharedFromThisMacro(smtk::resource::Component);
+
+  const smtk::common::UUID& id() const override { return m_id; }
+  bool setId(const smtk::common::UUID& anId) override
+  {
+    m_id = anId;
+    return true;
+  }
+
+  const smtk::resource::ResourcePtr resource() const override { return m_resource; }
+  void setResource(const smtk::resource::ResourcePtr& r) { m_resource = r; }
+
+private:
+  smtk::resource::ResourcePtr m_resource;
+  smtk::common::UUID m_id{ smtk::common::UUID::random() };
+};
+
+// The cached "query" is the square of an integer assigned to each component.
+struct SquareCache : public smtk::operation::ComponentCache<int>
+{
+};
+
+std::vector<smtk::resource::ComponentPtr> g_components;
+
+// Report a component as modified (mode 1) or expunged (mode 2).
+class EditOperation : public smtk::operation::XMLOperation
+{
+public:
+  smtkTypeMacro(EditOperation);
+  smtkCreateMacro(EditOperation);
+  smtkSharedFromThisMacro(smtk::operation::Operation);
+
+  EditOperation() = default;
+  ~EditOperation() override = default;
+
+  Result operateInternal() override
+  {
+    int mode = this->parameters()->findInt("mode")->value();
+    int index = this->parameters()->findInt("index")->value();
+    auto result = this->createResult(Outcome::SUCCEEDED);
+    result->findComponent(mode == 1 ? "modified" : "expunged")->appendValue(g_components[index]);
+    return result;
+  }
+
+  const char* xmlDescription() const override;
+};
+
+const char editOperationXML[] =
+  "<?xml version=\"1.0\" encoding=\"utf-8\" ?>"
+  "<SMTK_AttributeResource Version=\"3\">"
+  "  <Definitions>"
+  "    <AttDef Type=\"operation\" Label=\"operation\" Abstract=\"True\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"debug level\" Optional=\"True\">"
+  "          <DefaultValue>0</DefaultValue>"
+  "        </Int>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"result\" Abstract=\"True\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"outcome\" Label=\"outcome\" Optional=\"False\" NumberOfRequiredValues=\"1\">"
+  "        </Int>"
+  "        <String Name=\"log\" Optional=\"True\" NumberOfRequiredValues=\"0\" Extensible=\"True\">"
+  "        </String>"
+  "        <Component Name=\"created\" NumberOfRequiredValues=\"0\" Extensible=\"1\"/>"
+  "        <Component Name=\"modified\" NumberOfRequiredValues=\"0\" Extensible=\"1\"/>"
+  "        <Component Name=\"expunged\" NumberOfRequiredValues=\"0\" Extensible=\"1\"/>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"edit\" BaseType=\"operation\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"mode\"><DefaultValue>1</DefaultValue></Int>"
+  "        <Int Name=\"index\"><DefaultValue>0</DefaultValue></Int>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"result(edit)\" BaseType=\"result\"/>"
+  "  </Definitions>"
+  "</SMTK_AttributeResource>";
+
+const char* EditOperation::xmlDescription() const
+{
+  return editOperationXML;
+}
+
+void edit(const smtk::operation::Manager::Ptr& manager, int mode, int index)
+{
+  auto operation = manager->create<EditOperation>();
+  operation->parameters()->findInt("mode")->setValue(mode);
+  operation->parameters()->findInt("index")->setValue(index);
+  operation->operate();
+}
+} // namespace
+
+int TestComponentCache(int /*unused*/, char** const /*unused*/)
+{
+  auto resource = MyResource::create();
+  for (int i = 0; i < 4; ++i)
+  {
+    auto component = MyComponent::create();
+    component->setResource(resource);
+    g_components.push_back(component);
+  }
+  auto id = [](int index) { return g_components[index]->id(); };
+
+  SquareCache& cache = resource->queries().cache<SquareCache>();
+  std::atomic<int> computed(0);
+  auto square = [&computed](int value) {
+    return [&computed, value]() {
+      ++computed;
+      return value * value;
+    };
+  };
+
+  // Values are computed once and then served from the cache.
+  smtkTest(!cache.find(id(0)), "Unexpected value in an empty cache.");
+  smtkTest(*cache.get(id(0), square(2)) == 4, "Unexpected computed value.");
+  smtkTest(*cache.get(id(0), square(2)) == 4, "Unexpected cached value.");
+  smtkTest(computed == 1, "Cached value was recomputed.");
+  auto statistics = cache.statistics();
+  smtkTest(statistics.hits == 1 && statistics.misses == 2, "Unexpected hit/miss counts.");
+
+  // The least recently used values are evicted to remain within budget.
+  cache.get(id(1), square(3));
+  cache.get(id(2), square(4));
+  cache.find(id(0));
+  cache.setBudget(2);
+  smtkTest(cache.size() == 2 && !cache.find(id(1)), "Least recently used value not evicted.");
+  smtkTest(cache.find(id(0)) && cache.find(id(2)), "Recently used values evicted.");
+  smtkTest(cache.statistics().evictions == 1, "Unexpected eviction count.");
+
+  // Values may be weighted by a cost function.
+  cache.clear();
+  cache.setBudget(20);
+  cache.setCostFunction([](const int& value) { return static_cast<std::size_t>(value); });
+  cache.get(id(0), square(3));
+  cache.get(id(1), square(3));
+  smtkTest(cache.cost() == 18, "Unexpected total cost.");
+  cache.get(id(2), square(2));
+  smtkTest(cache.size() == 2 && cache.cost() == 13, "Costly value not evicted.");
+  cache.setCostFunction(nullptr);
+  cache.setBudget(std::numeric_limits<std::size_t>::max());
+
+  // A value computed while the cache is invalidated is not cached.
+  cache.clear();
+  auto value = cache.get(id(3), [&cache, &id]() {
+    cache.erase(id(0));
+    return 25;
+  });
+  smtkTest(*value == 25 && !cache.find(id(3)), "Value computed during invalidation was cached.");
+
+  // Operations that modify or expunge components invalidate their values.
+  auto operationManager = smtk::operation::Manager::create();
+  operationManager->registerOperation<EditOperation>("EditOperation");
+  for (int i = 0; i < 4; ++i)
+  {
+    cache.get(id(i), square(i));
+  }
+  cache.resetStatistics();
+  edit(operationManager, 1, 1);
+  edit(operationManager, 2, 2);
+  smtkTest(cache.size() == 2 && !cache.find(id(1)) && !cache.find(id(2)), "Values not invalidated.");
+  smtkTest(cache.statistics().invalidations == 2, "Unexpected invalidation count.");
+
+  // Values may be computed in the background before they are needed.
+  smtk::common::Executor executor(2);
+  std::vector<std::future<void>> futures;
+  futures.push_back(cache.precompute(executor, id(1), square(5)));
+  futures.push_back(cache.precompute(executor, id(2), square(6)));
+  executor.whenAll(futures);
+  computed = 0;
+  smtkTest(
+    *cache.get(id(1), square(0)) == 25 && *cache.get(id(2), square(0)) == 36 && computed == 0,
+    "Precomputed values not cached.");
+
+  return 0;
+}
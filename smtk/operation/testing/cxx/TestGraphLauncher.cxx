@@ -0,0 +1,214 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/IntItem.h"
+
+#include "smtk/operation/GraphLauncher.h"
+#include "smtk/operation/Manager.h"
+#include "smtk/operation/XMLOperation.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+std::atomic<int> g_running{ 0 };
+std::atomic<int> g_maxRunning{ 0 };
+
+// Add the operation's "increment" to its "value" and report the sum. A
+// negative value causes the operation to fail.
+class AddOperation : public smtk::operation::XMLOperation
+{
+public:
+  smtkTypeMacro(AddOperation);
+  smtkCreateMacro(AddOperation);
+  smtkSharedFromThisMacro(smtk::operation::Operation);
+
+  AddOperation() = default;
+  ~AddOperation() override = default;
+
+  Result operateInternal() override;
+
+  const char* xmlDescription() const override;
+};
+
+AddOperation::Result AddOperation::operateInternal()
+{
+  int running = ++g_running;
+  int maxRunning = g_maxRunning.load();
+  while (running > maxRunning && !g_maxRunning.compare_exchange_weak(maxRunning, running))
+  {
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  --g_running;
+
+  int value = this->parameters()->findInt("value")->value();
+  if (value < 0)
+  {
+    return this->createResult(Outcome::FAILED);
+  }
+
+  auto result = this->createResult(Outcome::SUCCEEDED);
+  result->findInt("value")->setValue(value + this->parameters()->findInt("increment")->value());
+  return result;
+}
+
+const char addOperationXML[] =
+  "<?xml version=\"1.0\" encoding=\"utf-8\" ?>"
+  "<SMTK_AttributeSystem Version=\"2\">"
+  "  <Definitions>"
+  "    <AttDef Type=\"operation\" Label=\"operation\" Abstract=\"True\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"debug level\" Optional=\"True\">"
+  "          <DefaultValue>0</DefaultValue>"
+  "        </Int>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"result\" Abstract=\"True\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"outcome\" Label=\"outcome\" Optional=\"False\" NumberOfRequiredValues=\"1\">"
+  "        </Int>"
+  "        <String Name=\"log\" Optional=\"True\" NumberOfRequiredValues=\"0\" Extensible=\"True\">"
+  "        </String>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"AddOperation\" BaseType=\"operation\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"value\"><DefaultValue>0</DefaultValue></Int>"
+  "        <Int Name=\"increment\"><DefaultValue>1</DefaultValue></Int>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"result(AddOperation)\" BaseType=\"result\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"value\"><DefaultValue>0</DefaultValue></Int>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "  </Definitions>"
+  "</SMTK_AttributeSystem>";
+
+const char* AddOperation::xmlDescription() const
+{
+  return addOperationXML;
+}
+
+int valueOf(const smtk::operation::GraphLauncher& graph, smtk::operation::GraphLauncher::Node node)
+{
+  return graph.result(node).get()->findInt("value")->value();
+}
+} // namespace
+
+int TestGraphLauncher(int /*unused*/, char** const /*unused*/)
+{
+  using smtk::operation::GraphLauncher;
+
+  auto operationManager = smtk::operation::Manager::create();
+  operationManager->registerOperation<AddOperation>("AddOperation");
+
+  // A diamond: two independent branches feed a final node.
+  {
+    GraphLauncher graph;
+    auto source = graph.add(operationManager->create<AddOperation>());
+    auto left = graph.add(operationManager->create<AddOperation>());
+    auto right = graph.add(operationManager->create<AddOperation>());
+    auto sink = graph.add(operationManager->create<AddOperation>());
+    graph.operation(left)->parameters()->findInt("increment")->setValue(10);
+    graph.operation(right)->parameters()->findInt("increment")->setValue(100);
+
+    smtkTest(graph.connect(source, left, "value", "value"), "Could not connect source to left.");
+    smtkTest(graph.connect(source, right, "value", "value"), "Could not connect source to right.");
+    smtkTest(graph.connect(left, sink, "value", "value"), "Could not connect left to sink.");
+    smtkTest(
+      graph.connect(
+        right,
+        sink,
+        [](
+          const smtk::operation::Operation::Result& result,
+          const smtk::operation::Operation::Parameters& parameters) {
+          return parameters->findInt("increment")->setValue(result->findInt("value")->value());
+        }),
+      "Could not connect right to sink.");
+    smtkTest(!graph.connect(sink, source), "A cycle should be rejected.");
+
+    std::atomic<int> events{ 0 };
+    graph.setObserver([&events](GraphLauncher::Node, GraphLauncher::State) { ++events; });
+
+    g_maxRunning = 0;
+    bool succeeded = graph.launch().get();
+    smtkTest(succeeded, "The graph should succeed.");
+    smtkTest(valueOf(graph, source) == 1, "Unexpected source value.");
+    smtkTest(valueOf(graph, left) == 11, "Unexpected left value.");
+    smtkTest(valueOf(graph, right) == 101, "Unexpected right value.");
+    smtkTest(valueOf(graph, sink) == 112, "Unexpected sink value " << valueOf(graph, sink) << ".");
+    smtkTest(events == 8, "Each node should report running and finishing.");
+    smtkTest(graph.progress() == 1., "The graph should be complete.");
+    smtkTest(
+      g_maxRunning.load() >= 2 || std::thread::hardware_concurrency() < 2,
+      "Independent branches should run concurrently.");
+  }
+
+  // A failure skips downstream nodes but not independent ones.
+  {
+    GraphLauncher graph;
+    auto failing = graph.add(operationManager->create<AddOperation>());
+    auto downstream = graph.add(operationManager->create<AddOperation>());
+    auto independent = graph.add(operationManager->create<AddOperation>());
+    graph.operation(failing)->parameters()->findInt("value")->setValue(-1);
+    graph.connect(failing, downstream);
+
+    smtkTest(!graph.launch().get(), "The graph should not succeed.");
+    smtkTest(graph.state(failing) == GraphLauncher::State::Failed, "Node should fail.");
+    smtkTest(graph.state(downstream) == GraphLauncher::State::Skipped, "Node should be skipped.");
+    smtkTest(graph.state(independent) == GraphLauncher::State::Succeeded, "Node should succeed.");
+  }
+
+  // A failed transfer fails the downstream node without enabling its item.
+  {
+    GraphLauncher graph;
+    auto upstream = graph.add(operationManager->create<AddOperation>());
+    auto downstream = graph.add(operationManager->create<AddOperation>());
+    graph.connect(upstream, downstream, "log", "debug level");
+
+    smtkTest(!graph.launch().get(), "The graph should not succeed.");
+    smtkTest(graph.state(upstream) == GraphLauncher::State::Succeeded, "Node should succeed.");
+    smtkTest(graph.state(downstream) == GraphLauncher::State::Failed, "Node should fail.");
+    smtkTest(
+      !graph.operation(downstream)->parameters()->findInt("debug level")->isEnabled(),
+      "A failed transfer should not enable its destination.");
+  }
+
+  // Canceling a graph before it runs cancels every node.
+  {
+    auto executor = std::make_shared<smtk::common::Executor>(1);
+    GraphLauncher graph(executor);
+    auto first = graph.add(operationManager->create<AddOperation>());
+    auto second = graph.add(operationManager->create<AddOperation>());
+    graph.connect(first, second);
+
+    // Occupy the only worker so that the graph cannot start before it is
+    // canceled.
+    std::promise<void> gate;
+    std::shared_future<void> opened = gate.get_future().share();
+    executor->submit([opened]() { opened.wait(); });
+
+    auto finished = graph.launch();
+    graph.cancel();
+    gate.set_value();
+
+    smtkTest(!finished.get(), "A canceled graph should not succeed.");
+    smtkTest(graph.state(first) == GraphLauncher::State::Canceled, "Node should be canceled.");
+    smtkTest(graph.state(second) == GraphLauncher::State::Skipped, "Node should be skipped.");
+  }
+
+  return 0;
+}
@@ -0,0 +1,159 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/IntItem.h"
+
+#include "smtk/operation/Launcher.h"
+#include "smtk/operation/Manager.h"
+#include "smtk/operation/XMLOperation.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+// Perform "steps" steps of 10 ms each, reporting progress after each one.
+class LongOperation : public smtk::operation::XMLOperation
+{
+public:
+  smtkTypeMacro(LongOperation);
+  smtkCreateMacro(LongOperation);
+  smtkSharedFromThisMacro(smtk::operation::Operation);
+
+  LongOperation() = default;
+  ~LongOperation() override = default;
+
+  Result operateInternal() override;
+
+  const char* xmlDescription() const override;
+
+  std::atomic<int> m_completedSteps{ 0 };
+};
+
+LongOperation::Result LongOperation::operateInternal()
+{
+  m_completedSteps = 0;
+  int steps = this->parameters()->findInt("steps")->value();
+  for (int i = 0; i < steps; ++i)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ++m_completedSteps;
+    if (!this->reportProgress(static_cast<double>(i + 1) / steps, "step"))
+    {
+      return this->createResult(Outcome::CANCELED);
+    }
+  }
+  return this->createResult(Outcome::SUCCEEDED);
+}
+
+const char longOperationXML[] =
+  "<?xml version=\"1.0\" encoding=\"utf-8\" ?>"
+  "<SMTK_AttributeSystem Version=\"2\">"
+  "  <Definitions>"
+  "    <AttDef Type=\"operation\" Label=\"operation\" Abstract=\"True\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"debug level\" Optional=\"True\">"
+  "          <DefaultValue>0</DefaultValue>"
+  "        </Int>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"result\" Abstract=\"True\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"outcome\" Label=\"outcome\" Optional=\"False\" NumberOfRequiredValues=\"1\">"
+  "        </Int>"
+  "        <String Name=\"log\" Optional=\"True\" NumberOfRequiredValues=\"0\" Extensible=\"True\">"
+  "        </String>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"LongOperation\" BaseType=\"operation\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"steps\"><DefaultValue>50</DefaultValue></Int>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"result(LongOperation)\" BaseType=\"result\">"
+  "    </AttDef>"
+  "  </Definitions>"
+  "</SMTK_AttributeSystem>";
+
+const char* LongOperation::xmlDescription() const
+{
+  return longOperationXML;
+}
+
+smtk::operation::Operation::Outcome outcomeOf(const smtk::operation::Operation::Result& result)
+{
+  return smtk::operation::Operation::Outcome(result->findInt("outcome")->value());
+}
+} // namespace
+
+int TestOperationProgress(int /*unused*/, char** const /*unused*/)
+{
+  using Outcome = smtk::operation::Operation::Outcome;
+
+  auto operationManager = smtk::operation::Manager::create();
+  operationManager->registerOperation<LongOperation>("LongOperation");
+
+  // Progress is reported to the observer, throttled, and ends at 1.
+  {
+    auto operation = operationManager->create<LongOperation>();
+    std::atomic<int> reports{ 0 };
+    double last = 0.;
+    operation->setProgressObserver([&reports, &last](double fraction, const std::string&) {
+      ++reports;
+      last = fraction;
+    });
+
+    auto result = operation->operate();
+    smtkTest(outcomeOf(result) == Outcome::SUCCEEDED, "Operation should succeed.");
+    smtkTest(last == 1., "The final report should be complete.");
+    smtkTest(operation->progress() == 1., "Operation progress should be complete.");
+    smtkTest(
+      reports > 0 && reports < 50, "Reports should be throttled (" << reports << " reports).");
+  }
+
+  // A running operation stops when canceled.
+  {
+    auto operation = operationManager->create<LongOperation>();
+    operation->parameters()->findInt("steps")->setValue(1000);
+    auto result = operationManager->launchers()(operation);
+    while (operation->progress() < 0.01)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    operation->cancel();
+
+    smtkTest(outcomeOf(result.get()) == Outcome::CANCELED, "Operation should be canceled.");
+    smtkTest(
+      std::static_pointer_cast<LongOperation>(operation)->m_completedSteps < 1000,
+      "Operation should stop early.");
+    smtkTest(!operation->isCanceled(), "Cancellation should be cleared once operate returns.");
+
+    // The operation may be run again after being canceled.
+    operation->parameters()->findInt("steps")->setValue(1);
+    smtkTest(outcomeOf(operation->operate()) == Outcome::SUCCEEDED, "Operation should succeed.");
+  }
+
+  // An operation canceled before it starts does not run.
+  {
+    auto operation = operationManager->create<LongOperation>();
+    operation->cancel();
+    auto result = operation->operate();
+    smtkTest(outcomeOf(result) == Outcome::CANCELED, "Operation should be canceled.");
+    smtkTest(
+      std::static_pointer_cast<LongOperation>(operation)->m_completedSteps == 0,
+      "Operation should not run.");
+  }
+
+  return 0;
+}
@@ -16,6 +16,9 @@
 #include "smtk/attribute/Attribute.h"
 #include "smtk/attribute/IntItem.h"
 #include "smtk/attribute/Resource.h"
+#include "smtk/attribute/StringItem.h"
+
+#include "smtk/common/Executor.h"
 
 #include "smtk/io/AttributeReader.h"
 #include "smtk/io/Logger.h"
@@ -42,11 +45,23 @@ public:
 
   bool ableToOperate() override { return m_outcome != Outcome::UNABLE_TO_OPERATE; }
 
-  Result operateInternal() override { return this->createResult(m_outcome); }
+  Result operateInternal() override
+  {
+    if (m_logFromWorker)
+    {
+      // Log from a task run by a worker thread rather than the calling thread.
+      smtk::io::Logger& logger = this->log();
+      smtk::common::Executor::instance()
+        ->submit([&logger]() { smtkInfoMacro(logger, "logged from a worker"); })
+        .get();
+    }
+    return this->createResult(m_outcome);
+  }
 
   const char* xmlDescription() const override;
 
   Outcome m_outcome{ Outcome::SUCCEEDED };
+  bool m_logFromWorker{ false };
 };
 
 const char testOpXML[] =
@@ -193,5 +208,14 @@ int unitOperation(int /*unused*/, char* /*unused*/[])
                    " expected "
                 << (sizeof(expectedObservations) / sizeof(expectedObservations[0])));
 
+  // Records logged by executor tasks the operation submits belong in its result.
+  testOp->m_logFromWorker = true;
+  result = testOp->operate();
+  auto logItem = result->findString("log");
+  smtkTest(
+    logItem->numberOfValues() == 1 &&
+      logItem->value(0).find("logged from a worker") != std::string::npos,
+    "Records logged from a worker are missing from the result.");
+
   return 0;
 }
@@ -13,6 +13,10 @@
 
 #include "smtk/resource/Manager.h"
 
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace smtk
 {
 namespace project
@@ -36,10 +40,17 @@ void from_json(const json& j, ResourceContainer& resourceContainer)
     return;
   }
 
+  // Resources are stored in separate files, so read them concurrently and
+  // then add them to the project in the order they are listed.
+  std::vector<std::pair<std::string, std::string>> requests;
   for (json::const_iterator it = j["resources"].begin(); it != j["resources"].end(); ++it)
   {
-    smtk::resource::ResourcePtr resource =
-      manager->read(it->at("type").get<std::string>(), it->at("location").get<std::string>());
+    requests.emplace_back(
+      it->at("type").get<std::string>(), it->at("location").get<std::string>());
+  }
+
+  for (const auto& resource : manager->read(requests))
+  {
     if (!resource)
     {
       continue;
@@ -21,6 +21,8 @@
 #include "smtk/attribute/StringItem.h"
 #include "smtk/attribute/StringItemDefinition.h"
 
+#include "smtk/common/json/jsonBinary.h"
+
 #include "smtk/io/Logger.h"
 
 #include "smtk/operation/operators/ReadResource.h"
@@ -61,7 +63,7 @@ Read::Result Read::operateInternal()
 {
   std::string filename = this->parameters()->findFile("filename")->value();
 
-  std::ifstream file(filename);
+  std::ifstream file(filename, std::ios::in | std::ios::binary);
   if (!file.good())
   {
     smtkErrorMacro(log(), "Cannot read file \"" << filename << "\".");
@@ -72,7 +74,7 @@ Read::Result Read::operateInternal()
   nlohmann::json j;
   try
   {
-    j = nlohmann::json::parse(file);
+    j = smtk::common::BinaryJSON::parse(file);
   }
   catch (...)
   {
@@ -21,6 +21,9 @@
 #include "smtk/attribute/StringItem.h"
 #include "smtk/attribute/StringItemDefinition.h"
 
+#include "smtk/common/Executor.h"
+#include "smtk/common/json/jsonBinary.h"
+
 #include "smtk/io/Logger.h"
 
 #include "smtk/operation/operators/WriteResource.h"
@@ -29,9 +32,12 @@
 
 #include "smtk/project/json/jsonProject.h"
 
+#include "smtk/resource/LockSet.h"
+
 #include "smtk/project/Write_xml.h"
 
 #include <iostream>
+#include <vector>
 
 SMTK_THIRDPARTY_PRE_INCLUDE
 #include "boost/filesystem.hpp"
@@ -61,15 +67,6 @@ Write::Result Write::operateInternal()
   boost::filesystem::path projectFolderPath = outputFilePath.parent_path();
   boost::filesystem::path resourcesFolderPath = projectFolderPath / "resources";
 
-  // Construct a WriteResource operation to write all of the project's resources.
-  smtk::operation::WriteResource::Ptr write =
-    project->operations().manager()->create<smtk::operation::WriteResource>();
-  if (!write)
-  {
-    smtkErrorMacro(this->log(), "Cannot create WriteResource operation.");
-    return this->createResult(smtk::operation::Operation::Outcome::FAILED);
-  }
-
   // Create project and project/resources folders if needed
   if (!boost::filesystem::exists(resourcesFolderPath))
   {
@@ -88,33 +85,80 @@ Write::Result Write::operateInternal()
     return this->createResult(smtk::operation::Operation::Outcome::FAILED);
   }
 
-  // Write the modified resources.
+  // Gather the modified resources, assigning a location within the project's
+  // resources folder to those that do not have one.
+  std::vector<smtk::resource::ResourcePtr> modified;
   for (const auto& resource : project->resources())
   {
-    const std::string& role = detail::role(resource);
-
     if (!resource->clean())
     {
-      // Reset the write operation's associations.
-      write->parameters()->associations()->reset();
-
       if (resource->location().empty())
       {
+        const std::string& role = detail::role(resource);
         std::string filename = role + "-" + resource->id().toString() + ".smtk";
         boost::filesystem::path location = resourcesFolderPath / filename;
         resource->setLocation(location.string());
       }
+      modified.push_back(resource);
+    }
+  }
 
-      write->parameters()->associate(resource);
-      smtk::operation::Operation::Result writeResult = write->operate();
-      if (
-        writeResult->findInt("outcome")->value() !=
-        static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED))
+  // Construct a WriteResource operation for each modified resource and hold
+  // a read lock on each resource while they are written.
+  std::vector<smtk::operation::WriteResource::Ptr> writers;
+  smtk::resource::LockSet resourceLocks;
+  for (const auto& resource : modified)
+  {
+    smtk::operation::WriteResource::Ptr write =
+      project->operations().manager()->create<smtk::operation::WriteResource>();
+    if (!write)
+    {
+      smtkErrorMacro(this->log(), "Cannot create WriteResource operation.");
+      return this->createResult(smtk::operation::Operation::Outcome::FAILED);
+    }
+    write->parameters()->associate(resource);
+    if (!write->ableToOperate())
+    {
+      smtkErrorMacro(this->log(), "Cannot write resource \"" << resource->name() << "\".");
+      return this->createResult(smtk::operation::Operation::Outcome::FAILED);
+    }
+    resourceLocks.insert(resource, smtk::resource::LockType::Read);
+    writers.push_back(write);
+  }
+  resourceLocks.lock();
+
+  // Each resource is written to its own file, so write them concurrently.
+  // The writers are run without invoking the operation manager's observers,
+  // which expect to be called serially; their outcomes are reported below.
+  std::vector<int> outcomes(writers.size());
+  smtk::common::Executor::instance()->parallelFor(
+    0, writers.size(), 1, [&](std::size_t first, std::size_t last) {
+      for (std::size_t ii = first; ii < last; ++ii)
       {
-        // An error message should already enter the logger from the local operation.
-        return this->createResult(smtk::operation::Operation::Outcome::FAILED);
+        outcomes[ii] = writers[ii]->operate(Key())->findInt("outcome")->value();
       }
+    });
+  resourceLocks.unlock();
+
+  bool succeeded = true;
+  for (std::size_t ii = 0; ii < writers.size(); ++ii)
+  {
+    if (outcomes[ii] == static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED))
+    {
+      // Mark the resource as unmodified from its persistent state, as
+      // WriteResource does when run through its public API.
+      modified[ii]->setClean(true);
     }
+    else
+    {
+      smtkErrorMacro(
+        this->log(), "Failed to write resource \"" << modified[ii]->name() << "\".");
+      succeeded = false;
+    }
+  }
+  if (!succeeded)
+  {
+    return this->createResult(smtk::operation::Operation::Outcome::FAILED);
   }
 
   // We now write the project's smtk file.
@@ -126,9 +170,9 @@ Write::Result Write::operateInternal()
       return this->createResult(smtk::operation::Operation::Outcome::FAILED);
     }
 
-    std::string fileContents = j.dump(2);
-    std::ofstream file(outputFile);
-    file << fileContents;
+    std::ofstream file(outputFile, std::ios::out | std::ios::binary);
+    smtk::common::BinaryJSON::dump(
+      j, file, smtk::common::BinaryJSON::isBinaryLocation(outputFile));
     file.close();
   }
 
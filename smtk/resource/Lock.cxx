@@ -7,8 +7,33 @@
 //  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
 //  PURPOSE.  See the above copyright notice for more information.
 //=========================================================================
+
 #include "smtk/resource/Lock.h"
 
+namespace
+{
+// Layout of the lock's state word. The low bits count active readers.
+constexpr std::uint32_t Writer = 1u << 31;
+constexpr std::uint32_t WriterPending = 1u << 30;
+constexpr std::uint32_t Upgrading = 1u << 29;
+constexpr std::uint32_t ReaderMask = Upgrading - 1;
+
+template<typename Acquire>
+bool waitUntil(
+  std::condition_variable& condition,
+  std::unique_lock<std::mutex>& lock,
+  const std::chrono::steady_clock::time_point* deadline,
+  Acquire acquire)
+{
+  if (deadline)
+  {
+    return condition.wait_until(lock, *deadline, acquire);
+  }
+  condition.wait(lock, acquire);
+  return true;
+}
+} // namespace
+
 namespace smtk
 {
 namespace resource
@@ -16,44 +41,127 @@ namespace resource
 
 Lock::Lock() = default;
 
-void Lock::lock(LockType lockType)
+bool Lock::tryAcquireRead()
 {
-  if (lockType == LockType::Read)
+  const std::uint32_t blocking = Writer | Upgrading |
+    (m_policy.load() == Policy::WriterPreferred ? WriterPending : 0);
+  std::uint32_t state = m_state.load();
+  while ((state & blocking) == 0)
   {
-    // Lock the resource.
-    std::unique_lock<std::mutex> lk(m_mutex);
-
-    // Wait for writers to finish.
-    while (m_waitingWriters != 0)
+    if (m_state.compare_exchange_weak(state, state + 1))
     {
-      m_readerCondition.wait(lk);
+      return true;
     }
+  }
+  return false;
+}
 
-    // Declare yourself as a reader.
-    ++m_activeReaders;
+bool Lock::tryAcquireWrite()
+{
+  std::uint32_t state = m_state.load();
+  while ((state & (Writer | Upgrading | ReaderMask)) == 0)
+  {
+    if (m_state.compare_exchange_weak(state, state | Writer))
+    {
+      return true;
+    }
+  }
+  return false;
+}
 
-    // Unlock the resource.
-    lk.unlock();
+bool Lock::tryCompleteUpgrade()
+{
+  // The upgrading thread holds one reader share; it may become the writer once
+  // it is the only reader.
+  std::uint32_t state = m_state.load();
+  while ((state & ReaderMask) == 1 && (state & Writer) == 0)
+  {
+    if (m_state.compare_exchange_weak(state, (state & WriterPending) | Writer))
+    {
+      return true;
+    }
   }
-  else if (lockType == LockType::Write)
+  return false;
+}
+
+void Lock::wake()
+{
+  // Waiters register themselves under the mutex before re-checking the state,
+  // so acquiring the mutex here guarantees they are either waiting (and will
+  // be notified) or will observe the new state.
+  if (m_waiters.load() > 0)
   {
-    // Lock the resource.
-    std::unique_lock<std::mutex> lk(m_mutex);
+    {
+      std::lock_guard<std::mutex> lk(m_mutex);
+    }
+    m_condition.notify_all();
+  }
+}
 
-    // Declare yourself as a waiting writier.
-    ++m_waitingWriters;
+bool Lock::acquire(LockType lockType, const std::chrono::steady_clock::time_point* deadline)
+{
+  auto start = std::chrono::steady_clock::now();
+  bool acquired = false;
 
-    // Wait for active readers and active writers to finish.
-    while (m_activeReaders != 0 || m_activeWriters != 0)
+  std::unique_lock<std::mutex> lk(m_mutex);
+  ++m_waiters;
+  if (lockType == LockType::Read)
+  {
+    acquired = waitUntil(m_condition, lk, deadline, [this] { return this->tryAcquireRead(); });
+  }
+  else
+  {
+    // Announce ourselves as a waiting writer so that (under the
+    // writer-preferred policy) new readers defer to us.
+    if (++m_waitingWriters == 1)
     {
-      m_writerCondition.wait(lk);
+      m_state.fetch_or(WriterPending);
     }
+    acquired = waitUntil(m_condition, lk, deadline, [this] { return this->tryAcquireWrite(); });
+    if (--m_waitingWriters == 0)
+    {
+      m_state.fetch_and(~WriterPending);
+      if (!acquired)
+      {
+        // Readers that deferred to us may now proceed.
+        m_condition.notify_all();
+      }
+    }
+  }
+  --m_waiters;
+  lk.unlock();
 
-    // Declare yourself as an active writer.
-    ++m_activeWriters;
+  auto waited =
+    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start)
+      .count();
+  if (lockType == LockType::Read)
+  {
+    ++m_contendedReads;
+    m_readWaitTime += waited;
+  }
+  else
+  {
+    ++m_contendedWrites;
+    m_writeWaitTime += waited;
+  }
+  return acquired;
+}
 
-    // Unlock the resource.
-    lk.unlock();
+void Lock::lock(LockType lockType)
+{
+  if (lockType == LockType::Read)
+  {
+    if (!this->tryAcquireRead())
+    {
+      this->acquire(lockType, nullptr);
+    }
+  }
+  else if (lockType == LockType::Write)
+  {
+    if (!this->tryAcquireWrite())
+    {
+      this->acquire(lockType, nullptr);
+    }
   }
 }
 
@@ -61,51 +169,124 @@ void Lock::unlock(LockType lockType)
 {
   if (lockType == LockType::Read)
   {
-    // Lock the resource.
-    std::unique_lock<std::mutex> lk(m_mutex);
-
-    // Remove yourself as an active reader.
-    --m_activeReaders;
-
-    // Unlock the resource.
-    lk.unlock();
+    m_state.fetch_sub(1);
+    this->wake();
+  }
+  else if (lockType == LockType::Write)
+  {
+    m_state.fetch_and(~Writer);
+    this->wake();
+  }
+}
 
-    // Tell one of the waiting writers to check if it can write.
-    m_writerCondition.notify_one();
+bool Lock::tryLock(LockType lockType)
+{
+  if (lockType == LockType::Read)
+  {
+    return this->tryAcquireRead();
   }
   else if (lockType == LockType::Write)
   {
-    // Lock the resource.
-    std::unique_lock<std::mutex> lk(m_mutex);
+    return this->tryAcquireWrite();
+  }
+  return true;
+}
 
-    // Remove yourself as a waiting writer.
-    --m_waitingWriters;
+bool Lock::tryLockFor(LockType lockType, std::chrono::milliseconds timeout)
+{
+  if (this->tryLock(lockType))
+  {
+    return true;
+  }
+  auto deadline = std::chrono::steady_clock::now() + timeout;
+  return this->acquire(lockType, &deadline);
+}
 
-    // Remove yourself as an active writer.
-    --m_activeWriters;
+bool Lock::upgrade(std::chrono::milliseconds timeout)
+{
+  // Two readers waiting on each other to upgrade would never make progress,
+  // so only one may try at a time.
+  if (m_state.fetch_or(Upgrading) & Upgrading)
+  {
+    return false;
+  }
 
-    if (m_waitingWriters > 0)
-    {
-      // If there are writers waiting to write, tell one of them to check if it
-      // can write.
-      m_writerCondition.notify_one();
-    }
-    else
+  if (!this->tryCompleteUpgrade())
+  {
+    auto start = std::chrono::steady_clock::now();
+    auto deadline = start + timeout;
+
+    std::unique_lock<std::mutex> lk(m_mutex);
+    ++m_waiters;
+    bool acquired = waitUntil(
+      m_condition, lk, timeout.count() < 0 ? nullptr : &deadline, [this] {
+        return this->tryCompleteUpgrade();
+      });
+    --m_waiters;
+    if (!acquired)
     {
-      // Otherwise, tell all readers that they can read.
-      m_readerCondition.notify_all();
+      // Withdraw the upgrade and admit anyone who deferred to it.
+      m_state.fetch_and(~Upgrading);
+      m_condition.notify_all();
+      return false;
     }
-
-    // Unlock the resource.
     lk.unlock();
+
+    ++m_contendedWrites;
+    m_writeWaitTime +=
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start)
+        .count();
+  }
+  ++m_upgrades;
+  return true;
+}
+
+void Lock::downgrade()
+{
+  std::uint32_t state = m_state.load();
+  while (!m_state.compare_exchange_weak(state, (state & ~Writer) + 1))
+  {
   }
+  this->wake();
 }
 
 smtk::resource::LockType Lock::state() const
 {
+  std::uint32_t state = m_state.load();
   return (
-    m_activeWriters > 0 ? LockType::Write
-                        : (m_activeReaders > 0 ? LockType::Read : LockType::Unlocked));
+    (state & Writer) ? LockType::Write
+                     : ((state & ReaderMask) > 0 ? LockType::Read : LockType::Unlocked));
+}
+
+void Lock::setPolicy(Policy policy)
+{
+  m_policy = policy;
+  // Readers blocked by a pending writer may be admitted under the new policy.
+  this->wake();
+}
+
+Lock::Statistics Lock::statistics() const
+{
+  std::uint32_t state = m_state.load();
+  Statistics result;
+  result.contendedReads = m_contendedReads.load();
+  result.contendedWrites = m_contendedWrites.load();
+  result.upgrades = m_upgrades.load();
+  result.readWaitTime = std::chrono::nanoseconds(m_readWaitTime.load());
+  result.writeWaitTime = std::chrono::nanoseconds(m_writeWaitTime.load());
+  result.activeReaders = state & ReaderMask;
+  result.activeWriter = (state & Writer) != 0;
+  result.pendingWriter = (state & WriterPending) != 0;
+  return result;
+}
+
+void Lock::resetStatistics()
+{
+  m_contendedReads = 0;
+  m_contendedWrites = 0;
+  m_upgrades = 0;
+  m_readWaitTime = 0;
+  m_writeWaitTime = 0;
 }
 
 ScopedLockGuard::ScopedLockGuard(Lock& lock, LockType lockType)
@@ -120,5 +301,19 @@ ScopedLockGuard::~ScopedLockGuard()
   m_lock.unlock(m_lockType);
 }
 
+bool ScopedLockGuard::upgrade(std::chrono::milliseconds timeout)
+{
+  if (m_lockType == LockType::Write)
+  {
+    return true;
+  }
+  if (m_lockType != LockType::Read || !m_lock.upgrade(timeout))
+  {
+    return false;
+  }
+  m_lockType = LockType::Write;
+  return true;
+}
+
 } // namespace resource
 } // namespace smtk
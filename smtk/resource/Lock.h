@@ -13,7 +13,10 @@
 
 #include "smtk/CoreExports.h"
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <mutex>
 
 namespace smtk
@@ -31,13 +34,43 @@ enum class LockType
   Write,
 };
 
-/// A read/write lock for resources. This lock is designed to potentially starve
-/// readers in favor of writers. This is not necessarily bad; it means that
-/// writers are given priority over readers when there are multiple readers and
-/// writers simultaneously attempting to access the resource.
+/// A reader-writer lock for resources.
+///
+/// The lock's state (active readers, an active writer, and pending writers or
+/// upgraders) is held in a single atomic word. Uncontended read and write
+/// acquisitions and releases are a single compare-and-swap; the internal
+/// mutex is only touched when a thread must wait or wake waiters.
+///
+/// A reader may upgrade its lock to a write lock with upgrade(). Only one
+/// reader may be upgrading at a time; while an upgrade is pending, no new
+/// readers or writers are admitted.
+///
+/// The fairness policy determines whether pending writers block new readers
+/// (WriterPreferred, the default) or whether readers are admitted as long as
+/// no writer is active (ReaderPreferred). The latter suits read-dominated
+/// workloads at the risk of delaying writers.
 class Lock
 {
 public:
+  enum class Policy
+  {
+    WriterPreferred,
+    ReaderPreferred
+  };
+
+  /// Contention statistics. Only acquisitions that had to wait are counted.
+  struct Statistics
+  {
+    std::size_t contendedReads;
+    std::size_t contendedWrites;
+    std::size_t upgrades;
+    std::chrono::nanoseconds readWaitTime;
+    std::chrono::nanoseconds writeWaitTime;
+    std::size_t activeReaders;
+    bool activeWriter;
+    bool pendingWriter;
+  };
+
   SMTKCORE_EXPORT Lock();
   Lock(const Lock&) = delete;
   Lock& operator=(const Lock&) = delete;
@@ -45,15 +78,57 @@ public:
   SMTKCORE_EXPORT void lock(LockType);
   SMTKCORE_EXPORT void unlock(LockType);
 
+  /// Acquire the lock if it is immediately available; return true on success.
+  SMTKCORE_EXPORT bool tryLock(LockType);
+
+  /// Wait up to \a timeout for the lock; return true on success.
+  SMTKCORE_EXPORT bool tryLockFor(LockType, std::chrono::milliseconds timeout);
+
+  /// Convert a read lock held by the caller into a write lock, waiting at most
+  /// \a timeout (or indefinitely if negative) for other readers to leave.
+  /// Returns false, leaving the read lock held, if another reader is already
+  /// upgrading or the timeout expires.
+  SMTKCORE_EXPORT bool upgrade(
+    std::chrono::milliseconds timeout = std::chrono::milliseconds(-1));
+
+  /// Convert a write lock held by the caller into a read lock without
+  /// admitting any writer in between.
+  SMTKCORE_EXPORT void downgrade();
+
   SMTKCORE_EXPORT LockType state() const;
 
+  /// Set/get the fairness policy.
+  SMTKCORE_EXPORT void setPolicy(Policy policy);
+  Policy policy() const { return m_policy.load(); }
+
+  /// Access and reset contention statistics.
+  SMTKCORE_EXPORT Statistics statistics() const;
+  SMTKCORE_EXPORT void resetStatistics();
+
 private:
-  std::mutex m_mutex;
-  std::condition_variable m_readerCondition;
-  std::condition_variable m_writerCondition;
-  std::size_t m_activeReaders{ 0 };
+  // Attempt a single state transition without waiting.
+  bool tryAcquireRead();
+  bool tryAcquireWrite();
+  bool tryCompleteUpgrade();
+
+  // Block until a lock of the given type is acquired or \a deadline (if
+  // non-null) passes.
+  bool acquire(LockType, const std::chrono::steady_clock::time_point* deadline);
+
+  void wake();
+
+  std::atomic<std::uint32_t> m_state{ 0 };
+  std::atomic<std::uint32_t> m_waiters{ 0 };
+  std::atomic<Policy> m_policy{ Policy::WriterPreferred };
   std::size_t m_waitingWriters{ 0 };
-  std::size_t m_activeWriters{ 0 };
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+
+  std::atomic<std::size_t> m_contendedReads{ 0 };
+  std::atomic<std::size_t> m_contendedWrites{ 0 };
+  std::atomic<std::size_t> m_upgrades{ 0 };
+  std::atomic<std::int64_t> m_readWaitTime{ 0 };
+  std::atomic<std::int64_t> m_writeWaitTime{ 0 };
 };
 
 /// A scope-guarded utility for handling locks.
@@ -63,6 +138,10 @@ public:
   ScopedLockGuard(Lock&, LockType);
   ~ScopedLockGuard();
 
+  /// Upgrade a guarded read lock to a write lock (see Lock::upgrade()). The
+  /// guard releases whichever lock it holds upon destruction.
+  bool upgrade(std::chrono::milliseconds timeout = std::chrono::milliseconds(-1));
+
 private:
   Lock& m_lock;
   LockType m_lockType;
@@ -0,0 +1,183 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/resource/LockSet.h"
+
+#include "smtk/resource/Resource.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+}
+
+namespace smtk
+{
+namespace resource
+{
+
+LockSet::~LockSet()
+{
+  this->unlock();
+}
+
+bool LockSet::insert(const smtk::resource::ResourcePtr& resource, LockType lockType)
+{
+  if (m_locked || resource == nullptr)
+  {
+    return false;
+  }
+  if (lockType == LockType::DoNotLock)
+  {
+    return true;
+  }
+
+  // Keep the entries sorted by UUID so that locks are always requested in the
+  // same order.
+  auto it = std::lower_bound(
+    m_entries.begin(),
+    m_entries.end(),
+    resource->id(),
+    [](const Entry& entry, const smtk::common::UUID& id) { return entry.m_resource->id() < id; });
+  if (it != m_entries.end() && it->m_resource == resource)
+  {
+    if (lockType == LockType::Write)
+    {
+      it->m_lockType = LockType::Write;
+    }
+    return true;
+  }
+  m_entries.insert(it, Entry{ resource, lockType });
+  return true;
+}
+
+bool LockSet::acquireRemaining(std::size_t held, std::size_t& contested)
+{
+  for (std::size_t i = 0; i < m_entries.size(); ++i)
+  {
+    if (i == held || m_entries[i].m_resource->lock({}).tryLock(m_entries[i].m_lockType))
+    {
+      continue;
+    }
+
+    // Back off: release everything we hold so that we do not block others
+    // while we wait for the contested lock.
+    for (std::size_t j = 0; j < i; ++j)
+    {
+      m_entries[j].m_resource->lock({}).unlock(m_entries[j].m_lockType);
+    }
+    if (held != none && held > i)
+    {
+      m_entries[held].m_resource->lock({}).unlock(m_entries[held].m_lockType);
+    }
+    contested = i;
+    return false;
+  }
+  return true;
+}
+
+void LockSet::lock()
+{
+  if (m_locked)
+  {
+    return;
+  }
+
+  std::size_t held = none;
+  std::size_t contested = none;
+  while (!this->acquireRemaining(held, contested))
+  {
+    // Wait for the contested lock while holding no others.
+    m_entries[contested].m_resource->lock({}).lock(m_entries[contested].m_lockType);
+    held = contested;
+  }
+  m_locked = true;
+}
+
+bool LockSet::tryLock()
+{
+  if (m_locked)
+  {
+    return true;
+  }
+
+  std::size_t contested = none;
+  m_locked = this->acquireRemaining(none, contested);
+  return m_locked;
+}
+
+bool LockSet::tryLockFor(std::chrono::milliseconds timeout)
+{
+  if (m_locked)
+  {
+    return true;
+  }
+
+  auto deadline = std::chrono::steady_clock::now() + timeout;
+  std::size_t held = none;
+  std::size_t contested = none;
+  while (!this->acquireRemaining(held, contested))
+  {
+    auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+      deadline - std::chrono::steady_clock::now());
+    if (
+      remaining.count() <= 0 ||
+      !m_entries[contested].m_resource->lock({}).tryLockFor(
+        m_entries[contested].m_lockType, remaining))
+    {
+      return false;
+    }
+    held = contested;
+  }
+  m_locked = true;
+  return true;
+}
+
+void LockSet::unlock()
+{
+  if (!m_locked)
+  {
+    return;
+  }
+
+  for (auto it = m_entries.rbegin(); it != m_entries.rend(); ++it)
+  {
+    it->m_resource->lock({}).unlock(it->m_lockType);
+  }
+  m_locked = false;
+}
+
+bool LockSet::upgrade(
+  const smtk::resource::ResourcePtr& resource,
+  std::chrono::milliseconds timeout)
+{
+  auto it = std::find_if(m_entries.begin(), m_entries.end(), [&resource](const Entry& entry) {
+    return entry.m_resource == resource;
+  });
+  if (!m_locked || it == m_entries.end())
+  {
+    return false;
+  }
+  if (it->m_lockType == LockType::Write)
+  {
+    return true;
+  }
+
+  if (!resource->lock({}).upgrade(timeout))
+  {
+    return false;
+  }
+  it->m_lockType = LockType::Write;
+  return true;
+}
+} // namespace resource
+} // namespace smtk
@@ -0,0 +1,97 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_resource_LockSet_h
+#define smtk_resource_LockSet_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+
+#include "smtk/resource/Lock.h"
+
+#include <chrono>
+#include <vector>
+
+namespace smtk
+{
+namespace resource
+{
+
+/// A set of resource locks that are acquired and released as a unit.
+///
+/// Resources are locked in order of their UUIDs. When a lock in the sequence
+/// is unavailable, every lock acquired so far is released and the caller
+/// blocks on the contested lock alone before trying the remainder again.
+/// Callers therefore never wait while holding locks that another caller
+/// needs, so operations on disjoint (or compatibly-locked) resources proceed
+/// in parallel and overlapping sets cannot deadlock.
+///
+/// A resource inserted more than once is locked once, using the most
+/// restrictive of the requested lock types.
+class SMTKCORE_EXPORT LockSet
+{
+public:
+  LockSet() = default;
+  LockSet(const LockSet&) = delete;
+  LockSet& operator=(const LockSet&) = delete;
+
+  /// Release any held locks.
+  ~LockSet();
+
+  /// Add a resource to the set. Resources may only be added while the set
+  /// is unlocked. Returns false if the set is locked or \a resource is null.
+  bool insert(const smtk::resource::ResourcePtr& resource, LockType lockType);
+
+  /// Block until every lock in the set is held.
+  void lock();
+
+  /// Acquire every lock in the set only if all are immediately available.
+  bool tryLock();
+
+  /// Acquire every lock in the set, giving up after \a timeout.
+  bool tryLockFor(std::chrono::milliseconds timeout);
+
+  /// Release every lock in the set.
+  void unlock();
+
+  /// Convert a held read lock on \a resource into a write lock without
+  /// releasing it (see Lock::upgrade()), waiting at most \a timeout (or
+  /// indefinitely for a negative timeout) for other readers to leave. Returns
+  /// false, with the read lock still held, if another reader of the resource
+  /// is already upgrading or the timeout expires.
+  bool upgrade(
+    const smtk::resource::ResourcePtr& resource,
+    std::chrono::milliseconds timeout = std::chrono::milliseconds(-1));
+
+  /// Return true if the locks in the set are held.
+  bool isLocked() const { return m_locked; }
+
+  /// Return the number of resources in the set.
+  std::size_t size() const { return m_entries.size(); }
+
+private:
+  struct Entry
+  {
+    smtk::resource::ResourcePtr m_resource;
+    LockType m_lockType;
+  };
+
+  // Attempt to acquire every lock in order. The lock at index \a held has
+  // already been acquired. On failure, release everything and return the
+  // index of the contested lock.
+  bool acquireRemaining(std::size_t held, std::size_t& contested);
+
+  std::vector<Entry> m_entries;
+  bool m_locked{ false };
+};
+} // namespace resource
+} // namespace smtk
+
+#endif // smtk_resource_LockSet_h
@@ -13,6 +13,7 @@
 
 #include "smtk/io/Logger.h"
 
+#include "smtk/common/Executor.h"
 #include "smtk/common/UUIDGenerator.h"
 
 namespace smtk
@@ -324,29 +325,34 @@ std::set<smtk::resource::ResourcePtr> Manager::find(const Resource::Index& index
   return values;
 }
 
-smtk::resource::ResourcePtr Manager::read(const std::string& typeName, const std::string& url)
+smtk::resource::ResourcePtr Manager::readUnmanaged(
+  const std::string& typeName,
+  const std::string& url) const
 {
-  smtk::resource::ResourcePtr resource;
-
   // Locate the metadata associated with this resource type
   auto metadata = m_metadata.get<NameTag>().find(typeName);
   if (metadata != m_metadata.get<NameTag>().end())
   {
     // Read in the resource using the provided url
-    resource = metadata->read(url);
+    return metadata->read(url);
   }
-  else
+
+  // If a resource type is not identified using this type name, we check the
+  // map of legacy readers to see if this name is a legacy name for a resource type.
+  auto search = m_legacyReaders.find(typeName);
+  if (search != m_legacyReaders.end())
   {
-    // If a resource type is not identified using this type name, we check the
-    // map of legacy readers to see if this name is a legacy name for a resource type.
-    auto search = m_legacyReaders.find(typeName);
-    if (search != m_legacyReaders.end())
-    {
-      // Read in the resource using the provided url
-      resource = search->second(url);
-    }
+    // Read in the resource using the provided url
+    return search->second(url);
   }
 
+  return smtk::resource::ResourcePtr();
+}
+
+smtk::resource::ResourcePtr Manager::read(const std::string& typeName, const std::string& url)
+{
+  smtk::resource::ResourcePtr resource = this->readUnmanaged(typeName, url);
+
   if (resource)
   {
     // Add the resource to be tracked by this manager
@@ -386,6 +392,43 @@ smtk::resource::ResourcePtr Manager::read(const Resource::Index& index, const st
   return resource;
 }
 
+std::vector<smtk::resource::ResourcePtr> Manager::read(
+  const std::vector<std::pair<std::string, std::string>>& requests,
+  smtk::common::Executor& executor)
+{
+  // Each reader deserializes into its own resource, so the resources may be
+  // read concurrently. Only the (serial) registration below touches the
+  // manager's container and observers.
+  std::vector<smtk::resource::ResourcePtr> resources(requests.size());
+  executor.parallelFor(0, requests.size(), 1, [&](std::size_t first, std::size_t last) {
+    for (std::size_t ii = first; ii < last; ++ii)
+    {
+      resources[ii] = this->readUnmanaged(requests[ii].first, requests[ii].second);
+    }
+  });
+
+  // Add the resources in the order they were requested. Adding a resource
+  // resolves its links to (and from) the resources added before it, so links
+  // between the resources just read are resolved once all have been added.
+  for (std::size_t ii = 0; ii < resources.size(); ++ii)
+  {
+    const auto& resource = resources[ii];
+    if (resource)
+    {
+      this->add(resource);
+      resource->setLocation(requests[ii].second);
+    }
+  }
+
+  return resources;
+}
+
+std::vector<smtk::resource::ResourcePtr> Manager::read(
+  const std::vector<std::pair<std::string, std::string>>& requests)
+{
+  return this->read(requests, *smtk::common::Executor::instance());
+}
+
 bool Manager::write(const smtk::resource::ResourcePtr& resource, const std::string& url)
 {
   // Set the location of the resource to the input url and write
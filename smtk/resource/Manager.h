@@ -31,9 +31,15 @@
 #include <string>
 #include <typeinfo>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace smtk
 {
+namespace common
+{
+class Executor;
+}
 namespace resource
 {
 class GarbageCollector;
@@ -158,6 +164,23 @@ public:
   template<typename ResourceType>
   smtk::shared_ptr<ResourceType> read(const std::string&);
 
+  /// Read several resources, each identified by its type name and location.
+  ///
+  /// The resources are independent of one another, so they are read and
+  /// deserialized concurrently on \a executor. Once all of them have been read,
+  /// they are added to the manager in the order they were requested (so that
+  /// observers see a deterministic sequence of events) and links between them
+  /// are resolved. The returned resources are in the same order as \a requests;
+  /// resources that could not be read are null. If a reader throws, the first
+  /// exception is rethrown after the remaining readers have finished and no
+  /// resources are added.
+  std::vector<ResourcePtr> read(
+    const std::vector<std::pair<std::string, std::string>>& requests,
+    smtk::common::Executor& executor);
+
+  /// Read several resources as above using smtk::common::Executor::instance().
+  std::vector<ResourcePtr> read(const std::vector<std::pair<std::string, std::string>>& requests);
+
   /// Write resource to file. The resource's write location is held by the
   /// resource itself.
   bool write(const ResourcePtr&);
@@ -255,6 +278,9 @@ public:
 private:
   Manager();
 
+  /// Read a resource identified by its type name without adding it to the manager.
+  ResourcePtr readUnmanaged(const std::string&, const std::string&) const;
+
   /// All resources are tracked using a map between the resource's UUID and a
   /// shared pointer to the resource itself.
   Container m_resources;
@@ -17,7 +17,13 @@
 
 #include "smtk/common/json/jsonUUID.h"
 
+#include "smtk/resource/PropertyIndex.h"
+
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <unordered_set>
 
 namespace smtk
 {
@@ -51,12 +57,21 @@ class PropertiesOfType;
 /// PropertiesOfType provides a non-templated API for accessing property
 /// information, as well as logic for erasing properties associated with a UUID
 /// (needed for cleaning up after components are deleted).
+///
+/// PropertiesOfType also holds the secondary indices (see PropertyIndex) kept
+/// for its properties. Values modified through the methods that accept a
+/// UUID are re-indexed individually; access to a property's entire map of
+/// values (via operator[], at() or data()) causes that property's indices to
+/// be rebuilt upon their next use.
 template<typename Type>
 class PropertiesOfType<std::unordered_map<smtk::common::UUID, Type>>
   : public smtk::common::TypeMapEntry<std::string, std::unordered_map<smtk::common::UUID, Type>>
   , public PropertiesBase
 {
   friend class Properties;
+  typedef smtk::common::TypeMapEntry<std::string, std::unordered_map<smtk::common::UUID, Type>>
+    Entry;
+
   PropertiesOfType()
     : smtk::common::TypeMapEntry<std::string, std::unordered_map<smtk::common::UUID, Type>>()
     , PropertiesBase()
@@ -64,13 +79,399 @@ class PropertiesOfType<std::unordered_map<smtk::common::UUID, Type>>
   }
 
 public:
+  typedef typename Entry::mapped_type mapped_type;
+  typedef typename PropertyIndex<Type>::Element Element;
+
   void eraseId(const smtk::common::UUID& id) override
   {
-    for (auto& pair : this->data())
+    for (auto& pair : Entry::data())
     {
+      this->willModify(pair.first, id);
       pair.second.erase(id);
     }
   }
+
+  /// Insert (\a key, \a values ) into the map.
+  bool insert(const std::string& key, const mapped_type& values)
+  {
+    this->invalidate(key);
+    return Entry::insert(key, values);
+  }
+
+  /// Emplace (\a key, \a values ) into the map.
+  bool emplace(const std::string& key, mapped_type&& values)
+  {
+    this->invalidate(key);
+    return Entry::emplace(key, std::move(values));
+  }
+
+  /// Erase the values indexed by \a key from the map.
+  void erase(const std::string& key)
+  {
+    this->invalidate(key);
+    Entry::erase(key);
+  }
+
+  /// Access the values indexed by \a key.
+  mapped_type& operator[](const std::string& key)
+  {
+    this->invalidate(key);
+    return Entry::operator[](key);
+  }
+
+  /// Access the values indexed by \a key.
+  mapped_type& at(const std::string& key)
+  {
+    this->invalidate(key);
+    return Entry::at(key);
+  }
+
+  /// Access the values indexed by \a key.
+  const mapped_type& at(const std::string& key) const { return Entry::at(key); }
+
+  /// Access the class's underlying data.
+  std::unordered_map<std::string, mapped_type>& data()
+  {
+    this->invalidate();
+    return Entry::data();
+  }
+  const std::unordered_map<std::string, mapped_type>& data() const { return Entry::data(); }
+
+  /// Merge the values in \a j into those held: values in \a j replace any
+  /// held for the same key and id, and all others are kept.
+  void from_json(const nlohmann::json& j) override
+  {
+    this->merge<mapped_type>(j);
+    this->invalidate();
+  }
+
+  /// Check whether \a id has a value for the property \a key.
+  bool contains(const std::string& key, const smtk::common::UUID& id) const
+  {
+    auto values = Entry::data().find(key);
+    return values != Entry::data().end() && values->second.find(id) != values->second.end();
+  }
+  using Entry::contains;
+
+  /// Insert \a value for the property \a key of \a id if \a id has no value.
+  bool insert(const std::string& key, const smtk::common::UUID& id, const Type& value)
+  {
+    auto inserted = Entry::operator[](key).insert(std::make_pair(id, value));
+    if (inserted.second)
+    {
+      this->didInsert(key, inserted.first->first, inserted.first->second);
+    }
+    return inserted.second;
+  }
+
+  /// Emplace \a value for the property \a key of \a id if \a id has no value.
+  bool emplace(const std::string& key, const smtk::common::UUID& id, Type&& value)
+  {
+    auto inserted = Entry::operator[](key).emplace(std::make_pair(id, std::move(value)));
+    if (inserted.second)
+    {
+      this->didInsert(key, inserted.first->first, inserted.first->second);
+    }
+    return inserted.second;
+  }
+
+  /// Erase the value of the property \a key for \a id. Returns false if there
+  /// was none.
+  bool erase(const std::string& key, const smtk::common::UUID& id)
+  {
+    auto values = Entry::data().find(key);
+    if (values == Entry::data().end())
+    {
+      return false;
+    }
+    this->willModify(key, id);
+    bool erased = values->second.erase(id) > 0;
+    if (values->second.empty())
+    {
+      Entry::data().erase(values);
+    }
+    return erased;
+  }
+
+  /// Access the value of the property \a key for \a id, inserting a default
+  /// value if there is none.
+  Type& value(const std::string& key, const smtk::common::UUID& id)
+  {
+    this->willModify(key, id);
+    return Entry::operator[](key)[id];
+  }
+
+  /// Access the value of the property \a key for \a id.
+  Type& at(const std::string& key, const smtk::common::UUID& id)
+  {
+    this->willModify(key, id);
+    return Entry::at(key).at(id);
+  }
+
+  /// Access the value of the property \a key for \a id.
+  const Type& at(const std::string& key, const smtk::common::UUID& id) const
+  {
+    return Entry::at(key).at(id);
+  }
+
+  /// Keep an index of the given \a type for the property \a key.
+  void addIndex(const std::string& key, PropertyIndexType type)
+  {
+    std::lock_guard<std::mutex> guard(m_indexMutex);
+    auto& state = m_indices[key];
+    m_indexed.store(true, std::memory_order_release);
+    this->sync(key, state);
+    auto values = Entry::data().find(key);
+    state.index.enable(type, values == Entry::data().end() ? mapped_type() : values->second);
+  }
+
+  /// Stop keeping an index of the given \a type for the property \a key.
+  void removeIndex(const std::string& key, PropertyIndexType type)
+  {
+    std::lock_guard<std::mutex> guard(m_indexMutex);
+    auto it = m_indices.find(key);
+    if (it != m_indices.end())
+    {
+      it->second.index.disable(type);
+      if (it->second.index.empty())
+      {
+        m_indices.erase(it);
+        m_indexed.store(!m_indices.empty(), std::memory_order_release);
+      }
+    }
+  }
+
+  /// Check whether an index of the given \a type is kept for the property \a key.
+  bool hasIndex(const std::string& key, PropertyIndexType type) const
+  {
+    std::lock_guard<std::mutex> guard(m_indexMutex);
+    auto it = m_indices.find(key);
+    return it != m_indices.end() && it->second.index.has(type);
+  }
+
+  /// Insert the ids whose property \a key equals \a value into \a result.
+  /// Returns false if the property has no hash index.
+  bool findEqual(const std::string& key, const Type& value, std::set<smtk::common::UUID>& result)
+    const
+  {
+    return this->query(key, [&](const PropertyIndex<Type>& index) {
+      return index.findEqual(value, result);
+    });
+  }
+
+  /// Insert the ids whose property \a key (or, for vectors, one of its
+  /// elements) lies in [\a lower, \a upper] into \a result. Returns false if
+  /// the property has no ordered index.
+  bool findInRange(
+    const std::string& key,
+    const Element& lower,
+    const Element& upper,
+    std::set<smtk::common::UUID>& result) const
+  {
+    return this->query(key, [&](const PropertyIndex<Type>& index) {
+      return index.findInRange(lower, upper, result);
+    });
+  }
+
+  /// Insert the ids whose property \a key contains (or, for scalars, equals)
+  /// \a element into \a result. Returns false if the property has no inverted
+  /// index.
+  bool findContaining(
+    const std::string& key,
+    const Element& element,
+    std::set<smtk::common::UUID>& result) const
+  {
+    return this->query(key, [&](const PropertyIndex<Type>& index) {
+      return index.findContaining(element, result);
+    });
+  }
+
+  /// Insert the ids whose property \a key may equal \a value into \a result,
+  /// using whichever index is kept. Unless the property has a hash index, the
+  /// result may include ids whose values merely share an element with
+  /// \a value, so the caller must test each id. Returns false if the property
+  /// has no index that can narrow the search.
+  bool findCandidates(
+    const std::string& key,
+    const Type& value,
+    std::set<smtk::common::UUID>& result) const
+  {
+    return this->query(key, [&](const PropertyIndex<Type>& index) {
+      if (index.findEqual(value, result))
+      {
+        return true;
+      }
+      bool found = false;
+      bool narrowed = false;
+      PropertyIndexTraits<Type>::visitElements(value, [&](const Element& element) {
+        if (!found)
+        {
+          found = true;
+          narrowed = index.findContaining(element, result) ||
+            index.findInRange(element, element, result);
+        }
+      });
+      return narrowed;
+    });
+  }
+
+private:
+  template<typename T>
+  typename std::enable_if<nlohmann::detail::is_compatible_type<nlohmann::json, T>::value>::type
+  merge(const nlohmann::json& j)
+  {
+    auto& data = Entry::data();
+    if (data.empty())
+    {
+      data = j.get<std::unordered_map<std::string, mapped_type>>();
+      return;
+    }
+    for (auto& entry : j.get<std::unordered_map<std::string, mapped_type>>())
+    {
+      mapped_type& values = data[entry.first];
+      for (auto& value : entry.second)
+      {
+        values[value.first] = std::move(value.second);
+      }
+    }
+  }
+
+  template<typename T>
+  typename std::enable_if<!nlohmann::detail::is_compatible_type<nlohmann::json, T>::value>::type
+  merge(const nlohmann::json&)
+  {
+  }
+
+  struct IndexState
+  {
+    PropertyIndex<Type> index;
+    // Ids whose values may have changed since they were removed from the index.
+    std::unordered_set<smtk::common::UUID> pending;
+    // Whether the index must be rebuilt from scratch.
+    bool stale{ false };
+  };
+
+  // Remove the value of (key, id) from the property's index, since the caller
+  // may modify it; it is re-indexed when the index is next used.
+  void willModify(const std::string& key, const smtk::common::UUID& id)
+  {
+    if (!m_indexed.load(std::memory_order_acquire))
+    {
+      return;
+    }
+    std::lock_guard<std::mutex> guard(m_indexMutex);
+    auto it = m_indices.find(key);
+    if (it == m_indices.end() || it->second.stale || !it->second.pending.insert(id).second)
+    {
+      return;
+    }
+    auto values = Entry::data().find(key);
+    if (values != Entry::data().end())
+    {
+      auto value = values->second.find(id);
+      if (value != values->second.end())
+      {
+        it->second.index.erase(id, value->second);
+      }
+    }
+  }
+
+  void didInsert(const std::string& key, const smtk::common::UUID& id, const Type& value)
+  {
+    if (!m_indexed.load(std::memory_order_acquire))
+    {
+      return;
+    }
+    std::lock_guard<std::mutex> guard(m_indexMutex);
+    auto it = m_indices.find(key);
+    if (it != m_indices.end() && !it->second.stale && !it->second.pending.count(id))
+    {
+      it->second.index.insert(id, value);
+    }
+  }
+
+  void invalidate(const std::string& key)
+  {
+    if (!m_indexed.load(std::memory_order_acquire))
+    {
+      return;
+    }
+    std::lock_guard<std::mutex> guard(m_indexMutex);
+    auto it = m_indices.find(key);
+    if (it != m_indices.end())
+    {
+      it->second.stale = true;
+      it->second.pending.clear();
+    }
+  }
+
+  void invalidate()
+  {
+    if (!m_indexed.load(std::memory_order_acquire))
+    {
+      return;
+    }
+    std::lock_guard<std::mutex> guard(m_indexMutex);
+    for (auto& entry : m_indices)
+    {
+      entry.second.stale = true;
+      entry.second.pending.clear();
+    }
+  }
+
+  // Bring the index of the property `key` up to date. The index mutex must
+  // be held.
+  void sync(const std::string& key, IndexState& state) const
+  {
+    if (!state.stale && state.pending.empty())
+    {
+      return;
+    }
+    auto values = Entry::data().find(key);
+    if (state.stale)
+    {
+      state.index.clear();
+      if (values != Entry::data().end())
+      {
+        for (const auto& entry : values->second)
+        {
+          state.index.insert(entry.first, entry.second);
+        }
+      }
+      state.stale = false;
+    }
+    else if (values != Entry::data().end())
+    {
+      for (const auto& id : state.pending)
+      {
+        auto value = values->second.find(id);
+        if (value != values->second.end())
+        {
+          state.index.insert(id, value->second);
+        }
+      }
+    }
+    state.pending.clear();
+  }
+
+  template<typename Functor>
+  bool query(const std::string& key, const Functor& functor) const
+  {
+    std::lock_guard<std::mutex> guard(m_indexMutex);
+    auto it = m_indices.find(key);
+    if (it == m_indices.end())
+    {
+      return false;
+    }
+    this->sync(key, it->second);
+    return functor(it->second.index);
+  }
+
+  mutable std::unordered_map<std::string, IndexState> m_indices;
+  mutable std::mutex m_indexMutex;
+  // Whether any index is kept, so that unindexed properties may be modified
+  // without taking the index mutex. It is only set while the mutex is held.
+  std::atomic<bool> m_indexed{ false };
 };
 
 /// Properties is a generalized container for storing and accessing data using a
@@ -108,7 +509,59 @@ public:
   template<typename Type>
   void eraseIdForType(const smtk::common::UUID& id)
   {
-    dynamic_cast<PropertiesBase&>(this->get<Type>()).eraseId(id);
+    dynamic_cast<PropertiesBase&>(smtk::common::TypeMapBase<std::string>::get<Type>()).eraseId(id);
+  }
+
+  /// Access values of type \a Type. Unlike TypeMapBase::get(), the returned
+  /// container keeps the indices of its properties up to date.
+  template<typename Type>
+  PropertiesOfType<Type>& get()
+  {
+    return static_cast<PropertiesOfType<Type>&>(
+      smtk::common::TypeMapBase<std::string>::get<Type>());
+  }
+
+  /// Access values of type \a Type.
+  template<typename Type>
+  const PropertiesOfType<Type>& get() const
+  {
+    return static_cast<const PropertiesOfType<Type>&>(
+      smtk::common::TypeMapBase<std::string>::get<Type>());
+  }
+
+  /// Insert (\a Type, \a key, \a value ) into the map.
+  template<typename Type>
+  bool insert(const std::string& key, const Type& value)
+  {
+    return this->get<Type>().insert(key, value);
+  }
+
+  /// Emplace (\a Type, \a key, \a value ) into the map.
+  template<typename Type>
+  bool emplace(const std::string& key, Type&& value)
+  {
+    return this->get<Type>().emplace(key, std::forward<Type>(value));
+  }
+
+  /// Erase value of type \a Type indexed by \a key from the map.
+  template<typename Type>
+  void erase(const std::string& key)
+  {
+    this->get<Type>().erase(key);
+  }
+
+  /// Access value of type \a Type indexed by \a key.
+  template<typename Type>
+  Type& at(const std::string& key)
+  {
+    return this->get<Type>().at(key);
+  }
+
+  /// Access value of type \a Type indexed by \a key.
+  template<typename Type>
+  const Type& at(const std::string& key) const
+  {
+    return this->get<Type>().at(key);
   }
 
   // TODO: Putting the following two methods in the public API breaks RAII.
@@ -234,51 +687,36 @@ class PropertiesOfType
 
 public:
   /// Check whether a property associated with \a key is present.
-  bool contains(const std::string& key) const
-  {
-    if (!m_properties.contains(key))
-    {
-      return false;
-    }
-    const std::unordered_map<smtk::common::UUID, Type>& data = get(key);
-    return (data.find(m_id) != data.end());
-  }
+  bool contains(const std::string& key) const { return properties().contains(key, m_id); }
 
   /// Insert (\a key, \a value ) into the container.
   bool insert(const std::string& key, const Type& value)
   {
-    return get(key).insert(std::make_pair(m_id, value)).second;
+    return m_properties.insert(key, m_id, value);
   }
 
   /// Emplace (\a key, \a value ) into the container.
   bool emplace(const std::string& key, Type&& value)
   {
-    return get(key).emplace(std::make_pair(m_id, std::move(value))).second;
+    return m_properties.emplace(key, m_id, std::move(value));
   }
 
   /// Erase property indexed by \a key from the container.
-  void erase(const std::string& key)
-  {
-    get(key).erase(m_id);
-    if (get(key).empty())
-    {
-      m_properties.erase(key);
-    }
-  }
+  void erase(const std::string& key) { m_properties.erase(key, m_id); }
 
   /// Access property indexed by \a key.
-  Type& operator[](const std::string& key) { return get(key)[m_id]; }
+  Type& operator[](const std::string& key) { return m_properties.value(key, m_id); }
 
   /// Access property indexed by \a key.
-  Type& at(const std::string& key) { return get(key).at(m_id); }
+  Type& at(const std::string& key) { return m_properties.at(key, m_id); }
 
   /// Access property indexed by \a key.
-  const Type& at(const std::string& key) const { return get(key).at(m_id); }
+  const Type& at(const std::string& key) const { return properties().at(key, m_id); }
 
   /// Check if any properties of this type are associated with m_id.
   bool empty() const
   {
-    for (auto& pair : m_properties.data())
+    for (auto& pair : properties().data())
     {
       if (pair.second.find(m_id) != pair.second.end())
       {
@@ -291,7 +729,7 @@ public:
   std::set<std::string> keys() const
   {
     std::set<std::string> keys;
-    for (auto& pair : m_properties.data())
+    for (auto& pair : properties().data())
     {
       if (pair.second.find(m_id) != pair.second.end())
       {
@@ -302,18 +740,8 @@ public:
   }
 
 private:
-  const std::unordered_map<smtk::common::UUID, Type>& get(const std::string& key) const
-  {
-    return m_properties.at(key);
-  }
-  std::unordered_map<smtk::common::UUID, Type>& get(const std::string& key)
-  {
-    if (!m_properties.contains(key))
-    {
-      m_properties.emplace(key, typename detail::PropertiesOfType<IndexedType>::mapped_type());
-    }
-    return m_properties.at(key);
-  }
+  // Read-only access must not invalidate the properties' indices.
+  const detail::PropertiesOfType<IndexedType>& properties() const { return m_properties; }
 
   const smtk::common::UUID& m_id;
   detail::PropertiesOfType<IndexedType>& m_properties;
@@ -437,6 +865,75 @@ public:
     m_data.insertPropertyType<Indexed<Type>>();
   }
 
+  /// Keep an index of the given \a type for the property (\a Type, \a key ).
+  /// Indices are kept consistent as component properties are modified and
+  /// are used by resource queries to avoid visiting every component.
+  template<typename Type>
+  void addIndex(const std::string& key, PropertyIndexType type)
+  {
+    m_data.get<Indexed<Type>>().addIndex(key, type);
+  }
+
+  /// Stop keeping an index of the given \a type for the property (\a Type, \a key ).
+  template<typename Type>
+  void removeIndex(const std::string& key, PropertyIndexType type)
+  {
+    m_data.get<Indexed<Type>>().removeIndex(key, type);
+  }
+
+  /// Check whether an index of the given \a type is kept for (\a Type, \a key ).
+  template<typename Type>
+  bool hasIndex(const std::string& key, PropertyIndexType type) const
+  {
+    return m_data.containsType<Indexed<Type>>() && m_data.get<Indexed<Type>>().hasIndex(key, type);
+  }
+
+  /// Insert the ids of components whose property (\a Type, \a key ) equals
+  /// \a value into \a result. Returns false if no hash index is kept.
+  template<typename Type>
+  bool findEqual(const std::string& key, const Type& value, smtk::common::UUIDs& result) const
+  {
+    return m_data.containsType<Indexed<Type>>() &&
+      m_data.get<Indexed<Type>>().findEqual(key, value, result);
+  }
+
+  /// Insert the ids of components whose property (\a Type, \a key ) lies in
+  /// [\a lower, \a upper] into \a result. Returns false if no ordered index is
+  /// kept.
+  template<typename Type>
+  bool findInRange(
+    const std::string& key,
+    const typename PropertyIndex<Type>::Element& lower,
+    const typename PropertyIndex<Type>::Element& upper,
+    smtk::common::UUIDs& result) const
+  {
+    return m_data.containsType<Indexed<Type>>() &&
+      m_data.get<Indexed<Type>>().findInRange(key, lower, upper, result);
+  }
+
+  /// Insert the ids of components whose property (\a Type, \a key ) contains
+  /// \a element into \a result. Returns false if no inverted index is kept.
+  template<typename Type>
+  bool findContaining(
+    const std::string& key,
+    const typename PropertyIndex<Type>::Element& element,
+    smtk::common::UUIDs& result) const
+  {
+    return m_data.containsType<Indexed<Type>>() &&
+      m_data.get<Indexed<Type>>().findContaining(key, element, result);
+  }
+
+  /// Insert a superset of the ids of components whose property
+  /// (\a Type, \a key ) equals \a value into \a result. Returns false if no
+  /// index of the property can narrow the search.
+  template<typename Type>
+  bool findCandidates(const std::string& key, const Type& value, smtk::common::UUIDs& result)
+    const
+  {
+    return m_data.containsType<Indexed<Type>>() &&
+      m_data.get<Indexed<Type>>().findCandidates(key, value, result);
+  }
+
 private:
   ResourceProperties(Resource* resource);
 
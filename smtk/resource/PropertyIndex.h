@@ -0,0 +1,305 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_resource_PropertyIndex_h
+#define smtk_resource_PropertyIndex_h
+
+#include "smtk/common/UUID.h"
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace smtk
+{
+namespace resource
+{
+
+/// The kinds of secondary index that may be kept for a property.
+enum class PropertyIndexType
+{
+  Hash,    //!< Find the ids whose value equals a given value.
+  Ordered, //!< Find the ids with a value (or, for vectors, an element) in a range.
+  Inverted //!< Find the ids whose vector value contains a given element.
+};
+
+namespace detail
+{
+/// Describe how the values of a property type are decomposed into the
+/// elements used by ordered and inverted indices. Scalar values are their
+/// own (only) element.
+template<typename Type>
+struct PropertyIndexTraits
+{
+  typedef Type Element;
+
+  template<typename Functor>
+  static void visitElements(const Type& value, const Functor& functor)
+  {
+    functor(value);
+  }
+
+  static std::size_t hash(const Type& value) { return std::hash<Type>()(value); }
+};
+
+/// The elements of a vector-valued property are the vector's entries.
+template<typename T>
+struct PropertyIndexTraits<std::vector<T>>
+{
+  typedef T Element;
+
+  template<typename Functor>
+  static void visitElements(const std::vector<T>& value, const Functor& functor)
+  {
+    for (auto it = value.begin(); it != value.end(); ++it)
+    {
+      functor(static_cast<T>(*it));
+    }
+  }
+
+  static std::size_t hash(const std::vector<T>& value)
+  {
+    std::size_t result = value.size();
+    for (auto it = value.begin(); it != value.end(); ++it)
+    {
+      result ^= std::hash<T>()(*it) + 0x9e3779b9 + (result << 6) + (result >> 2);
+    }
+    return result;
+  }
+};
+
+/// Secondary indices over the values of a single property (i.e., a property
+/// name and type). Each kind of index is optional; PropertiesOfType keeps the
+/// enabled indices consistent with the property's values.
+template<typename Type>
+class PropertyIndex
+{
+  typedef PropertyIndexTraits<Type> Traits;
+  typedef std::unordered_set<smtk::common::UUID> Ids;
+
+  struct HashValue
+  {
+    std::size_t operator()(const Type& value) const { return Traits::hash(value); }
+  };
+
+public:
+  typedef typename Traits::Element Element;
+
+  /// Return whether an index of the given \a type is kept.
+  bool has(PropertyIndexType type) const
+  {
+    switch (type)
+    {
+      case PropertyIndexType::Hash:
+        return !!m_hash;
+      case PropertyIndexType::Ordered:
+        return !!m_ordered;
+      case PropertyIndexType::Inverted:
+        return !!m_inverted;
+    }
+    return false;
+  }
+
+  /// Return whether any index is kept.
+  bool empty() const { return !m_hash && !m_ordered && !m_inverted; }
+
+  /// Start keeping an index of the given \a type, populated from \a values.
+  template<typename Values>
+  void enable(PropertyIndexType type, const Values& values)
+  {
+    if (this->has(type))
+    {
+      return;
+    }
+    switch (type)
+    {
+      case PropertyIndexType::Hash:
+        m_hash.reset(new std::unordered_map<Type, Ids, HashValue>());
+        break;
+      case PropertyIndexType::Ordered:
+        m_ordered.reset(new std::map<Element, Ids>());
+        break;
+      case PropertyIndexType::Inverted:
+        m_inverted.reset(new std::unordered_map<Element, Ids>());
+        break;
+    }
+    for (const auto& entry : values)
+    {
+      this->insert(entry.first, entry.second, type);
+    }
+  }
+
+  /// Stop keeping an index of the given \a type.
+  void disable(PropertyIndexType type)
+  {
+    switch (type)
+    {
+      case PropertyIndexType::Hash:
+        m_hash.reset();
+        break;
+      case PropertyIndexType::Ordered:
+        m_ordered.reset();
+        break;
+      case PropertyIndexType::Inverted:
+        m_inverted.reset();
+        break;
+    }
+  }
+
+  /// Add (\a id, \a value ) to each index.
+  void insert(const smtk::common::UUID& id, const Type& value)
+  {
+    this->insert(id, value, PropertyIndexType::Hash);
+    this->insert(id, value, PropertyIndexType::Ordered);
+    this->insert(id, value, PropertyIndexType::Inverted);
+  }
+
+  /// Remove (\a id, \a value ) from each index.
+  void erase(const smtk::common::UUID& id, const Type& value)
+  {
+    if (m_hash)
+    {
+      auto it = m_hash->find(value);
+      if (it != m_hash->end() && it->second.erase(id) && it->second.empty())
+      {
+        m_hash->erase(it);
+      }
+    }
+    if (m_ordered)
+    {
+      Traits::visitElements(value, [this, &id](const Element& element) {
+        auto it = m_ordered->find(element);
+        if (it != m_ordered->end() && it->second.erase(id) && it->second.empty())
+        {
+          m_ordered->erase(it);
+        }
+      });
+    }
+    if (m_inverted)
+    {
+      Traits::visitElements(value, [this, &id](const Element& element) {
+        auto it = m_inverted->find(element);
+        if (it != m_inverted->end() && it->second.erase(id) && it->second.empty())
+        {
+          m_inverted->erase(it);
+        }
+      });
+    }
+  }
+
+  /// Remove all entries (but not the kinds of index kept).
+  void clear()
+  {
+    if (m_hash)
+    {
+      m_hash->clear();
+    }
+    if (m_ordered)
+    {
+      m_ordered->clear();
+    }
+    if (m_inverted)
+    {
+      m_inverted->clear();
+    }
+  }
+
+  /// Insert the ids whose value equals \a value into \a result. Returns
+  /// false if no hash index is kept.
+  bool findEqual(const Type& value, std::set<smtk::common::UUID>& result) const
+  {
+    if (!m_hash)
+    {
+      return false;
+    }
+    auto it = m_hash->find(value);
+    if (it != m_hash->end())
+    {
+      result.insert(it->second.begin(), it->second.end());
+    }
+    return true;
+  }
+
+  /// Insert the ids with a value (or, for vectors, an element) in the closed
+  /// range [\a lower, \a upper] into \a result. Returns false if no ordered
+  /// index is kept.
+  bool findInRange(const Element& lower, const Element& upper, std::set<smtk::common::UUID>& result)
+    const
+  {
+    if (!m_ordered)
+    {
+      return false;
+    }
+    for (auto it = m_ordered->lower_bound(lower); it != m_ordered->end() && !(upper < it->first);
+         ++it)
+    {
+      result.insert(it->second.begin(), it->second.end());
+    }
+    return true;
+  }
+
+  /// Insert the ids whose value contains (or, for scalars, equals) \a element
+  /// into \a result. Returns false if no inverted index is kept.
+  bool findContaining(const Element& element, std::set<smtk::common::UUID>& result) const
+  {
+    if (!m_inverted)
+    {
+      return false;
+    }
+    auto it = m_inverted->find(element);
+    if (it != m_inverted->end())
+    {
+      result.insert(it->second.begin(), it->second.end());
+    }
+    return true;
+  }
+
+private:
+  void insert(const smtk::common::UUID& id, const Type& value, PropertyIndexType type)
+  {
+    switch (type)
+    {
+      case PropertyIndexType::Hash:
+        if (m_hash)
+        {
+          (*m_hash)[value].insert(id);
+        }
+        break;
+      case PropertyIndexType::Ordered:
+        if (m_ordered)
+        {
+          Traits::visitElements(
+            value, [this, &id](const Element& element) { (*m_ordered)[element].insert(id); });
+        }
+        break;
+      case PropertyIndexType::Inverted:
+        if (m_inverted)
+        {
+          Traits::visitElements(
+            value, [this, &id](const Element& element) { (*m_inverted)[element].insert(id); });
+        }
+        break;
+    }
+  }
+
+  std::unique_ptr<std::unordered_map<Type, Ids, HashValue>> m_hash;
+  std::unique_ptr<std::map<Element, Ids>> m_ordered;
+  std::unique_ptr<std::unordered_map<Element, Ids>> m_inverted;
+};
+} // namespace detail
+} // namespace resource
+} // namespace smtk
+
+#endif // smtk_resource_PropertyIndex_h
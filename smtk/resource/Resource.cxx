@@ -17,6 +17,7 @@
 
 #include "smtk/resource/filter/Filter.h"
 
+#include "smtk/common/Executor.h"
 #include "smtk/common/Paths.h"
 #include "smtk/common/TypeName.h"
 #include "smtk/common/UUIDGenerator.h"
@@ -82,11 +83,85 @@ ComponentSet Resource::find(const std::string& queryString) const
     }
   };
 
-  this->visit(visitor);
+  // If the query's properties are indexed, only test the components the
+  // indices admit.
+  smtk::common::UUIDs candidates;
+  if (this->queryCandidates(queryOp, candidates))
+  {
+    for (const auto& candidate : candidates)
+    {
+      auto component = this->find(candidate);
+      if (component)
+      {
+        visitor(component);
+      }
+    }
+  }
+  else
+  {
+    this->visit(visitor);
+  }
 
   return componentSet;
 }
 
+void Resource::visitParallel(
+  smtk::common::Executor& executor,
+  const ChunkVisitor& visitor,
+  std::size_t grain) const
+{
+  std::vector<Component*> components;
+  // Components gathered via visit() may be constructed upon access; hold
+  // references to them until they have been visited.
+  std::vector<ComponentPtr> owners;
+  if (!this->gatherComponents(components))
+  {
+    smtk::resource::Component::Visitor gather = [&owners](const ComponentPtr& component) {
+      if (component)
+      {
+        owners.push_back(component);
+      }
+    };
+    this->visit(gather);
+    components.reserve(owners.size());
+    for (const auto& owner : owners)
+    {
+      components.push_back(owner.get());
+    }
+  }
+
+  if (grain == 0)
+  {
+    // Hand out a few chunks per thread so that uneven chunks balance out.
+    std::size_t numberOfChunks = 4 * (executor.numberOfThreads() + 1);
+    grain = (components.size() + numberOfChunks - 1) / numberOfChunks;
+  }
+
+  Component* const* data = components.data();
+  executor.parallelFor(
+    0, components.size(), grain, [data, &visitor](std::size_t first, std::size_t last) {
+      visitor(data + first, data + last);
+    });
+}
+
+void Resource::visitParallel(const ChunkVisitor& visitor, std::size_t grain) const
+{
+  this->visitParallel(*smtk::common::Executor::instance(), visitor, grain);
+}
+
+bool Resource::gatherComponents(std::vector<Component*>& /*unused*/) const
+{
+  return false;
+}
+
+bool Resource::queryCandidates(
+  const std::function<bool(const Component&)>& queryOp,
+  smtk::common::UUIDs& candidates) const
+{
+  const auto* filter = queryOp.target<smtk::resource::filter::Filter<>>();
+  return filter && filter->candidates(m_properties, candidates);
+}
+
 bool Resource::isOfType(const Resource::Index& index) const
 {
   return this->index() == index;
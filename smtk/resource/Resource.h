@@ -26,9 +26,14 @@
 #include <string>
 #include <typeindex>
 #include <unordered_map>
+#include <vector>
 
 namespace smtk
 {
+namespace common
+{
+class Executor;
+}
 namespace operation
 {
 class Operation;
@@ -146,6 +151,27 @@ public:
   /// visit all components in a resource.
   virtual void visit(std::function<void(const ComponentPtr&)>& v) const = 0;
 
+  /// A functor that accepts a contiguous chunk [first, last) of a resource's
+  /// components.
+  typedef std::function<void(Component* const* first, Component* const* last)> ChunkVisitor;
+
+  /// Visit all components in contiguous chunks of at most \a grain components
+  /// (or a balanced number of chunks if \a grain is 0), processing chunks
+  /// concurrently on \a executor. The calling thread participates and the
+  /// method returns once every chunk has been visited.
+  ///
+  /// The caller must hold at least a read lock on the resource for the
+  /// duration of the call (as operations do for their read-only resources).
+  /// Visitors may read components concurrently but must not add or remove
+  /// components.
+  void visitParallel(
+    smtk::common::Executor& executor,
+    const ChunkVisitor& visitor,
+    std::size_t grain = 0) const;
+
+  /// Visit all components in chunks as above using smtk::common::Executor::instance().
+  void visitParallel(const ChunkVisitor& visitor, std::size_t grain = 0) const;
+
   /// given a a std::string describing a query, return a set of components that
   /// satisfy the query criteria.
   ComponentSet find(const std::string& queryString) const;
@@ -181,6 +207,20 @@ protected:
   Resource(const smtk::common::UUID&, ManagerPtr manager = nullptr);
   Resource(ManagerPtr manager = nullptr);
 
+  /// Given a functor returned by queryOperation(), insert the ids of (a
+  /// superset of) the components it accepts into \a candidates using the
+  /// resource's property indices. Returns false if the query cannot be
+  /// narrowed this way, in which case every component must be tested.
+  virtual bool queryCandidates(
+    const std::function<bool(const Component&)>& queryOp,
+    smtk::common::UUIDs& candidates) const;
+
+  /// Append a pointer to each of the resource's components to \a components
+  /// for visitParallel(). Resources that own their components should
+  /// override this to avoid the reference counting of visit(). Returns false
+  /// (the default) if the components must be gathered via visit() instead.
+  virtual bool gatherComponents(std::vector<Component*>& components) const;
+
   WeakManagerPtr m_manager;
 
 private:
@@ -255,7 +295,22 @@ Collection Resource::findAs(const std::string& queryString) const
     }
   };
 
-  this->visit(visitor);
+  smtk::common::UUIDs candidates;
+  if (this->queryCandidates(queryOp, candidates))
+  {
+    for (const auto& candidate : candidates)
+    {
+      auto component = this->find(candidate);
+      if (component)
+      {
+        visitor(component);
+      }
+    }
+  }
+  else
+  {
+    this->visit(visitor);
+  }
 
   return col;
 }
@@ -71,6 +71,7 @@ struct NameAction
   {
     std::unique_ptr<Rule>& rule = rules.data().back();
     std::string name = input.string();
+    static_cast<RuleFor<Type>*>(rule.get())->indexedKey = name;
     static_cast<RuleFor<Type>*>(rule.get())->acceptableKeys =
       [name](const PersistentObject& object) -> std::vector<std::string> {
       std::vector<std::string> returnValue;
@@ -118,6 +119,7 @@ struct ValueAction
   {
     std::unique_ptr<Rule>& rule = rules.data().back();
     Type value = Property<Type>::convert(input.string());
+    static_cast<RuleFor<Type>*>(rule.get())->indexedValue = std::make_shared<Type>(value);
     static_cast<RuleFor<Type>*>(rule.get())->acceptableValue = [value](const Type& val) -> bool {
       return val == value;
     };
@@ -20,7 +20,10 @@
 #include "smtk/resource/filter/Grammar.h"
 #include "smtk/resource/filter/Rules.h"
 
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 namespace smtk
 {
@@ -39,50 +42,66 @@ class Filter
 public:
   Filter(const std::string& str)
     : m_filterString(str)
-    , m_rules(std::move(constructRules(str)))
+    , m_rules(rulesFor(str))
   {
   }
   virtual ~Filter() = default;
 
   // Specific filter rules are composed by parsing string inputs, and are
   // therefore inherently runtime-constructed objects (and, thus, are allocated
-  // on the heap). To accommodate their memory management, these objects are
-  // stored using a std::unique_ptr, which has move-only semantics.
-  // smtk:::resource::filter::Filter must satisfy the API for
+  // on the heap). smtk:::resource::filter::Filter must satisfy the API for
   // smtk::resource::Resource::queryOperation, which returns a std::function by
-  // value. As a result, this class Defines copy construction and assignment by
-  // reconstructing the internal rule when necessary.
-
-  Filter(const Filter& other)
-    : m_filterString(other.m_filterString)
-    , m_rules(std::move(constructRules(other.m_filterString)))
+  // value, and the same few filter strings are typically parsed many times
+  // (e.g., by UI filters and reference item acceptance checks). Since rules
+  // are not modified once parsed, they are shared by all filters constructed
+  // from the same string: copies are cheap and each string is parsed once.
+
+  Filter(const Filter&) = default;
+  Filter& operator=(const Filter&) = default;
+
+  bool operator()(const Component& component) const { return (*m_rules)(component); }
+
+  /// Insert the ids of (a superset of) the components accepted by the filter
+  /// into \a candidates using the indices of \a properties. Returns false if
+  /// the indices cannot narrow the search.
+  bool candidates(
+    const smtk::resource::detail::ResourceProperties& properties,
+    smtk::common::UUIDs& candidates) const
   {
+    return m_rules->candidates(properties, candidates);
   }
 
-  Filter(Filter&& other) noexcept
-    : m_filterString(std::move(other.m_filterString))
-    , m_rules(std::move(other.m_rules))
-  {
-  }
+private:
+  // The maximum number of parsed filter strings retained for each grammar.
+  static constexpr std::size_t s_maxCachedRules = 256;
 
-  Filter& operator=(const Filter& other)
+  static std::shared_ptr<const smtk::resource::filter::Rules> rulesFor(
+    const std::string& filterString)
   {
-    m_filterString = other.m_filterString;
-    m_rules = constructRules(other.m_filterString);
-    return *this;
-  }
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::shared_ptr<const smtk::resource::filter::Rules>>
+      cache;
+    {
+      std::lock_guard<std::mutex> guard(mutex);
+      auto it = cache.find(filterString);
+      if (it != cache.end())
+      {
+        return it->second;
+      }
+    }
 
-  Filter& operator=(Filter&& other) noexcept
-  {
-    m_filterString = other.m_filterString;
-    m_rules = std::move(other.m_rules);
-    return *this;
-  }
+    std::shared_ptr<const smtk::resource::filter::Rules> rules =
+      std::make_shared<smtk::resource::filter::Rules>(constructRules(filterString));
 
-  bool operator()(const Component& component) const { return m_rules(component); }
+    std::lock_guard<std::mutex> guard(mutex);
+    if (cache.size() >= s_maxCachedRules)
+    {
+      cache.clear();
+    }
+    return cache.emplace(filterString, rules).first->second;
+  }
 
-private:
-  smtk::resource::filter::Rules constructRules(const std::string& filterString)
+  static smtk::resource::filter::Rules constructRules(const std::string& filterString)
   {
     smtk::resource::filter::Rules rules;
 
@@ -105,7 +124,7 @@ private:
   }
 
   std::string m_filterString;
-  smtk::resource::filter::Rules m_rules;
+  std::shared_ptr<const smtk::resource::filter::Rules> m_rules;
 };
 } // namespace filter
 } // namespace resource
@@ -13,6 +13,8 @@
 #include "smtk/resource/PersistentObject.h"
 
 #include <algorithm>
+#include <memory>
+#include <string>
 
 namespace smtk
 {
@@ -28,6 +30,14 @@ public:
   virtual ~Rule() = default;
 
   virtual bool operator()(const PersistentObject&) const = 0;
+
+  /// Insert the ids of (a superset of) the components accepted by this rule
+  /// into the given set using the indices of a resource's properties.
+  /// Returns false if the rule cannot use the indices.
+  virtual bool candidates(const detail::ResourceProperties&, smtk::common::UUIDs&) const
+  {
+    return false;
+  }
 };
 
 /// A class template for rules dealing with a specific property type.
@@ -56,8 +66,20 @@ public:
   // name filter.
   std::function<std::vector<std::string>(const PersistentObject&)> acceptableKeys;
 
+  bool candidates(const detail::ResourceProperties& properties, smtk::common::UUIDs& result)
+    const override
+  {
+    return indexedValue && !indexedKey.empty() &&
+      properties.findCandidates<Type>(indexedKey, *indexedValue, result);
+  }
+
   // Given a value, determine whether this passes the filter.
   std::function<bool(const Type&)> acceptableValue;
+
+  // The exact key and value this rule requires, if any. They let the rule
+  // look up candidates in the property indices of a resource.
+  std::string indexedKey;
+  std::shared_ptr<Type> indexedValue;
 };
 } // namespace filter
 } // namespace resource
@@ -43,6 +43,36 @@ public:
     });
   }
 
+  /// Replace \a candidates with the ids that every rule able to use the
+  /// indices of \a properties admits. Returns false if no rule can.
+  bool candidates(
+    const smtk::resource::detail::ResourceProperties& properties,
+    smtk::common::UUIDs& candidates) const
+  {
+    bool narrowed = false;
+    for (const auto& rule : m_data)
+    {
+      smtk::common::UUIDs ids;
+      if (!rule->candidates(properties, ids))
+      {
+        continue;
+      }
+      if (!narrowed)
+      {
+        candidates = std::move(ids);
+        narrowed = true;
+      }
+      else
+      {
+        for (auto it = candidates.begin(); it != candidates.end();)
+        {
+          it = ids.find(*it) == ids.end() ? candidates.erase(it) : std::next(it);
+        }
+      }
+    }
+    return narrowed;
+  }
+
   template<typename... Args>
   void emplace_back(Args&&... args)
   {
@@ -84,6 +84,8 @@ struct ValueAction<std::vector<Type>>
       value.push_back(Property<Type>::convert(str));
     }
 
+    static_cast<RuleFor<std::vector<Type>>*>(rule.get())->indexedValue =
+      std::make_shared<std::vector<Type>>(value);
     static_cast<RuleFor<std::vector<Type>>*>(rule.get())->acceptableValue =
       [value](const std::vector<Type>& val) -> bool {
       if (val.size() != value.size())
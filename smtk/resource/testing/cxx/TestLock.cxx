@@ -0,0 +1,123 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/resource/Lock.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using smtk::resource::Lock;
+using smtk::resource::LockType;
+
+void testStates()
+{
+  Lock lock;
+  smtkTest(lock.state() == LockType::Unlocked, "New lock should be unlocked");
+
+  lock.lock(LockType::Read);
+  lock.lock(LockType::Read);
+  smtkTest(lock.state() == LockType::Read, "Expected a read lock");
+  smtkTest(lock.statistics().activeReaders == 2, "Expected two readers");
+  smtkTest(!lock.tryLock(LockType::Write), "Writer should not be admitted with active readers");
+
+  // An upgrade cannot complete while another reader holds the lock.
+  smtkTest(!lock.upgrade(std::chrono::milliseconds(10)), "Upgrade should time out");
+  lock.unlock(LockType::Read);
+  smtkTest(lock.upgrade(), "Upgrade should succeed once the lock is the only reader");
+  smtkTest(lock.state() == LockType::Write, "Expected a write lock after upgrade");
+  smtkTest(!lock.tryLock(LockType::Read), "Reader should not be admitted with an active writer");
+
+  lock.downgrade();
+  smtkTest(lock.state() == LockType::Read, "Expected a read lock after downgrade");
+  lock.unlock(LockType::Read);
+  smtkTest(lock.state() == LockType::Unlocked, "Expected the lock to be released");
+}
+
+void testPolicy()
+{
+  Lock lock;
+  lock.lock(LockType::Read);
+
+  std::atomic<bool> written{ false };
+  std::thread writer([&lock, &written]() {
+    lock.lock(LockType::Write);
+    written = true;
+    lock.unlock(LockType::Write);
+  });
+  while (!lock.statistics().pendingWriter)
+  {
+    std::this_thread::yield();
+  }
+
+  // A pending writer blocks new readers under the default policy...
+  smtkTest(!lock.tryLock(LockType::Read), "Writer-preferred lock admitted a reader");
+
+  // ...but not under the reader-preferred policy.
+  lock.setPolicy(Lock::Policy::ReaderPreferred);
+  smtkTest(lock.tryLock(LockType::Read), "Reader-preferred lock refused a reader");
+  lock.unlock(LockType::Read);
+
+  lock.unlock(LockType::Read);
+  writer.join();
+  smtkTest(written, "Writer did not run");
+  smtkTest(lock.statistics().contendedWrites == 1, "Expected one contended write");
+}
+
+void testContention()
+{
+  Lock lock;
+  int value = 0;
+  std::atomic<int> reads{ 0 };
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t)
+  {
+    threads.emplace_back([&lock, &value, &reads, t]() {
+      for (int i = 0; i < 1000; ++i)
+      {
+        if ((i + t) % 4 == 0)
+        {
+          smtk::resource::ScopedLockGuard guard(lock, LockType::Write);
+          ++value;
+        }
+        else
+        {
+          smtk::resource::ScopedLockGuard guard(lock, LockType::Read);
+          if (value >= 0)
+          {
+            ++reads;
+          }
+          if (i % 50 == 0 && guard.upgrade(std::chrono::milliseconds(1)))
+          {
+            ++value;
+          }
+        }
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  smtkTest(lock.state() == LockType::Unlocked, "Lock should be released");
+  smtkTest(value >= 2000, "Expected at least 2000 exclusive increments, got " << value);
+}
+} // namespace
+
+int TestLock(int /*unused*/, char** const /*unused*/)
+{
+  testStates();
+  testPolicy();
+  testContention();
+  return 0;
+}
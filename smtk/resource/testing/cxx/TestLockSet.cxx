@@ -0,0 +1,123 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/resource/LockSet.h"
+
+#include "smtk/resource/Component.h"
+#include "smtk/resource/DerivedFrom.h"
+#include "smtk/resource/Resource.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+class Resource : public smtk::resource::DerivedFrom<Resource, smtk::resource::Resource>
+{
+public:
+  smtkTypeMacro(Resource);
+  smtkCreateMacro(Resource);
+  smtkSharedFromThisMacro(smtk::resource::PersistentObject);
+
+  smtk::resource::ComponentPtr find(const smtk::common::UUID& /*unused*/) const override
+  {
+    return smtk::resource::ComponentPtr();
+  }
+
+  std::function<bool(const smtk::resource::Component&)> queryOperation(
+    const std::string& /*unused*/) const override
+  {
+    return [](const smtk::resource::Component& /*unused*/) { return true; };
+  }
+
+  void visit(smtk::resource::Component::Visitor& /*unused*/) const override {}
+
+protected:
+  Resource() = default;
+};
+
+void testExclusion()
+{
+  auto a = Resource::create();
+  auto b = Resource::create();
+  auto c = Resource::create();
+
+  smtk::resource::LockSet writer;
+  writer.insert(a, smtk::resource::LockType::Write);
+  writer.insert(b, smtk::resource::LockType::Read);
+  writer.insert(b, smtk::resource::LockType::Write);
+  smtkTest(writer.size() == 2, "Duplicate resources should be merged");
+  writer.lock();
+  smtkTest(a->locked() == smtk::resource::LockType::Write, "Expected a write lock on a");
+  smtkTest(b->locked() == smtk::resource::LockType::Write, "Expected merged write lock on b");
+
+  // A set sharing a resource must not be acquired, and must not leave any of
+  // its other resources locked behind.
+  smtk::resource::LockSet overlapping;
+  overlapping.insert(c, smtk::resource::LockType::Write);
+  overlapping.insert(b, smtk::resource::LockType::Read);
+  smtkTest(!overlapping.tryLock(), "Overlapping lock set should not be acquired");
+  smtkTest(!overlapping.tryLockFor(std::chrono::milliseconds(10)), "Acquisition should time out");
+  smtkTest(c->locked() == smtk::resource::LockType::Unlocked, "Back-off should release c");
+
+  // A disjoint set is acquired immediately.
+  smtk::resource::LockSet disjoint;
+  disjoint.insert(c, smtk::resource::LockType::Write);
+  smtkTest(disjoint.tryLock(), "Disjoint lock set should be acquired");
+  disjoint.unlock();
+
+  writer.unlock();
+  smtkTest(overlapping.tryLock(), "Lock set should be acquired once released");
+  smtkTest(overlapping.upgrade(b), "Read lock should be upgradable");
+  smtkTest(b->locked() == smtk::resource::LockType::Write, "Expected upgraded write lock on b");
+}
+
+void testContention()
+{
+  std::vector<Resource::Ptr> resources;
+  for (int i = 0; i < 4; ++i)
+  {
+    resources.push_back(Resource::create());
+  }
+
+  // Threads lock overlapping pairs of resources in different orders; without
+  // ordered acquisition and back-off this would deadlock.
+  int counter = 0;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t)
+  {
+    threads.emplace_back([&resources, &counter, t]() {
+      for (int i = 0; i < 200; ++i)
+      {
+        smtk::resource::LockSet locks;
+        locks.insert(resources[(t + i) % 4], smtk::resource::LockType::Write);
+        locks.insert(resources[(t + i + 1) % 4], smtk::resource::LockType::Read);
+        locks.insert(resources[0], smtk::resource::LockType::Write);
+        locks.lock();
+        ++counter;
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  smtkTest(counter == 1600, "Expected 1600 exclusive increments, got " << counter);
+}
+} // namespace
+
+int TestLockSet(int /*unused*/, char** const /*unused*/)
+{
+  testExclusion();
+  testContention();
+  return 0;
+}
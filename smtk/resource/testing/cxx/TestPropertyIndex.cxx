@@ -0,0 +1,200 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/resource/Component.h"
+#include "smtk/resource/DerivedFrom.h"
+#include "smtk/resource/PropertyIndex.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// Exercise the secondary indices of resource properties as component
+/// properties are inserted, modified and erased.
+
+namespace
+{
+class Resource;
+
+class Component : public smtk::resource::Component
+{
+  friend class Resource;
+
+public:
+  smtkTypeMacro(Component);
+  smtkSuperclassMacro(smtk::resource::PersistentObject);
+  smtkSharedFromThisMacro(smtk::resource::PersistentObject);
+
+  const smtk::resource::ResourcePtr resource() const override { return this->m_resource; }
+
+  const smtk::common::UUID& id() const override { return m_id; }
+  bool setId(const smtk::common::UUID& id) override
+  {
+    m_id = id;
+    return true;
+  }
+
+private:
+  Component(smtk::resource::ResourcePtr resource)
+    : m_resource(resource)
+  {
+  }
+
+  const smtk::resource::ResourcePtr m_resource;
+  smtk::common::UUID m_id;
+};
+
+class Resource : public smtk::resource::DerivedFrom<Resource, smtk::resource::Resource>
+{
+public:
+  smtkTypeMacro(Resource);
+  smtkCreateMacro(Resource);
+  smtkSharedFromThisMacro(smtk::resource::PersistentObject);
+
+  Component::Ptr newComponent()
+  {
+    Component::Ptr shared(new Component(shared_from_this()));
+    shared->setId(smtk::common::UUID::random());
+    m_components[shared->id()] = shared;
+    return shared;
+  }
+
+  using smtk::resource::Resource::find;
+
+  smtk::resource::ComponentPtr find(const smtk::common::UUID& id) const override
+  {
+    auto it = m_components.find(id);
+    return (it != m_components.end() ? it->second : smtk::resource::ComponentPtr());
+  }
+
+  void visit(smtk::resource::Component::Visitor& visitor) const override
+  {
+    for (const auto& entry : m_components)
+    {
+      visitor(entry.second);
+    }
+  }
+
+protected:
+  Resource()
+    : smtk::resource::DerivedFrom<Resource, smtk::resource::Resource>()
+  {
+  }
+
+private:
+  std::unordered_map<smtk::common::UUID, smtk::resource::ComponentPtr> m_components;
+};
+
+smtk::common::UUIDs ids(const std::vector<Component::Ptr>& components)
+{
+  smtk::common::UUIDs result;
+  for (const auto& component : components)
+  {
+    result.insert(component->id());
+  }
+  return result;
+}
+} // namespace
+
+int TestPropertyIndex(int /*unused*/, char** const /*unused*/)
+{
+  using smtk::resource::PropertyIndexType;
+  typedef std::vector<std::string> StringList;
+
+  Resource::Ptr resource = Resource::create();
+  auto& properties = resource->properties();
+
+  // Populate some properties before indexing them.
+  std::vector<Component::Ptr> components;
+  for (int i = 0; i < 20; ++i)
+  {
+    components.push_back(resource->newComponent());
+    components.back()->properties().insert<long>("group", i % 4);
+  }
+
+  properties.addIndex<long>("group", PropertyIndexType::Hash);
+  properties.addIndex<long>("group", PropertyIndexType::Ordered);
+  properties.addIndex<StringList>("tags", PropertyIndexType::Inverted);
+  smtkTest(properties.hasIndex<long>("group", PropertyIndexType::Hash), "Missing hash index.");
+  smtkTest(
+    !properties.hasIndex<long>("group", PropertyIndexType::Inverted), "Unexpected inverted index.");
+  smtkTest(!properties.hasIndex<double>("group", PropertyIndexType::Hash), "Unexpected index.");
+
+  // Indices are populated from existing values.
+  smtk::common::UUIDs found;
+  smtkTest(properties.findEqual<long>("group", 1, found), "Hash index not used.");
+  smtkTest(
+    found == ids({ components[1], components[5], components[9], components[13], components[17] }),
+    "Unexpected ids in group 1.");
+  found.clear();
+  smtkTest(properties.findInRange<long>("group", 2, 3, found), "Ordered index not used.");
+  smtkTest(found.size() == 10, "Unexpected number of ids in groups [2, 3].");
+  found.clear();
+  smtkTest(!properties.findContaining<long>("group", 1, found), "No inverted index expected.");
+
+  // Values set through a component are re-indexed.
+  components[1]->properties().at<long>("group") = 7;
+  components[2]->properties().get<long>()["group"] = 7;
+  components[3]->properties().erase<long>("group");
+  found.clear();
+  properties.findEqual<long>("group", 7, found);
+  smtkTest(found == ids({ components[1], components[2] }), "Modified values not indexed.");
+  found.clear();
+  properties.findEqual<long>("group", 3, found);
+  smtkTest(
+    found == ids({ components[7], components[11], components[15], components[19] }),
+    "Erased value still indexed.");
+
+  // Vector values are indexed by their elements.
+  components[0]->properties().insert<StringList>("tags", { "red", "round" });
+  components[4]->properties().insert<StringList>("tags", { "red", "square" });
+  components[8]->properties().emplace<StringList>("tags", { "blue", "round" });
+  found.clear();
+  smtkTest(properties.findContaining<StringList>("tags", "red", found), "Inverted index not used.");
+  smtkTest(found == ids({ components[0], components[4] }), "Unexpected red ids.");
+  components[4]->properties().at<StringList>("tags").push_back("round");
+  found.clear();
+  properties.findContaining<StringList>("tags", "round", found);
+  smtkTest(
+    found == ids({ components[0], components[4], components[8] }), "Appended element not indexed.");
+
+  // Removed components are removed from the index.
+  properties.data().eraseId(components[0]->id());
+  found.clear();
+  properties.findContaining<StringList>("tags", "round", found);
+  smtkTest(found == ids({ components[4], components[8] }), "Erased id still indexed.");
+
+  // Direct access to a property's values invalidates its indices.
+  typedef std::unordered_map<smtk::common::UUID, long> LongValues;
+  properties.data().get<LongValues>()["group"][components[5]->id()] = 11;
+  found.clear();
+  properties.findEqual<long>("group", 11, found);
+  smtkTest(found == ids({ components[5] }), "Directly modified value not indexed.");
+
+  // Queries on indexed properties return the same components as a full visit.
+  auto queried = resource->find("[ integer { 'group' = 0 } ]");
+  smtk::common::UUIDs queriedIds;
+  for (const auto& component : queried)
+  {
+    queriedIds.insert(component->id());
+  }
+  smtkTest(
+    queriedIds == ids({ components[4], components[8], components[12], components[16] }),
+    "Indexed query returned unexpected components.");
+
+  properties.removeIndex<long>("group", PropertyIndexType::Hash);
+  properties.removeIndex<long>("group", PropertyIndexType::Ordered);
+  found.clear();
+  smtkTest(!properties.findEqual<long>("group", 0, found), "Removed index still used.");
+  smtkTest(resource->find("[ integer { 'group' = 0 } ]").size() == 4, "Unindexed query failed.");
+
+  return 0;
+}
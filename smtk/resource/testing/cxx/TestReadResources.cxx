@@ -0,0 +1,145 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/resource/Component.h"
+#include "smtk/resource/DerivedFrom.h"
+#include "smtk/resource/Manager.h"
+
+#include "smtk/common/Executor.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/// Exercise reading several resources concurrently through a resource manager.
+
+namespace
+{
+class ResourceA : public smtk::resource::DerivedFrom<ResourceA, smtk::resource::Resource>
+{
+public:
+  smtkTypeMacro(ResourceA);
+  smtkCreateMacro(ResourceA);
+  smtkSharedFromThisMacro(smtk::resource::PersistentObject);
+
+  smtk::resource::ComponentPtr find(const smtk::common::UUID& /*compId*/) const override
+  {
+    return smtk::resource::ComponentPtr();
+  }
+
+  std::function<bool(const smtk::resource::Component&)> queryOperation(
+    const std::string& /*unused*/) const override
+  {
+    return [](const smtk::resource::Component& /*unused*/) { return true; };
+  }
+
+  void visit(smtk::resource::Component::Visitor& /*v*/) const override {}
+
+protected:
+  ResourceA()
+    : smtk::resource::DerivedFrom<ResourceA, smtk::resource::Resource>()
+  {
+  }
+};
+
+std::atomic<int> activeReaders(0);
+std::atomic<int> maxActiveReaders(0);
+
+// Read a resource named after its location, recording how many reads overlap.
+smtk::resource::ResourcePtr readA(const std::string& location)
+{
+  int active = ++activeReaders;
+  int previous = maxActiveReaders.load();
+  while (active > previous && !maxActiveReaders.compare_exchange_weak(previous, active))
+  {
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  --activeReaders;
+
+  if (location.find("missing") != std::string::npos)
+  {
+    return smtk::resource::ResourcePtr();
+  }
+  if (location.find("corrupt") != std::string::npos)
+  {
+    throw std::runtime_error("Corrupt resource " + location);
+  }
+  auto resource = ResourceA::create();
+  resource->setName(location);
+  resource->setClean(false);
+  return resource;
+}
+} // namespace
+
+int TestReadResources(int /*unused*/, char** const /*unused*/)
+{
+  smtk::resource::ManagerPtr resourceManager = smtk::resource::Manager::create();
+  resourceManager->registerResource<ResourceA>(readA);
+
+  std::vector<std::string> added;
+  auto handle = resourceManager->observers().insert(
+    [&added](const smtk::resource::Resource& resource, smtk::resource::EventType event) {
+      if (event == smtk::resource::EventType::ADDED)
+      {
+        added.push_back(resource.name());
+      }
+    });
+
+  std::string typeName = smtk::common::typeName<ResourceA>();
+  std::vector<std::pair<std::string, std::string>> requests;
+  for (int ii = 0; ii < 8; ++ii)
+  {
+    requests.emplace_back(typeName, "/path/to/resource" + std::to_string(ii));
+  }
+  requests.emplace_back(typeName, "/path/to/missing");
+  requests.emplace_back("unregistered", "/path/to/resource");
+
+  smtk::common::Executor executor(4);
+  auto resources = resourceManager->read(requests, executor);
+
+  smtkTest(resources.size() == requests.size(), "Wrong number of resources returned.");
+  smtkTest(resourceManager->size() == 8, "Resources not added to manager.");
+  smtkTest(!resources[8] && !resources[9], "Unreadable resources returned.");
+  smtkTest(added.size() == 8, "Did not observe resources being added.");
+  for (std::size_t ii = 0; ii < 8; ++ii)
+  {
+    const auto& resource = resources[ii];
+    smtkTest(!!resource, "Resource " << ii << " not read.");
+    smtkTest(resource->location() == requests[ii].second, "Resource location not assigned.");
+    smtkTest(resource->clean(), "Resource " << ii << " not marked clean.");
+    smtkTest(resource->manager() == resourceManager, "Resource " << ii << " not managed.");
+    smtkTest(added[ii] == requests[ii].second, "Resources not added in the order requested.");
+  }
+  smtkTest(maxActiveReaders > 1, "Resources were not read concurrently.");
+
+  // A reader that throws prevents the whole batch from being added.
+  std::vector<std::pair<std::string, std::string>> corrupt = {
+    { typeName, "/path/to/another" }, { typeName, "/path/to/corrupt" }
+  };
+  bool threw = false;
+  try
+  {
+    resourceManager->read(corrupt, executor);
+  }
+  catch (std::runtime_error&)
+  {
+    threw = true;
+  }
+  smtkTest(threw, "Reader exception not propagated.");
+  smtkTest(resourceManager->size() == 8, "Resources added despite a failed read.");
+
+  resourceManager->observers().erase(handle);
+  return 0;
+}
@@ -14,6 +14,8 @@
 #include "smtk/resource/Manager.h"
 #include "smtk/resource/PersistentObject.h"
 
+#include "smtk/resource/json/jsonResource.h"
+
 #include "smtk/common/UUID.h"
 #include "smtk/common/json/jsonUUID.h"
 #include "smtk/common/testing/cxx/helpers.h"
@@ -149,5 +151,30 @@ int TestResourceProperties(int /*unused*/, char** const /*unused*/)
 
   std::cout << "destructor works" << std::endl;
 
+  {
+    // Reading properties merges them with those already held.
+    Resource::Ptr resource = Resource::create();
+    Component::Ptr written = resource->newComponent();
+    written->properties().get<double>()["foo"] = 1.;
+    nlohmann::json j;
+    smtk::resource::to_json(j, resource);
+
+    Resource::Ptr target = Resource::create();
+    Component::Ptr held = target->newComponent();
+    held->properties().get<double>()["foo"] = 2.;
+    held->properties().get<double>()["bar"] = 3.;
+    smtk::resource::ResourcePtr base = target;
+    smtk::resource::from_json(j, base);
+
+    typedef std::unordered_map<smtk::common::UUID, double> DoubleProperty;
+    const auto& foo = target->properties().data().at<DoubleProperty>("foo");
+    test(
+      foo.size() == 2 && fabs(foo.at(written->id()) - 1.) < double_epsilon &&
+        fabs(foo.at(held->id()) - 2.) < double_epsilon,
+      "Read properties were not merged with held properties.");
+    test(
+      held->properties().contains<double>("bar"), "Held properties were replaced when reading.");
+  }
+
   return 0;
 }
@@ -0,0 +1,180 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/resource/Component.h"
+#include "smtk/resource/DerivedFrom.h"
+
+#include "smtk/common/Executor.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+/// Exercise the chunked, parallel visitation of a resource's components.
+
+namespace
+{
+class Resource;
+
+class Component : public smtk::resource::Component
+{
+  friend class Resource;
+
+public:
+  smtkTypeMacro(Component);
+  smtkSuperclassMacro(smtk::resource::PersistentObject);
+  smtkSharedFromThisMacro(smtk::resource::PersistentObject);
+
+  const smtk::resource::ResourcePtr resource() const override { return this->m_resource; }
+
+  const smtk::common::UUID& id() const override { return m_id; }
+  bool setId(const smtk::common::UUID& id) override
+  {
+    m_id = id;
+    return true;
+  }
+
+private:
+  Component(smtk::resource::ResourcePtr resource)
+    : m_resource(resource)
+  {
+  }
+
+  const smtk::resource::ResourcePtr m_resource;
+  smtk::common::UUID m_id;
+};
+
+class Resource : public smtk::resource::DerivedFrom<Resource, smtk::resource::Resource>
+{
+public:
+  smtkTypeMacro(Resource);
+  smtkCreateMacro(Resource);
+  smtkSharedFromThisMacro(smtk::resource::PersistentObject);
+
+  Component::Ptr newComponent()
+  {
+    Component::Ptr shared(new Component(shared_from_this()));
+    shared->setId(smtk::common::UUID::random());
+    m_components[shared->id()] = shared;
+    return shared;
+  }
+
+  smtk::resource::ComponentPtr find(const smtk::common::UUID& id) const override
+  {
+    auto it = m_components.find(id);
+    return (it != m_components.end() ? it->second : smtk::resource::ComponentPtr());
+  }
+
+  void visit(smtk::resource::Component::Visitor& visitor) const override
+  {
+    for (const auto& entry : m_components)
+    {
+      visitor(entry.second);
+    }
+  }
+
+  // Resources may provide raw pointers to their components; when they do
+  // not, visitParallel() gathers them via visit().
+  bool m_gather{ true };
+
+protected:
+  bool gatherComponents(std::vector<smtk::resource::Component*>& components) const override
+  {
+    if (!m_gather)
+    {
+      return false;
+    }
+    for (const auto& entry : m_components)
+    {
+      components.push_back(entry.second.get());
+    }
+    return true;
+  }
+
+  Resource()
+    : smtk::resource::DerivedFrom<Resource, smtk::resource::Resource>()
+  {
+  }
+
+private:
+  std::unordered_map<smtk::common::UUID, smtk::resource::ComponentPtr> m_components;
+};
+
+void visitAll(const Resource::Ptr& resource, smtk::common::Executor& executor, std::size_t grain)
+{
+  std::mutex mutex;
+  std::multiset<smtk::common::UUID> visited;
+  std::atomic<std::size_t> numberOfChunks{ 0 };
+  resource->visitParallel(
+    executor,
+    [&](smtk::resource::Component* const* first, smtk::resource::Component* const* last) {
+      smtkTest(first < last, "Empty chunk visited.");
+      smtkTest(grain == 0 || last - first <= static_cast<long>(grain), "Chunk exceeds grain.");
+      ++numberOfChunks;
+      std::lock_guard<std::mutex> guard(mutex);
+      for (auto it = first; it != last; ++it)
+      {
+        visited.insert((*it)->id());
+      }
+    },
+    grain);
+
+  std::multiset<smtk::common::UUID> expected;
+  smtk::resource::Component::Visitor visitor = [&expected](
+                                                 const smtk::resource::ComponentPtr& component) {
+    expected.insert(component->id());
+  };
+  resource->visit(visitor);
+  smtkTest(visited == expected, "Each component should be visited exactly once.");
+  smtkTest(
+    grain == 0 || numberOfChunks == (expected.size() + grain - 1) / grain,
+    "Unexpected number of chunks.");
+}
+} // namespace
+
+int TestVisitParallel(int /*unused*/, char** const /*unused*/)
+{
+  Resource::Ptr resource = Resource::create();
+  smtk::common::Executor executor(4);
+
+  // An empty resource has no chunks to visit.
+  resource->visitParallel(
+    executor,
+    [](smtk::resource::Component* const*, smtk::resource::Component* const*) {
+      smtkTest(false, "No chunks expected.");
+    });
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    resource->newComponent();
+  }
+
+  visitAll(resource, executor, 0);
+  visitAll(resource, executor, 1);
+  visitAll(resource, executor, 64);
+  visitAll(resource, executor, 5000);
+
+  resource->m_gather = false;
+  visitAll(resource, executor, 0);
+  visitAll(resource, executor, 37);
+
+  // The process-wide executor may also be used.
+  std::atomic<std::size_t> count{ 0 };
+  resource->visitParallel(
+    [&count](smtk::resource::Component* const* first, smtk::resource::Component* const* last) {
+      count += last - first;
+    });
+  smtkTest(count == 1000, "Unexpected number of components visited.");
+
+  return 0;
+}
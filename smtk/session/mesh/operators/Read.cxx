@@ -19,6 +19,7 @@
 
 #include "smtk/common/Archive.h"
 #include "smtk/common/CompilerInformation.h"
+#include "smtk/common/json/jsonBinary.h"
 
 #include "smtk/model/json/jsonResource.h"
 
@@ -55,7 +56,7 @@ Read::Result Read::operateInternal()
   }
   else
   {
-    file.open(filename);
+    file.open(filename, std::ios::in | std::ios::binary);
   }
 
   if (!file.good())
@@ -68,7 +69,7 @@ Read::Result Read::operateInternal()
   nlohmann::json j;
   try
   {
-    j = nlohmann::json::parse(file);
+    j = smtk::common::BinaryJSON::parse(file);
   }
   catch (...)
   {
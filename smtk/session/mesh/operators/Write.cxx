@@ -19,6 +19,7 @@
 #include "smtk/common/Archive.h"
 #include "smtk/common/CompilerInformation.h"
 #include "smtk/common/Paths.h"
+#include "smtk/common/json/jsonBinary.h"
 
 #include "smtk/session/mesh/Resource.h"
 #include "smtk/session/mesh/Write_xml.h"
@@ -68,6 +69,8 @@ Write::Result Write::operateInternal()
   smtk::session::mesh::Resource::Ptr resource =
     std::dynamic_pointer_cast<smtk::session::mesh::Resource>(resourceItem->value());
 
+  bool binary = smtk::common::BinaryJSON::isBinaryLocation(resource->location());
+
   // Serialize resource into a set of JSON records:
   nlohmann::json j = resource;
   if (j.is_null())
@@ -98,13 +101,13 @@ Write::Result Write::operateInternal()
 
     // Write the smtk index
     {
-      std::ofstream file(tmpsmtkPath.string());
+      std::ofstream file(tmpsmtkPath.string(), std::ios::out | std::ios::binary);
       if (!file.good())
       {
         smtkErrorMacro(log(), "Unable to open \"" << tmpsmtkPath << "\" for writing.");
         return this->createResult(smtk::operation::Operation::Outcome::FAILED);
       }
-      file << j.dump(2);
+      smtk::common::BinaryJSON::dump(j, file, binary);
       file.close();
     }
 
@@ -171,13 +174,13 @@ Write::Result Write::operateInternal()
     j["Mesh URL"] = meshFilename;
 
     {
-      std::ofstream file(resource->location());
+      std::ofstream file(resource->location(), std::ios::out | std::ios::binary);
       if (!file.good())
       {
         smtkErrorMacro(log(), "Unable to open \"" << resource->location() << "\" for writing.");
         return this->createResult(smtk::operation::Operation::Outcome::FAILED);
       }
-      file << j.dump(2);
+      smtk::common::BinaryJSON::dump(j, file, binary);
       file.close();
     }
 
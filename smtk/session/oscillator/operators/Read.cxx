@@ -27,8 +27,6 @@
 
 #include "smtk/common/Paths.h"
 
-#include "smtk/model/SessionIOJSON.h"
-
 #include <fstream>
 
 using namespace smtk::model;
@@ -44,32 +42,38 @@ Read::Result Read::operateInternal()
 {
   std::string filename = this->parameters()->findFile("filename")->value();
 
-  std::ifstream file(filename);
+  std::ifstream file(filename, std::ios::in | std::ios::binary);
   if (!file.good())
   {
     smtkErrorMacro(log(), "Cannot read file \"" << filename << "\".");
     return this->createResult(smtk::operation::Operation::Outcome::FAILED);
   }
 
-  // Load file and parse it:
-  smtk::model::SessionIOJSON::json j = smtk::model::SessionIOJSON::loadJSON(filename);
-  if (j.is_null())
-  {
-    smtkErrorMacro(log(), "Cannot parse file \"" << filename << "\".");
-    return this->createResult(smtk::operation::Operation::Outcome::FAILED);
-  }
-
-  std::string resourceIdStr = j.at("id");
-  smtk::common::UUID resourceId(resourceIdStr);
-
   // Create a new resource for the import
   auto resource = smtk::session::oscillator::Resource::create();
-  resource->setId(resourceId);
   resource->setLocation(filename);
 
-  // Transcribe model data onto the resource
+  // Transcribe the file's model data onto the resource; the resource's id is
+  // required. Binary files are mapped and their entities' topology is read
+  // lazily; text files are streamed, transcribing entities as they are parsed.
   auto modelResource = std::static_pointer_cast<smtk::model::Resource>(resource);
-  smtk::model::from_json(j, modelResource);
+  auto hasId = [](const nlohmann::json& j) { return j.find("id") != j.end(); };
+  try
+  {
+    auto document = smtk::common::MappedJSON::open(filename);
+    if (
+      document ? !smtk::model::from_json(document, modelResource, hasId)
+               : !smtk::model::from_json(file, modelResource, hasId))
+    {
+      smtkErrorMacro(log(), "Cannot read file \"" << filename << "\" - Missing id.");
+      return this->createResult(smtk::operation::Operation::Outcome::FAILED);
+    }
+  }
+  catch (...)
+  {
+    smtkErrorMacro(log(), "Cannot parse file \"" << filename << "\".");
+    return this->createResult(smtk::operation::Operation::Outcome::FAILED);
+  }
 
   auto volumes = resource->entitiesMatchingFlagsAs<smtk::model::Volumes>(
     smtk::model::VOLUME, /*exactMatch*/ true);
@@ -56,6 +56,10 @@ Write::Result Write::operateInternal()
   smtk::session::oscillator::Resource::Ptr rsrc =
     std::dynamic_pointer_cast<smtk::session::oscillator::Resource>(resourceItem->value());
 
+  // Entities read lazily decode their topology from the file they were read
+  // from (which may be the one about to be overwritten) until it is accessed.
+  rsrc->materializeTopology();
+
   // Serialize resource into a set of JSON records:
   smtk::model::SessionIOJSON::json j = rsrc;
 
@@ -70,7 +74,7 @@ Write::Result Write::operateInternal()
   bool ok = smtk::model::SessionIOJSON::saveModelRecords(j, rsrc->location());
 
   return ok ? this->createResult(smtk::operation::Operation::Outcome::SUCCEEDED)
-            : this->createResult(smtk::operation::Operation::Outcome::SUCCEEDED);
+            : this->createResult(smtk::operation::Operation::Outcome::FAILED);
 }
 
 const char* Write::xmlDescription() const
@@ -78,8 +82,15 @@ const char* Write::xmlDescription() const
   return Write_xml;
 }
 
-void Write::markModifiedResources(Write::Result& /*unused*/)
+void Write::markModifiedResources(Write::Result& result)
 {
+  if (
+    result->findInt("outcome")->value() !=
+    static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED))
+  {
+    return;
+  }
+
   auto resourceItem = this->parameters()->associations();
   for (auto rit = resourceItem->begin(); rit != resourceItem->end(); ++rit)
   {
@@ -0,0 +1,90 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/session/oscillator/Resource.h"
+#include "smtk/session/oscillator/operators/Read.h"
+#include "smtk/session/oscillator/operators/Write.h"
+
+#include "smtk/model/Entity.h"
+#include "smtk/model/Model.h"
+#include "smtk/model/Volume.h"
+#include "smtk/model/json/jsonResource.h"
+
+#include "smtk/common/UUID.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+#include "smtk/model/testing/cxx/helpers.h"
+
+#include <cstdio>
+
+namespace
+{
+std::string writeRoot = SMTK_SCRATCH_DIR;
+
+std::size_t deferredEntities(const smtk::model::ResourcePtr& resource)
+{
+  std::size_t deferred = 0;
+  for (const auto& entry : resource->topology())
+  {
+    deferred += entry.second->isTopologyDeferred() ? 1 : 0;
+  }
+  return deferred;
+}
+} // namespace
+
+// Overwrite the binary file a model was lazily read from, then access the
+// topology of every entity (which must not refer to the overwritten file).
+int TestWriteInPlace(int /*unused*/, char* /*unused*/[])
+{
+  auto source = std::static_pointer_cast<smtk::model::Resource>(
+    smtk::session::oscillator::Resource::create());
+  smtk::common::UUIDArray uids = smtk::model::testing::createTet(source);
+  smtk::model::Model model = source->addModel(3, 3, "tet");
+  model.addCell(smtk::model::Volume(source, uids[21]));
+  std::string filename = writeRoot + "/" + smtk::common::UUID::random().toString() + ".smtkb";
+  source->setLocation(filename);
+  smtkTest(smtk::session::oscillator::write(source), "Could not write \"" << filename << "\".");
+
+  auto lazy =
+    std::dynamic_pointer_cast<smtk::model::Resource>(smtk::session::oscillator::read(filename));
+  smtkTest(!!lazy, "Could not read \"" << filename << "\".");
+  smtkTest(deferredEntities(lazy) > 0, "Expected entities with deferred topology.");
+
+  smtkTest(smtk::session::oscillator::write(lazy), "Could not write \"" << filename << "\" again.");
+  smtkTest(deferredEntities(lazy) == 0, "Expected topology to be read before writing.");
+
+  // Walk the topology of every entity.
+  for (const auto& entry : lazy->topology())
+  {
+    const smtk::model::Entity& entity(*entry.second);
+    smtk::model::EntityPtr sourceEntity = source->findEntity(entry.first);
+    smtkTest(!!sourceEntity, "Unexpected entity " << entry.first << ".");
+    smtkTest(
+      entity.relations() == sourceEntity->relations(),
+      "Relations of " << entry.first << " differ.");
+    smtkTest(
+      entity.arrangementMap().size() == sourceEntity->arrangementMap().size(),
+      "Arrangements of " << entry.first << " differ.");
+  }
+
+  // The file written in place holds the complete model.
+  auto reread =
+    std::dynamic_pointer_cast<smtk::model::Resource>(smtk::session::oscillator::read(filename));
+  smtkTest(!!reread, "Could not read \"" << filename << "\" after writing in place.");
+  nlohmann::json jSource;
+  nlohmann::json jReread;
+  smtk::model::to_json(jSource, source);
+  smtk::model::to_json(jReread, reread);
+  smtkTest(jReread["models"] == jSource["models"], "Model written in place differs.");
+
+  reread = nullptr;
+  lazy = nullptr;
+  std::remove(filename.c_str());
+  return 0;
+}
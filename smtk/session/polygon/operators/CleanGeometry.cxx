@@ -773,8 +773,18 @@ CleanGeometry::Result CleanGeometry::operateInternal()
   smtk::model::EntityRefArray expunged;
   { // This block is here to limit the scope of "result"
     // II. Intersect all the segments.
+    // The model is not modified until edges are split below, so this is the
+    // last point at which the operation may be canceled.
+    if (!this->reportProgress(0.1, "Intersecting segments"))
+    {
+      return this->createResult(smtk::operation::Operation::Outcome::CANCELED);
+    }
     SegmentSplitsT result;
     intersect_segments(result, segs.begin(), segs.end());
+    if (!this->reportProgress(0.5, "Splitting edges"))
+    {
+      return this->createResult(smtk::operation::Operation::Outcome::CANCELED);
+    }
 
     // III. Prepare a lookup table for the results as well
     std::map<smtk::model::Edge, std::pair<size_t, size_t>> reslkup;
@@ -834,6 +844,7 @@ CleanGeometry::Result CleanGeometry::operateInternal()
   }
 
   // V. Split edges as required to break partial overlaps.
+  this->reportProgress(0.7, "Splitting partially overlapping edges");
   std::set<smtk::model::Edge> processed; // Keep track of edges we've already checked.
   struct DeferredSplit
   {
@@ -876,6 +887,7 @@ CleanGeometry::Result CleanGeometry::operateInternal()
   }
 
   // VI. Remove overlapping model edges
+  this->reportProgress(0.85, "Removing overlapping edges");
   //     We do this by pairwise comparison of model edges that share endpoints.
   //     No model edges should overlap
   std::set<std::pair<smtk::model::Edge, smtk::model::Edge>> processedPairs;
@@ -30,8 +30,8 @@
 #include "smtk/model/Group.h"
 #include "smtk/model/Model.h"
 
+#include "smtk/common/Executor.h"
 #include "smtk/common/Paths.h"
-#include "smtk/common/ThreadPool.h"
 #include "smtk/common/UUID.h"
 
 #include "vtkContourFilter.h"
@@ -441,18 +441,18 @@ Import::Result Import::importExodus(const smtk::session::vtk::Resource::Ptr& res
   std::vector<vtkSmartPointer<vtkMultiBlockDataSet>> modelsOut(filenameItem->numberOfValues());
   if (filenameItem->numberOfValues() > 1)
   {
-    smtk::common::ThreadPool<vtkSmartPointer<vtkMultiBlockDataSet>> threadPool;
-    std::vector<std::future<vtkSmartPointer<vtkMultiBlockDataSet>>> futures;
+    smtk::common::Executor executor(static_cast<unsigned int>(
+      std::min<std::size_t>(modelsOut.size(), std::thread::hardware_concurrency())));
+    executor.parallelFor(
+      0, modelsOut.size(), 1, [&modelsOut, &filenameItem](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i)
+        {
+          modelsOut[i] = importExodusInternal(filenameItem->value(i));
+        }
+      });
 
     for (std::size_t i = 0; i < modelsOut.size(); ++i)
     {
-      std::string filename = filenameItem->value();
-      futures.push_back(threadPool(std::bind(importExodusInternal, filename)));
-    }
-
-    for (std::size_t i = 0; i < modelsOut.size(); ++i)
-    {
-      modelsOut[i] = futures[i].get();
 
       if (modelsOut[i] == nullptr)
       {